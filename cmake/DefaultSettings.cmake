@@ -25,6 +25,11 @@ macro(set_common_defaults)
 	set(CMAKE_CXX_VISIBILITY_PRESET hidden CACHE STRING "Hidden visibility of symbols in shared libraries.")
 	option(ECOLE_BUILD_LIB "Build Ecole library, find already installed otherwise" ON)
 	option(ECOLE_BUILD_PY_EXT "Build Ecole Python Extension" ON)
+	option(
+		ECOLE_PHILOX_RANDOM_GENERATOR
+		"Use the counter-based Philox random generator instead of the Mersenne Twister" OFF
+	)
+	option(ECOLE_ENABLE_TRACING "Compile tracing spans in the library (recording is enabled at runtime)" ON)
 endmacro()
 
 
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "allocation-counter.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+std::atomic<std::size_t> allocated_bytes{0};
+
+auto counted_malloc(std::size_t size) -> void* {
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	return std::malloc(size == 0 ? 1 : size);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+auto counted_aligned_alloc(std::size_t size, std::align_val_t align) -> void* {
+	auto const alignment = static_cast<std::size_t>(align);
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	// Size must be a multiple of the alignment
+	return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+}  // namespace
+
+auto AllocationStats::now() noexcept -> AllocationStats {
+	return {allocation_count.load(std::memory_order_relaxed), allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace ecole::benchmark
+
+/****************************************************
+ *  Replacement of the global allocation functions  *
+ ****************************************************/
+
+using ecole::benchmark::counted_aligned_alloc;
+using ecole::benchmark::counted_malloc;
+
+auto operator new(std::size_t size) -> void* {
+	if (auto* ptr = counted_malloc(size); ptr != nullptr) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+auto operator new[](std::size_t size) -> void* {
+	return operator new(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t align) -> void* {
+	if (auto* ptr = counted_aligned_alloc(size, align); ptr != nullptr) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+auto operator new[](std::size_t size, std::align_val_t align) -> void* {
+	return operator new(size, align);
+}
+
+auto operator new(std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return counted_malloc(size);
+}
+
+auto operator new[](std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return counted_malloc(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t align, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return counted_aligned_alloc(size, align);
+}
+
+auto operator new[](std::size_t size, std::align_val_t align, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return counted_aligned_alloc(size, align);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc)
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t /*align*/) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t /*align*/) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t /*size*/, std::align_val_t /*align*/) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t /*size*/, std::align_val_t /*align*/) noexcept {
+	std::free(ptr);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc)
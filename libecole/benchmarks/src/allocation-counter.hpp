@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ecole::benchmark {
+
+/**
+ * Number of dynamic allocations made through the global operator new since the start of the program.
+ *
+ * Allocations made directly with malloc, such as SCIP block memory, are not counted.
+ */
+struct AllocationStats {
+	std::size_t n_allocations = 0;
+	std::size_t n_bytes = 0;
+
+	static auto now() noexcept -> AllocationStats;
+
+	auto operator-(AllocationStats const& other) const noexcept -> AllocationStats {
+		return {n_allocations - other.n_allocations, n_bytes - other.n_bytes};
+	}
+};
+
+}  // namespace ecole::benchmark
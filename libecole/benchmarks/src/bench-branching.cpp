@@ -1,4 +1,5 @@
 #include <chrono>
+#include <optional>
 #include <tuple>
 #include <utility>
 
@@ -12,27 +13,37 @@
 #include "bench-branching.hpp"
 #include "branching/index-branchrule.hpp"
 #include "csv.hpp"
+#include "perf-counters.hpp"
 
 namespace ecole::benchmark {
 
 namespace {
 
-template <typename Func> auto measure_on_model(Func&& func_to_bench, scip::Model model) -> Metrics {
+/** Measure a function on a model, with the hardware counters of the calling thread and its children if requested. */
+template <typename Func>
+auto measure_on_model(Func&& func_to_bench, scip::Model model, bool with_perf_counters) -> Metrics {
+	auto perf_counters = std::optional<PerfCounters>{};
+	if (with_perf_counters) {
+		perf_counters.emplace();
+		perf_counters->start();
+	}
 	auto const cpu_time_before = utility::cpu_clock::now();
 	auto const wall_time_before = std::chrono::steady_clock::now();
 	func_to_bench(model);
 	auto const wall_time_after = std::chrono::steady_clock::now();
 	auto const cpu_time_after = utility::cpu_clock::now();
+	auto const perf_counts = perf_counters.has_value() ? perf_counters->stop() : PerfCounts{};
 
 	return {
 		std::chrono::duration<double>(wall_time_after - wall_time_before).count(),
 		std::chrono::duration<double>(cpu_time_after - cpu_time_before).count(),
 		static_cast<std::size_t>(SCIPgetNTotalNodes(model.get_scip_ptr())),
 		static_cast<std::size_t>(SCIPgetNLPIterations(model.get_scip_ptr())),
+		perf_counts,
 	};
 }
 
-auto measure_branching_dynamics(scip::Model model) -> Metrics {
+auto measure_branching_dynamics(scip::Model model, bool with_perf_counters) -> Metrics {
 	return measure_on_model(
 		[](scip::Model& m) {
 			auto dyn = dynamics::BranchingDynamics{};
@@ -41,10 +52,11 @@ auto measure_branching_dynamics(scip::Model model) -> Metrics {
 				std::tie(done, action_set) = dyn.step_dynamics(m, action_set.value()[0]);
 			}
 		},
-		std::move(model));
+		std::move(model),
+		with_perf_counters);
 }
 
-auto measure_branching_rule(scip::Model model) -> Metrics {
+auto measure_branching_rule(scip::Model model, bool with_perf_counters) -> Metrics {
 	return measure_on_model(
 		[](scip::Model& m) {
 			auto* branch_rule = new ecole::scip::IndexBranchrule{m.get_scip_ptr(), "FirstVarBranching", 0UL};
@@ -52,7 +64,8 @@ auto measure_branching_rule(scip::Model model) -> Metrics {
 			// NOLINTNEXTLINE dynamically allocated object ownership is given to SCIP
 			m.solve();
 		},
-		std::move(model));
+		std::move(model),
+		with_perf_counters);
 }
 
 }  // namespace
@@ -66,11 +79,11 @@ auto BranchingResult::csv() -> std::string {
 	return merge_csv(instance.csv(), branching_dynamics_metrics.csv(), branching_rule_metrics.csv());
 }
 
-auto benchmark_branching(scip::Model const& model) -> BranchingResult {
+auto benchmark_branching(scip::Model const& model, bool with_perf_counters) -> BranchingResult {
 	return {
 		InstanceFeatures::from_model(model.copy_orig()),
-		measure_branching_dynamics(model.copy_orig()),
-		measure_branching_rule(model.copy_orig()),
+		measure_branching_dynamics(model.copy_orig(), with_perf_counters),
+		measure_branching_rule(model.copy_orig(), with_perf_counters),
 	};
 }
 
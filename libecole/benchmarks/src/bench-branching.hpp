@@ -17,7 +17,11 @@ struct BranchingResult {
 	auto csv() -> std::string;
 };
 
-/** Benchmark the branching dynamics against a branch rule on a given model. */
-auto benchmark_branching(scip::Model const& model) -> BranchingResult;
+/**
+ * Benchmark the branching dynamics against a branch rule on a given model.
+ *
+ * Optionally capture hardware performance counters around the measured regions.
+ */
+auto benchmark_branching(scip::Model const& model, bool with_perf_counters = false) -> BranchingResult;
 
 }  // namespace ecole::benchmark
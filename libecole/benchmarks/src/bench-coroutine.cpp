@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "ecole/utility/coroutine.hpp"
+
+#include "perf-counters.hpp"
+
+/**
+ * Benchmark of the handoff between a Coroutine and its executor thread.
+ *
+ * Measure the distribution of the round trip latency (resume followed by wait) with trivial payloads, for a number
+ * of coroutines driven concurrently, with and without pinning threads to cores.
+ * Also measure the cost of creating a coroutine (until its first value is received) and destroying it.
+ * Results are written as JSON, tagged with a user-given strategy name to compare synchronization implementations.
+ * Optionally, Linux perf_event counters of all threads are captured for each round trip measurement.
+ */
+
+using Coroutine = ecole::utility::Coroutine<std::uint64_t, std::uint64_t>;
+using Executor = Coroutine::Executor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/** Quote and escape a string to write it in JSON. */
+auto json_string(std::string_view str) -> std::string {
+	auto quoted = std::string{'"'};
+	for (auto const c : str) {
+		switch (c) {
+		case '"':
+			quoted += R"(\")";
+			break;
+		case '\\':
+			quoted += R"(\\)";
+			break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {  // NOLINT(readability-magic-numbers)
+				quoted += fmt::format("\\u{:04x}", static_cast<int>(c));
+			} else {
+				quoted += c;
+			}
+		}
+	}
+	quoted += '"';
+	return quoted;
+}
+
+enum struct Pinning { none, same_core, split_cores };
+
+auto to_string(Pinning pinning) -> char const* {
+	switch (pinning) {
+	case Pinning::none:
+		return "none";
+	case Pinning::same_core:
+		return "same_core";
+	default:
+		return "split_cores";
+	}
+}
+
+/** Pin the calling thread to a core, return whether it succeeded. */
+auto pin_this_thread(std::optional<unsigned> core) -> bool {
+	if (!core.has_value()) {
+		return true;
+	}
+#ifdef __linux__
+	auto cpu_set = cpu_set_t{};
+	CPU_ZERO(&cpu_set);
+	CPU_SET(core.value() % std::max(std::thread::hardware_concurrency(), 1U), &cpu_set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+/** The cores of the driver and executor threads of the i-th coroutine. */
+auto cores_of(Pinning pinning, std::size_t i) -> std::pair<std::optional<unsigned>, std::optional<unsigned>> {
+	auto const idx = static_cast<unsigned>(i);
+	switch (pinning) {
+	case Pinning::none:
+		return {};
+	case Pinning::same_core:
+		return {idx, idx};
+	default:
+		return {2 * idx, 2 * idx + 1};
+	}
+}
+
+struct Distribution {
+	std::size_t n_samples = 0;
+	double mean = 0.;
+	double p50 = 0.;
+	double p99 = 0.;
+	double p999 = 0.;
+	double max = 0.;
+
+	static auto from(std::vector<std::int64_t> samples) -> Distribution {
+		if (samples.empty()) {
+			return {};
+		}
+		std::sort(samples.begin(), samples.end());
+		auto const quantile = [&samples](double q) {
+			auto const idx = static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1));
+			return static_cast<double>(samples[idx]);
+		};
+		auto const sum = std::accumulate(samples.begin(), samples.end(), 0.);
+		return {
+			samples.size(),
+			sum / static_cast<double>(samples.size()),
+			quantile(0.5),    // NOLINT(readability-magic-numbers)
+			quantile(0.99),   // NOLINT(readability-magic-numbers)
+			quantile(0.999),  // NOLINT(readability-magic-numbers)
+			static_cast<double>(samples.back()),
+		};
+	}
+
+	[[nodiscard]] auto json() const -> std::string {
+		return fmt::format(
+			R"({{"n_samples": {}, "mean": {:.1f}, "p50": {:.1f}, "p99": {:.1f}, "p999": {:.1f}, "max": {:.1f}}})",
+			n_samples,
+			mean,
+			p50,
+			p99,
+			p999,
+			max);
+	}
+};
+
+struct RoundTripResult {
+	std::size_t n_coroutines = 0;
+	Pinning pinning = Pinning::none;
+	bool pinned = true;
+	double throughput_per_s = 0.;
+	Distribution latency_ns;
+	std::optional<ecole::benchmark::PerfCounts> perf_counts;
+
+	[[nodiscard]] auto json() const -> std::string {
+		return fmt::format(
+			R"({{"n_coroutines": {}, "pinning": "{}", "pinning_succeeded": {}, "throughput_per_s": {:.1f}, )"
+			R"("latency_ns": {}, "perf_counters": {}}})",
+			n_coroutines,
+			to_string(pinning),
+			pinned,
+			throughput_per_s,
+			latency_ns.json(),
+			perf_counts.has_value() ? perf_counts->json() : "null");
+	}
+};
+
+/** An executor yielding back every message it receives, until stopped. */
+auto echo(Executor& executor, std::optional<unsigned> core, bool& pinned) -> void {
+	pinned = pin_this_thread(core);
+	auto message = executor.yield(0);
+	while (!Executor::is_stop(message)) {
+		message = executor.yield(std::get<std::uint64_t>(message));
+	}
+}
+
+/**
+ * Drive n_coroutines concurrently, each from its own thread, and time every round trip.
+ *
+ * The throughput is measured once all coroutines are created, until the last round trip ends.
+ */
+auto bench_round_trip(std::size_t n_coroutines, Pinning pinning, std::size_t n_round_trips, bool with_perf_counters)
+	-> RoundTripResult {
+	auto samples = std::vector<std::vector<std::int64_t>>(n_coroutines);
+	auto pinned = std::vector<char>(2 * n_coroutines, 0);
+	auto ends = std::vector<Clock::time_point>(n_coroutines);
+	auto drivers = std::vector<std::thread>{};
+	auto n_ready = std::atomic<std::size_t>{0};
+	auto go = std::atomic<bool>{false};
+
+	// Opened before creating the threads to count them
+	auto perf_counters = std::optional<ecole::benchmark::PerfCounters>{};
+	if (with_perf_counters) {
+		perf_counters.emplace();
+		perf_counters->start();
+	}
+	for (std::size_t i = 0; i < n_coroutines; ++i) {
+		drivers.emplace_back([&, i] {
+			auto const [driver_core, executor_core] = cores_of(pinning, i);
+			pinned[2 * i] = static_cast<char>(pin_this_thread(driver_core));
+			auto executor_pinned = false;
+			{
+				auto co = Coroutine{[&executor_pinned, core = executor_core](Executor& executor) {
+					echo(executor, core, executor_pinned);
+				}};
+				co.wait();
+				auto& thread_samples = samples[i];
+				thread_samples.reserve(n_round_trips);
+				n_ready.fetch_add(1);
+				while (!go.load()) {
+					std::this_thread::yield();
+				}
+				for (std::uint64_t n = 0; n < n_round_trips; ++n) {
+					auto const before = Clock::now();
+					co.resume(n);
+					co.wait();
+					thread_samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - before).count());
+				}
+				ends[i] = Clock::now();
+			}
+			pinned[2 * i + 1] = static_cast<char>(executor_pinned);
+		});
+	}
+	while (n_ready.load() < n_coroutines) {
+		std::this_thread::yield();
+	}
+	auto const start = Clock::now();
+	go.store(true);
+	for (auto& driver : drivers) {
+		driver.join();
+	}
+	auto const end = n_coroutines > 0 ? *std::max_element(ends.begin(), ends.end()) : start;
+	auto const wall_time = std::chrono::duration<double>(end - start).count();
+	auto perf_counts = std::optional<ecole::benchmark::PerfCounts>{};
+	if (perf_counters.has_value()) {
+		perf_counts = perf_counters->stop();
+	}
+
+	auto all_samples = std::vector<std::int64_t>{};
+	for (auto const& thread_samples : samples) {
+		all_samples.insert(all_samples.end(), thread_samples.begin(), thread_samples.end());
+	}
+	return {
+		n_coroutines,
+		pinning,
+		std::all_of(pinned.begin(), pinned.end(), [](char p) { return p != 0; }),
+		static_cast<double>(all_samples.size()) / wall_time,
+		Distribution::from(std::move(all_samples)),
+		perf_counts,
+	};
+}
+
+/** Time the creation of coroutines, until the first value is received, and their destruction. */
+auto bench_lifetime(std::size_t n_coroutines) -> std::pair<Distribution, Distribution> {
+	auto creations = std::vector<std::int64_t>{};
+	auto destructions = std::vector<std::int64_t>{};
+	creations.reserve(n_coroutines);
+	destructions.reserve(n_coroutines);
+	auto pinned = false;
+	for (std::size_t i = 0; i < n_coroutines; ++i) {
+		auto const before_creation = Clock::now();
+		auto co = std::optional<Coroutine>{};
+		co.emplace([&pinned](Executor& executor) { echo(executor, std::nullopt, pinned); });
+		co->wait();
+		auto const before_destruction = Clock::now();
+		co.reset();
+		auto const after_destruction = Clock::now();
+		creations.push_back(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(before_destruction - before_creation).count());
+		destructions.push_back(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(after_destruction - before_destruction).count());
+	}
+	return {Distribution::from(std::move(creations)), Distribution::from(std::move(destructions))};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	try {
+		auto app = CLI::App{"Benchmark the Coroutine handoff latency and throughput."};
+		app.failure_message(CLI::FailureMessage::help);
+		auto n_round_trips = std::size_t{100000};  // NOLINT(readability-magic-numbers)
+		app.add_option("--round-trips,-n", n_round_trips, "Number of round trips measured on each coroutine");
+		auto n_coroutines = std::vector<std::size_t>{1, 2, 4};  // NOLINT(readability-magic-numbers)
+		app.add_option("--coroutines,-c", n_coroutines, "Numbers of coroutines run concurrently");
+		auto n_lifetimes = std::size_t{1000};  // NOLINT(readability-magic-numbers)
+		app.add_option("--lifetimes", n_lifetimes, "Number of coroutines created and destroyed");
+		auto strategy = std::string{"mutex-condition_variable"};
+		app.add_option("--strategy", strategy, "Name of the synchronization strategy, copied in the output");
+		auto output = std::string{};
+		app.add_option("--output,-o", output, "JSON output file, standard output if not given");
+		auto with_perf_counters = false;
+		app.add_flag("--perf-counters", with_perf_counters, "Capture Linux perf_event counters of round trips");
+		CLI11_PARSE(app, argc, argv);
+
+		auto round_trips = std::vector<std::string>{};
+		for (auto const n : n_coroutines) {
+			for (auto const pinning : {Pinning::none, Pinning::same_core, Pinning::split_cores}) {
+				round_trips.push_back(bench_round_trip(n, pinning, n_round_trips, with_perf_counters).json());
+			}
+		}
+		auto const [creation, destruction] = bench_lifetime(n_lifetimes);
+
+		auto const json = fmt::format(
+			"{{\n"
+			R"(  "benchmark": "coroutine", "strategy": {}, "hardware_concurrency": {},)"
+			"\n"
+			R"(  "round_trip": [)"
+			"\n    {}\n  ],\n"
+			R"(  "creation": {{"latency_ns": {}}},)"
+			"\n"
+			R"(  "destruction": {{"latency_ns": {}}})"
+			"\n}}\n",
+			json_string(strategy),
+			std::thread::hardware_concurrency(),
+			fmt::join(round_trips, ",\n    "),
+			creation.json(),
+			destruction.json());
+
+		if (output.empty()) {
+			std::cout << json;
+		} else {
+			std::ofstream{output} << json;
+		}
+	} catch (std::exception const& e) {
+		std::cerr << "An error occured: " << e.what() << '\n';
+		return 1;
+	}
+}
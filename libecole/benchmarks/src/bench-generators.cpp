@@ -0,0 +1,196 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "ecole/instance/capacitated-facility-location.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+#include "ecole/instance/independent-set.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/random.hpp"
+#include "ecole/utility/tracing.hpp"
+
+#include "bench-generators.hpp"
+#include "csv.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+constexpr auto kib_per_mib = 1024.;
+
+/** Read a memory field of the process status, in MiB, or NaN if not available. */
+auto read_status_mib(std::string_view field) -> double {
+#ifdef __linux__
+	auto status = std::ifstream{"/proc/self/status"};
+	auto line = std::string{};
+	while (std::getline(status, line)) {
+		if ((line.size() > field.size()) && (line.compare(0, field.size(), field) == 0) && (line[field.size()] == ':')) {
+			return static_cast<double>(std::stoul(line.substr(field.size() + 1))) / kib_per_mib;
+		}
+	}
+#endif
+	return nan;
+}
+
+/**
+ * Reset the peak resident set size of the process to its current value.
+ *
+ * Requires Linux 4.0 or above, otherwise the peak is the one since the start of the process.
+ */
+auto reset_peak_rss() -> void {
+#ifdef __linux__
+	std::ofstream{"/proc/self/clear_refs"} << "5";
+#endif
+}
+
+auto ends_with(std::string_view str, std::string_view suffix) -> bool {
+	return (str.size() >= suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+/** Total duration of the generator phases recorded by the tracer, in seconds. */
+auto phase_durations() -> std::pair<double, double> {
+	auto sample_data_ns = std::int64_t{0};
+	auto build_model_ns = std::int64_t{0};
+	for (auto const& event : utility::tracing::collect()) {
+		if (std::string_view{event.category} != "instance") {
+			continue;
+		}
+		if (ends_with(event.name, "::sample_data")) {
+			sample_data_ns += event.duration_ns;
+		} else if (ends_with(event.name, "::build_model")) {
+			build_model_ns += event.duration_ns;
+		}
+	}
+	constexpr auto ns_per_s = 1e9;
+	return {static_cast<double>(sample_data_ns) / ns_per_s, static_cast<double>(build_model_ns) / ns_per_s};
+}
+
+/**
+ * Generate instances one at a time, as done when training.
+ *
+ * Only the generation is timed, destroying the previous model is not.
+ */
+template <typename Generator>
+auto measure_generator(
+	std::string name,
+	std::string size,
+	typename Generator::Parameters parameters,
+	std::size_t n_instances) -> GeneratorResult {
+	auto rng = spawn_random_generator();
+	auto total_s = 0.;
+	auto sample_data_s = 0.;
+	auto build_model_s = 0.;
+
+	auto const rss_before_mib = read_status_mib("VmRSS");
+	reset_peak_rss();
+	for (std::size_t i = 0; i < n_instances; ++i) {
+		utility::tracing::clear();
+		auto const before = std::chrono::steady_clock::now();
+		[[maybe_unused]] auto const model = Generator::generate_instance(parameters, rng);
+		total_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+		auto const [sample_s, build_s] = phase_durations();
+		sample_data_s += sample_s;
+		build_model_s += build_s;
+	}
+	auto const peak_rss_mib = read_status_mib("VmHWM");
+
+	auto const n = static_cast<double>(n_instances);
+	auto const traced = utility::tracing::is_enabled();
+	return {
+		std::move(name),
+		std::move(size),
+		n_instances,
+		n / total_s,
+		traced ? sample_data_s / n : nan,
+		traced ? build_model_s / n : nan,
+		rss_before_mib,
+		peak_rss_mib,
+	};
+}
+
+}  // namespace
+
+auto GeneratorResult::csv_title() -> std::string {
+	return make_csv(
+		"generator",
+		"size",
+		"n_instances",
+		"instances_per_s",
+		"sample_data_s",
+		"build_model_s",
+		"rss_before_mib",
+		"peak_rss_mib");
+}
+
+auto GeneratorResult::csv() -> std::string {
+	return make_csv(
+		generator, size, n_instances, instances_per_s, sample_data_s, build_model_s, rss_before_mib, peak_rss_mib);
+}
+
+auto benchmark_generators(std::size_t n_instances, std::ostream& out) -> void {
+	using namespace ecole::instance;
+	using GraphType = IndependentSetGenerator::Parameters::GraphType;
+	using Size = std::array<std::size_t, 2>;
+
+	// Phases are timed using the spans of the generators
+#ifdef ECOLE_ENABLE_TRACING
+	utility::tracing::enable();
+#endif
+
+	auto const measure_and_print = [&out](auto&& measure) noexcept {
+		try {
+			out << measure().csv() << std::endl;
+		} catch (std::exception const& e) {
+			std::cerr << "Error when benchmarking a generator: " << e.what() << '\n';
+		}
+	};
+
+	out << GeneratorResult::csv_title() << '\n';
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	for (auto const& size : {Size{500, 1000}, Size{1000, 1000}, Size{2000, 1000}}) {
+		measure_and_print([&] {
+			return measure_generator<SetCoverGenerator>(
+				"SetCover", fmt::format("{}x{}", size[0], size[1]), {size[0], size[1]}, n_instances);
+		});
+	}
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	for (auto const& size : {Size{100, 500}, Size{200, 1000}, Size{300, 1500}}) {
+		measure_and_print([&] {
+			return measure_generator<CombinatorialAuctionGenerator>(
+				"CombinatorialAuction", fmt::format("{}x{}", size[0], size[1]), {size[0], size[1]}, n_instances);
+		});
+	}
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	for (auto const& size : {Size{100, 100}, Size{200, 100}, Size{400, 100}}) {
+		measure_and_print([&] {
+			return measure_generator<CapacitatedFacilityLocationGenerator>(
+				"CapacitatedFacilityLocation", fmt::format("{}x{}", size[0], size[1]), {size[0], size[1]}, n_instances);
+		});
+	}
+	for (auto const graph_type : {GraphType::erdos_renyi, GraphType::barabasi_albert}) {
+		auto const* const name =
+			graph_type == GraphType::erdos_renyi ? "IndependentSet-erdos_renyi" : "IndependentSet-barabasi_albert";
+		for (std::size_t n_nodes : {500, 1000, 1500}) {  // NOLINT(readability-magic-numbers)
+			measure_and_print([&] {
+				return measure_generator<IndependentSetGenerator>(
+					name, fmt::format("{}", n_nodes), {n_nodes, graph_type}, n_instances);
+			});
+		}
+	}
+
+#ifdef ECOLE_ENABLE_TRACING
+	utility::tracing::disable();
+#endif
+}
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace ecole::benchmark {
+
+/**
+ * Throughput and memory usage of an instance generator for given parameters.
+ *
+ * Phase durations are averaged over instances, and are not available (NaN) when Ecole is built without tracing.
+ */
+struct GeneratorResult {
+	std::string generator = {};
+	std::string size = {};
+	std::size_t n_instances = 0;
+	double instances_per_s = 0.;
+	double sample_data_s = 0.;
+	double build_model_s = 0.;
+	double rss_before_mib = 0.;
+	double peak_rss_mib = 0.;
+
+	static auto csv_title() -> std::string;
+	auto csv() -> std::string;
+};
+
+/** Benchmark all instance generators on a sweep of sizes, writing a CSV line as each one completes. */
+auto benchmark_generators(std::size_t n_instances, std::ostream& out) -> void;
+
+}  // namespace ecole::benchmark
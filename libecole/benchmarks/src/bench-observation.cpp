@@ -0,0 +1,191 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/instance/capacitated-facility-location.hpp"
+#include "ecole/instance/combinatorial-auction.hpp"
+#include "ecole/instance/independent-set.hpp"
+#include "ecole/instance/set-cover.hpp"
+#include "ecole/observation/capacity.hpp"
+#include "ecole/observation/focusnode.hpp"
+#include "ecole/observation/hutter-2011.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/milp-bipartite.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/observation/strong-branching-scores.hpp"
+#include "ecole/observation/weight.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "allocation-counter.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Number of instance sizes in the sweep of each generator. */
+constexpr std::size_t n_sizes = 3;
+
+/** The instance generator parameters for each size, and how to name them. */
+template <typename Generator> struct Sweep;
+
+template <> struct Sweep<instance::SetCoverGenerator> {
+	static constexpr auto name = "SetCover";
+	static auto parameters(std::size_t size) -> instance::SetCoverGenerator::Parameters {
+		constexpr auto n_rows = std::array<std::size_t, n_sizes>{500, 1000, 2000};
+		return {n_rows.at(size), 1000};  // NOLINT(readability-magic-numbers)
+	}
+};
+
+template <> struct Sweep<instance::CombinatorialAuctionGenerator> {
+	static constexpr auto name = "CombinatorialAuction";
+	static auto parameters(std::size_t size) -> instance::CombinatorialAuctionGenerator::Parameters {
+		constexpr auto n_items = std::array<std::size_t, n_sizes>{100, 200, 300};
+		constexpr auto n_bids = std::array<std::size_t, n_sizes>{500, 1000, 1500};
+		return {n_items.at(size), n_bids.at(size)};
+	}
+};
+
+template <> struct Sweep<instance::CapacitatedFacilityLocationGenerator> {
+	static constexpr auto name = "CapacitatedFacilityLocation";
+	static auto parameters(std::size_t size) -> instance::CapacitatedFacilityLocationGenerator::Parameters {
+		constexpr auto n_customers = std::array<std::size_t, n_sizes>{100, 200, 400};
+		return {n_customers.at(size), 100};  // NOLINT(readability-magic-numbers)
+	}
+};
+
+template <> struct Sweep<instance::IndependentSetGenerator> {
+	static constexpr auto name = "IndependentSet";
+	static auto parameters(std::size_t size) -> instance::IndependentSetGenerator::Parameters {
+		using GraphType = instance::IndependentSetGenerator::Parameters::GraphType;
+		constexpr auto n_nodes = std::array<std::size_t, n_sizes>{500, 1000, 1500};
+		return {n_nodes.at(size), GraphType::erdos_renyi};
+	}
+};
+
+/** NodeBipartite reusing the static features computed at the root node. */
+struct NodeBipartiteCached : observation::NodeBipartite {
+	NodeBipartiteCached() : observation::NodeBipartite{true} {}
+};
+
+/** Whether the observation function is extracted before solving, rather than on branch-and-bound nodes. */
+template <typename ObservationFunction> constexpr bool before_solving = false;
+template <> constexpr bool before_solving<observation::Hutter2011> = true;
+template <> constexpr bool before_solving<observation::MilpBipartite> = true;
+
+/** Instances are generated once per generator and size, with a fixed seed. */
+template <typename Generator> auto get_instance(std::size_t size) -> scip::Model const& {
+	static auto instances = std::map<std::size_t, scip::Model>{};
+	auto iter = instances.find(size);
+	if (iter == instances.end()) {
+		auto rng = make_random_generator(0, size);
+		auto model = Generator::generate_instance(Sweep<Generator>::parameters(size), rng);
+		model.disable_presolve();
+		model.disable_cuts();
+		iter = instances.emplace(size, std::move(model)).first;
+	}
+	return iter->second;
+}
+
+/**
+ * Benchmark the extraction of an observation on a fixed branch-and-bound state.
+ *
+ * The state is reached by branching on the first candidate variable the given number of times.
+ * Only the calls to extract are timed, and reported per nonzero of the problem.
+ */
+template <typename ObservationFunction, typename Generator> void bench_extract(::benchmark::State& state) {
+	auto const size = static_cast<std::size_t>(state.range(0));
+	auto const depth = state.range(1);
+
+	auto model = get_instance<Generator>(size).copy_orig();
+	auto func = ObservationFunction{};
+	func.before_reset(model);
+	if constexpr (!before_solving<ObservationFunction>) {
+		auto dynamics = dynamics::BranchingDynamics{};
+		auto [done, action_set] = dynamics.reset_dynamics(model);
+		// Root node features are computed (and possibly cached) on the first extraction
+		::benchmark::DoNotOptimize(func.extract(model, done));
+		for (auto i = 0; (i < depth) && !done; ++i) {
+			std::tie(done, action_set) = dynamics.step_dynamics(model, action_set.value()[0]);
+		}
+		if (done) {
+			state.SkipWithError("Instance solved before reaching the branch-and-bound state.");
+			return;
+		}
+	}
+
+	auto const nnz = model.nnz();
+	auto const allocs_before = ecole::benchmark::AllocationStats::now();
+	for (auto _ : state) {
+		auto obs = func.extract(model, false);
+		// Timing an empty observation means the function is not extracted in the right stage
+		if (!obs.has_value()) {
+			state.SkipWithError("Observation function did not extract an observation.");
+			break;
+		}
+		::benchmark::DoNotOptimize(obs);
+	}
+	auto const allocs = ecole::benchmark::AllocationStats::now() - allocs_before;
+
+	using Counter = ::benchmark::Counter;
+	// Inverted rate, that is seconds per nonzero per iteration, displayed as "n" for nanoseconds.
+	state.counters["time/nnz"] =
+		Counter(static_cast<double>(nnz), Counter::kIsIterationInvariantRate | Counter::kInvert);
+	state.counters["nnz"] = static_cast<double>(nnz);
+	state.counters["allocs"] = Counter(static_cast<double>(allocs.n_allocations), Counter::kAvgIterations);
+	state.counters["alloc_bytes"] = Counter(static_cast<double>(allocs.n_bytes), Counter::kAvgIterations);
+}
+
+template <typename ObservationFunction, typename... Generators>
+void register_function(char const* function_name, std::tuple<Generators...> /*generators*/) {
+	auto depths = std::vector<std::int64_t>{0, 10};  // NOLINT(readability-magic-numbers)
+	if (before_solving<ObservationFunction>) {
+		// Functions extracted before solving have no branch-and-bound state
+		depths = {0};
+	}
+
+	(::benchmark::RegisterBenchmark(
+		 fmt::format("{}/{}", function_name, Sweep<Generators>::name).c_str(),
+		 bench_extract<ObservationFunction, Generators>)
+		 ->ArgNames({"size", "depth"})
+		 ->ArgsProduct({{0, 1, 2}, depths})
+		 ->Unit(::benchmark::kMicrosecond),
+	 ...);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	auto const generators = std::tuple<
+		instance::SetCoverGenerator,
+		instance::CombinatorialAuctionGenerator,
+		instance::CapacitatedFacilityLocationGenerator,
+		instance::IndependentSetGenerator>{};
+
+	register_function<observation::NodeBipartite>("NodeBipartite", generators);
+	register_function<NodeBipartiteCached>("NodeBipartiteCached", generators);
+	register_function<observation::MilpBipartite>("MilpBipartite", generators);
+	register_function<observation::Khalil2016>("Khalil2016", generators);
+	register_function<observation::Hutter2011>("Hutter2011", generators);
+	register_function<observation::Pseudocosts>("Pseudocosts", generators);
+	register_function<observation::StrongBranchingScores>("StrongBranchingScores", generators);
+	register_function<observation::Capacity>("Capacity", generators);
+	register_function<observation::Weight>("Weight", generators);
+	register_function<observation::FocusNode>("FocusNode", generators);
+
+	::benchmark::Initialize(&argc, argv);
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+		return 1;
+	}
+	::benchmark::RunSpecifiedBenchmarks();
+}
@@ -42,15 +42,17 @@ auto InstanceFeatures::csv() -> std::string {
 }
 
 auto Metrics::csv_title(std::string_view prefix) -> std::string {
-	return make_csv(
-		fmt::format("{}{}", prefix, "wall_time_s"),
-		fmt::format("{}{}", prefix, "cpu_time_s"),
-		fmt::format("{}{}", prefix, "n_nodes"),
-		fmt::format("{}{}", prefix, "n_lp_iterations"));
+	return merge_csv(
+		make_csv(
+			fmt::format("{}{}", prefix, "wall_time_s"),
+			fmt::format("{}{}", prefix, "cpu_time_s"),
+			fmt::format("{}{}", prefix, "n_nodes"),
+			fmt::format("{}{}", prefix, "n_lp_iterations")),
+		PerfCounts::csv_title(prefix));
 }
 
 auto Metrics::csv() -> std::string {
-	return make_csv(wall_time_s, cpu_time_s, n_nodes, n_lp_iterations);
+	return merge_csv(make_csv(wall_time_s, cpu_time_s, n_nodes, n_lp_iterations), perf_counts.csv());
 }
 
 }  // namespace ecole::benchmark
@@ -5,6 +5,8 @@
 
 #include "ecole/scip/model.hpp"
 
+#include "perf-counters.hpp"
+
 namespace ecole::benchmark {
 
 struct InstanceFeatures {
@@ -26,6 +28,7 @@ struct Metrics {
 	double cpu_time_s = 0.;
 	std::size_t n_nodes = 0;
 	std::size_t n_lp_iterations = 0;
+	PerfCounts perf_counts = {};
 
 	static auto csv_title(std::string_view prefix = "") -> std::string;
 	auto csv() -> std::string;
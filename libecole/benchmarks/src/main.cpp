@@ -13,6 +13,7 @@
 #include "ecole/scip/seed.hpp"
 
 #include "bench-branching.hpp"
+#include "bench-generators.hpp"
 #include "benchmark.hpp"
 
 using namespace ecole::benchmark;
@@ -33,7 +34,7 @@ void seed_model(ecole::scip::Model& model, ecole::RandomGenerator& rng) {
 }
 
 /** The generators used to benchmark branching dynamics. */
-auto benchmark_branching(std::size_t n_instances, std::size_t n_nodes) {
+auto benchmark_branching(std::size_t n_instances, std::size_t n_nodes, bool with_perf_counters) {
 	using GraphType = typename ecole::instance::IndependentSetGenerator::Parameters::GraphType;
 	auto generators = std::tuple{
 		SetCoverGenerator{{500, 1000}},                           // NOLINT(readability-magic-numbers)
@@ -60,7 +61,7 @@ auto benchmark_branching(std::size_t n_instances, std::size_t n_nodes) {
 				model.disable_cuts();
 				model.set_param("limits/totalnodes", n_nodes);
 				seed_model(model, rng);
-				std::cout << benchmark_branching(model).csv() << '\n';
+				std::cout << benchmark_branching(model, with_perf_counters).csv() << '\n';
 			} catch (std::exception const& e) {
 				std::cerr << "Error when benchmarking an instance: " << e.what() << '\n';
 			}
@@ -81,12 +82,22 @@ int main(int argc, char** argv) {
 		app.add_option("--node-limit,--nl", n_nodes, "Limit the number of nodes in each run");
 		auto seed = std::optional<ecole::Seed>{};
 		app.add_option("--seed,-s", seed, "Global Ecole random seed");
+		auto with_perf_counters = false;
+		app.add_flag(
+			"--perf-counters", with_perf_counters, "Capture Linux perf_event counters (cycles, cache misses, etc.)");
+		auto* const generators =
+			app.add_subcommand("generators", "Measure the throughput and memory of instance generators instead");
+		generators->fallthrough();
 		CLI11_PARSE(app, argc, argv);
 
 		if (seed.has_value()) {
 			ecole::seed(seed.value());
 		}
-		benchmark_branching(n_instances, n_nodes);
+		if (*generators) {
+			benchmark_generators(n_instances, std::cout);
+		} else {
+			benchmark_branching(n_instances, n_nodes, with_perf_counters);
+		}
 
 	} catch (std::exception const& e) {
 		std::cerr << "An error occured: " << e.what() << '\n';
@@ -0,0 +1,145 @@
+#include <cstring>
+
+#include <fmt/format.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "csv.hpp"
+#include "perf-counters.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+auto to_csv(std::optional<std::uint64_t> const& count) -> std::string {
+	return count.has_value() ? std::to_string(count.value()) : std::string{};
+}
+
+auto to_json(std::optional<std::uint64_t> const& count) -> std::string {
+	return count.has_value() ? std::to_string(count.value()) : std::string{"null"};
+}
+
+#ifdef __linux__
+
+/** Open a counter disabled, or return -1 if it cannot be opened. */
+auto open_counter(std::uint32_t type, std::uint64_t config) -> int {
+	auto attr = perf_event_attr{};
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.inherit = 1;
+	attr.exclude_hv = 1;
+	// Context switches are only ever counted in the kernel
+	attr.exclude_kernel = (type == PERF_TYPE_HARDWARE) ? 1 : 0;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	// Calling thread, any cpu, no group, no flags
+	return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/** Read a counter, scaled if it was multiplexed, or nothing if it did not run. */
+auto read_counter(int fd) -> std::optional<std::uint64_t> {
+	if (fd < 0) {
+		return {};
+	}
+	// Value, time enabled, and time running
+	auto values = std::array<std::uint64_t, 3>{};
+	if (read(fd, values.data(), sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0) {
+		return {};
+	}
+	if (values[2] == values[1]) {
+		return values[0];
+	}
+	return static_cast<std::uint64_t>(
+		static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]));
+}
+
+#endif
+
+}  // namespace
+
+auto PerfCounts::csv_title(std::string_view prefix) -> std::string {
+	return make_csv(
+		fmt::format("{}{}", prefix, "cycles"),
+		fmt::format("{}{}", prefix, "instructions"),
+		fmt::format("{}{}", prefix, "cache_misses"),
+		fmt::format("{}{}", prefix, "branch_misses"),
+		fmt::format("{}{}", prefix, "context_switches"));
+}
+
+auto PerfCounts::csv() -> std::string {
+	return make_csv(
+		to_csv(cycles), to_csv(instructions), to_csv(cache_misses), to_csv(branch_misses), to_csv(context_switches));
+}
+
+auto PerfCounts::json() const -> std::string {
+	return fmt::format(
+		R"({{"cycles": {}, "instructions": {}, "cache_misses": {}, "branch_misses": {}, "context_switches": {}}})",
+		to_json(cycles),
+		to_json(instructions),
+		to_json(cache_misses),
+		to_json(branch_misses),
+		to_json(context_switches));
+}
+
+#ifdef __linux__
+
+PerfCounters::PerfCounters() :
+	file_descriptors{
+		open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+		open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+		open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+		open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES),
+		open_counter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES),
+	} {}
+
+PerfCounters::~PerfCounters() {
+	for (auto const fd : file_descriptors) {
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+}
+
+auto PerfCounters::start() -> void {
+	for (auto const fd : file_descriptors) {
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+		}
+	}
+}
+
+auto PerfCounters::stop() -> PerfCounts {
+	for (auto const fd : file_descriptors) {
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+		}
+	}
+	return {
+		read_counter(file_descriptors[0]),
+		read_counter(file_descriptors[1]),
+		read_counter(file_descriptors[2]),
+		read_counter(file_descriptors[3]),
+		read_counter(file_descriptors[4]),
+	};
+}
+
+#else
+
+PerfCounters::PerfCounters() : file_descriptors{-1, -1, -1, -1, -1} {}
+PerfCounters::~PerfCounters() = default;
+auto PerfCounters::start() -> void {}
+auto PerfCounters::stop() -> PerfCounts {
+	return {};
+}
+
+#endif
+
+}  // namespace ecole::benchmark
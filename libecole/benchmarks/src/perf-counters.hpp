@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ecole::benchmark {
+
+/** Event counts of a measured region, missing for the counters that could not be opened. */
+struct PerfCounts {
+	std::optional<std::uint64_t> cycles = {};
+	std::optional<std::uint64_t> instructions = {};
+	std::optional<std::uint64_t> cache_misses = {};
+	std::optional<std::uint64_t> branch_misses = {};
+	std::optional<std::uint64_t> context_switches = {};
+
+	static auto csv_title(std::string_view prefix = "") -> std::string;
+	auto csv() -> std::string;
+	/** JSON object, with null for missing counts. */
+	[[nodiscard]] auto json() const -> std::string;
+};
+
+/**
+ * Linux perf_event_open counters of the calling thread and of the threads it creates afterward.
+ *
+ * Child threads, such as the solving thread of the Model coroutine, are counted until they are read.
+ * Hardware counters exclude the kernel so that they can be opened with the default ``perf_event_paranoid``.
+ * Counters that cannot be opened (unsupported platform, virtual machine, permissions) are reported as missing.
+ * When more counters are opened than there are hardware registers, counts are scaled by the kernel multiplexing.
+ */
+class PerfCounters {
+public:
+	PerfCounters();
+	PerfCounters(PerfCounters const&) = delete;
+	PerfCounters(PerfCounters&&) = delete;
+	~PerfCounters();
+
+	auto operator=(PerfCounters const&) -> PerfCounters& = delete;
+	auto operator=(PerfCounters&&) -> PerfCounters& = delete;
+
+	/** Reset and start all counters. */
+	auto start() -> void;
+	/** Stop all counters and read their value. */
+	auto stop() -> PerfCounts;
+
+private:
+	static constexpr std::size_t n_counters = 5;
+	std::array<int, n_counters> file_descriptors;
+};
+
+}  // namespace ecole::benchmark
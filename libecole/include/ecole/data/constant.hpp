@@ -15,6 +15,8 @@ public:
 
 	[[nodiscard]] auto extract(scip::Model const& /* model */, bool /* done */) const -> Data { return data; };
 
+	[[nodiscard]] auto value() const noexcept -> Data const& { return data; }
+
 private:
 	Data data;
 };
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/memory.hpp"
 
 namespace ecole::data {
 
@@ -47,6 +48,15 @@ public:
 	/** Call ``extract`` onto the wrapped item. */
 	auto extract(scip::Model& model, bool done) -> Data { return m_pimpl->extract(model, done); }
 
+	/** Bytes held by the caches of the wrapped item. */
+	[[nodiscard]] auto memory_usage() const -> std::size_t { return m_pimpl->memory_usage(); }
+
+	/** Release the caches of the wrapped item. */
+	auto evict() -> void { m_pimpl->evict(); }
+
+	/** Give the memory of the data functions of the environment to the wrapped item. */
+	auto track_data_functions(std::size_t bytes) -> void { m_pimpl->track_data_functions(bytes); }
+
 private:
 	/**
 	 * Interface expected of a data function.
@@ -58,6 +68,9 @@ private:
 		virtual auto clone() -> std::unique_ptr<DataFunctionAbstract> = 0;
 		virtual auto before_reset(scip::Model& model) -> void = 0;
 		virtual auto extract(scip::Model& model, bool done) -> Data = 0;
+		[[nodiscard]] virtual auto memory_usage() const -> std::size_t = 0;
+		virtual auto evict() -> void = 0;
+		virtual auto track_data_functions(std::size_t bytes) -> void = 0;
 	};
 
 	/**
@@ -72,6 +85,11 @@ private:
 		}
 		auto before_reset(scip::Model& model) -> void override { return m_data_function.before_reset(model); }
 		auto extract(scip::Model& model, bool done) -> Data override { return m_data_function.extract(model, done); }
+		[[nodiscard]] auto memory_usage() const -> std::size_t override { return data::memory_usage(m_data_function); }
+		auto evict() -> void override { data::evict(m_data_function); }
+		auto track_data_functions(std::size_t bytes) -> void override {
+			data::track_data_functions(m_data_function, bytes);
+		}
 
 		DataFunction m_data_function;
 	};
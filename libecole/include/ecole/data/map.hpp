@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/memory.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -35,6 +36,29 @@ public:
 		return data;
 	}
 
+	/** Bytes held by the caches of all functions. */
+	[[nodiscard]] auto memory_usage() const -> std::size_t {
+		auto bytes = std::size_t{0};
+		for (auto const& [_, func] : data_functions) {
+			bytes += data::memory_usage(func);
+		}
+		return bytes;
+	}
+
+	/** Release the caches of all functions. */
+	auto evict() -> void {
+		for (auto& [_, func] : data_functions) {
+			data::evict(func);
+		}
+	}
+
+	/** Give the memory of the data functions of the environment to all functions. */
+	auto track_data_functions(std::size_t bytes) -> void {
+		for (auto& [_, func] : data_functions) {
+			data::track_data_functions(func, bytes);
+		}
+	}
+
 private:
 	std::map<Key, Function> data_functions;
 };
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include <scip/scip.h>
+
+#include "ecole/data/abstract.hpp"
+#include "ecole/data/memory.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/traits.hpp"
+
+namespace ecole::data {
+
+/** The state of the solver for which extracted data can be reused. */
+struct MemoKey {
+	SCIP const* scip = nullptr;
+	SCIP_STAGE stage = SCIP_STAGE_INIT;
+	SCIP_Longint node_number = -1;
+	SCIP_Longint n_lps = 0;
+	bool done = false;
+
+	/** Read the key from the current state of the model. */
+	static auto from(scip::Model& model, bool done) -> MemoKey {
+		auto key = MemoKey{model.get_scip_ptr(), model.stage(), -1, 0, done};
+		switch (key.stage) {
+		case SCIP_STAGE_SOLVING:
+			if (auto* const node = SCIPgetCurrentNode(model.get_scip_ptr()); node != nullptr) {
+				key.node_number = SCIPnodeGetNumber(node);
+			}
+			[[fallthrough]];
+		case SCIP_STAGE_PRESOLVING:
+		case SCIP_STAGE_PRESOLVED:
+		case SCIP_STAGE_SOLVED:
+			key.n_lps = SCIPgetNLPs(model.get_scip_ptr());
+			break;
+		default:
+			break;
+		}
+		return key;
+	}
+
+	[[nodiscard]] auto operator==(MemoKey const& other) const noexcept -> bool {
+		return scip == other.scip && stage == other.stage && node_number == other.node_number &&
+					 n_lps == other.n_lps && done == other.done;
+	}
+	[[nodiscard]] auto operator!=(MemoKey const& other) const noexcept -> bool { return !(*this == other); }
+};
+
+/**
+ * Cache the data extracted by a function on a given node.
+ *
+ * Data is extracted again only when the node number, the number of LPs solved, the stage, or the ``done`` flag
+ * change, and is otherwise shared with previous calls.
+ * Copies of a MemoizedFunction share the same function and cache, so that the same memoized function can be used
+ * in several places, for instance as both an observation and an information function, and extract data once.
+ */
+template <typename Function> class MemoizedFunction {
+public:
+	using Data = trait::data_of_t<Function>;
+
+	MemoizedFunction(Function func = {}) : state{std::make_shared<State>(std::move(func))} {}
+
+	/** Reset the wrapped function and clear the cache. */
+	auto before_reset(scip::Model& model) -> void {
+		auto const lock = std::lock_guard{state->mutex};
+		state->key.reset();
+		state->data.reset();
+		state->func.before_reset(model);
+	}
+
+	/** Return the cached data, extracting it if the model has changed since the last call. */
+	auto extract(scip::Model& model, bool done) -> std::shared_ptr<Data const> {
+		auto const key = MemoKey::from(model, done);
+		auto const lock = std::lock_guard{state->mutex};
+		if (state->key == key) {
+			++state->n_hits;
+			return state->data;
+		}
+		++state->n_misses;
+		state->data = std::make_shared<Data const>(state->func.extract(model, done));
+		state->key = key;
+		return state->data;
+	}
+
+	/** Bytes held by the caches of the wrapped function, the size of the cached data being unknown. */
+	[[nodiscard]] auto memory_usage() const -> std::size_t {
+		auto const lock = std::lock_guard{state->mutex};
+		return data::memory_usage(state->func);
+	}
+
+	/** Clear the cache, and the caches of the wrapped function. */
+	auto evict() -> void {
+		auto const lock = std::lock_guard{state->mutex};
+		state->key.reset();
+		state->data.reset();
+		data::evict(state->func);
+	}
+
+	/** Give the memory of the data functions of the environment to the wrapped function. */
+	auto track_data_functions(std::size_t bytes) -> void {
+		auto const lock = std::lock_guard{state->mutex};
+		data::track_data_functions(state->func, bytes);
+	}
+
+	/** Number of calls to extract served from the cache. */
+	[[nodiscard]] auto hits() const -> std::size_t {
+		auto const lock = std::lock_guard{state->mutex};
+		return state->n_hits;
+	}
+
+	/** Number of calls to extract that extracted data from the wrapped function. */
+	[[nodiscard]] auto misses() const -> std::size_t {
+		auto const lock = std::lock_guard{state->mutex};
+		return state->n_misses;
+	}
+
+private:
+	struct State {
+		Function func;
+		std::optional<MemoKey> key;
+		std::shared_ptr<Data const> data;
+		std::size_t n_hits = 0;
+		std::size_t n_misses = 0;
+		std::mutex mutex;
+
+		State(Function func_) : func{std::move(func_)} {}
+	};
+
+	std::shared_ptr<State> state;
+};
+
+}  // namespace ecole::data
+
+namespace ecole::trait {
+
+template <typename Function>
+struct is_exclusive_function<data::MemoizedFunction<Function>> : is_exclusive_function<Function> {};
+
+}  // namespace ecole::trait
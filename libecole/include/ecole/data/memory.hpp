@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ecole::data {
+
+template <typename, typename = void> struct has_memory_usage : std::false_type {};
+template <typename T>
+struct has_memory_usage<T, std::void_t<decltype(std::declval<T const&>().memory_usage())>> : std::true_type {};
+template <typename T> inline constexpr bool has_memory_usage_v = has_memory_usage<T>::value;
+
+template <typename, typename = void> struct has_evict : std::false_type {};
+template <typename T> struct has_evict<T, std::void_t<decltype(std::declval<T&>().evict())>> : std::true_type {};
+template <typename T> inline constexpr bool has_evict_v = has_evict<T>::value;
+
+template <typename, typename = void> struct has_track_data_functions : std::false_type {};
+template <typename T>
+struct has_track_data_functions<
+	T,
+	std::void_t<decltype(std::declval<T&>().track_data_functions(std::declval<std::size_t>()))>> : std::true_type {};
+template <typename T> inline constexpr bool has_track_data_functions_v = has_track_data_functions<T>::value;
+
+/**
+ * Bytes held by the caches of a data function.
+ *
+ * Data functions report their caches by defining a ``memory_usage`` method, others are assumed to hold none.
+ */
+template <typename Function> auto memory_usage(Function const& function) -> std::size_t {
+	if constexpr (has_memory_usage_v<Function>) {
+		return function.memory_usage();
+	} else {
+		return 0;
+	}
+}
+
+/**
+ * Release the caches of a data function.
+ *
+ * Data functions with caches define an ``evict`` method, after which they must still extract correct data.
+ */
+template <typename Function> auto evict(Function& function) -> void {
+	if constexpr (has_evict_v<Function>) {
+		function.evict();
+	}
+}
+
+/**
+ * Give a data function the bytes held by the caches of the data functions of its environment.
+ *
+ * Data functions reporting memory, such as information::MemoryUsage, define a ``track_data_functions`` method.
+ */
+template <typename Function> auto track_data_functions(Function& function, std::size_t bytes) -> void {
+	if constexpr (has_track_data_functions_v<Function>) {
+		function.track_data_functions(bytes);
+	}
+}
+
+}  // namespace ecole::data
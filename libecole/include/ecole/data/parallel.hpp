@@ -0,0 +1,278 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ecole/data/abstract.hpp"
+#include "ecole/data/dynamic.hpp"
+#include "ecole/data/map.hpp"
+#include "ecole/data/tuple.hpp"
+#include "ecole/data/vector.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/traits.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::data {
+
+namespace internal {
+
+/** Wait for all tasks, then rethrow the first exception, as tasks may refer to the caller stack. */
+inline auto wait_all(std::vector<std::future<void>>& futures) -> void {
+	for (auto& fut : futures) {
+		fut.wait();
+	}
+	for (auto& fut : futures) {
+		fut.get();
+	}
+}
+
+/** Whether tasks can be submitted to the shared pool and waited on from the calling thread. */
+inline auto can_run_parallel() -> bool {
+	return !utility::ThreadPool::in_worker_thread() && utility::ThreadPool::shared().size() > 1;
+}
+
+/** Fill the lazy caches of SCIP before extracting concurrently, so that functions only read the model. */
+inline auto prepare_parallel(scip::Model& model) -> bool {
+	if (!can_run_parallel()) {
+		return false;
+	}
+	model.fill_lazy_caches();
+	return true;
+}
+
+/** Measure the duration of a function call. */
+template <typename Func> auto timed(std::chrono::nanoseconds& latency, Func&& func) {
+	auto const start = std::chrono::steady_clock::now();
+	auto result = std::forward<Func>(func)();
+	latency = std::chrono::steady_clock::now() - start;
+	return result;
+}
+
+}  // namespace internal
+
+/**
+ * Combine multiple data into a tuple, extracting data concurrently.
+ *
+ * Same as TupleFunction, but ``extract`` is run concurrently on the shared thread pool.
+ * Functions marked with ``trait::is_exclusive_function`` are run first, one at a time on the calling thread.
+ * The data that SCIP computes lazily (see scip::Model::fill_lazy_caches) is then computed on the calling thread,
+ * after which the other functions must only read the model, as the built-in observation functions do.
+ * When called from a pool worker (for instance nested inside another parallel function), data is extracted
+ * sequentially to avoid deadlocks.
+ */
+template <typename... Functions> class ParallelTupleFunction {
+public:
+	using DataTuple = std::tuple<trait::data_of_t<Functions>...>;
+
+	/** Default construct all functions. */
+	ParallelTupleFunction() = default;
+
+	/** Store a copy of the functions. */
+	ParallelTupleFunction(Functions... functions) : data_functions{std::move(functions)...} {}
+	ParallelTupleFunction(std::tuple<Functions...> functions) : data_functions{std::move(functions)} {}
+
+	/** Call before_reset on all functions. */
+	auto before_reset(scip::Model& model) -> void {
+		std::apply([&model](auto&... functions) { ((functions.before_reset(model)), ...); }, data_functions);
+	}
+
+	/** Return data from all functions as a tuple. */
+	auto extract(scip::Model& model, bool done) -> DataTuple {
+		return internal::timed(latency, [&] { return extract_impl(model, done, std::index_sequence_for<Functions...>{}); });
+	}
+
+	/** Duration of the last call to extract. */
+	[[nodiscard]] auto last_latency() const noexcept -> std::chrono::nanoseconds { return latency; }
+
+private:
+	std::tuple<Functions...> data_functions;
+	std::chrono::nanoseconds latency = {};
+
+	template <std::size_t... I>
+	auto extract_impl(scip::Model& model, bool done, std::index_sequence<I...> /*indices*/) -> DataTuple {
+		auto results = std::tuple<std::optional<trait::data_of_t<Functions>>...>{};
+		auto const extract_one = [&](auto index) {
+			std::get<index>(results).emplace(std::get<index>(data_functions).extract(model, done));
+		};
+
+		// Exclusive functions first, on the calling thread
+		(
+			[&] {
+				if constexpr (trait::is_exclusive_function_v<Functions>) {
+					extract_one(std::integral_constant<std::size_t, I>{});
+				}
+			}(),
+			...);
+
+		// Other functions concurrently
+		auto const parallel = internal::prepare_parallel(model);
+		auto futures = std::vector<std::future<void>>{};
+		futures.reserve(sizeof...(Functions));
+		(
+			[&] {
+				if constexpr (!trait::is_exclusive_function_v<Functions>) {
+					auto const index = std::integral_constant<std::size_t, I>{};
+					if (parallel) {
+						futures.push_back(utility::ThreadPool::shared().submit([&extract_one, index] { extract_one(index); }));
+					} else {
+						extract_one(index);
+					}
+				}
+			}(),
+			...);
+		internal::wait_all(futures);
+
+		return {std::move(std::get<I>(results)).value()...};
+	}
+};
+
+/**
+ * Combine multiple data into a vector of data, extracting data concurrently.
+ *
+ * Same as VectorFunction, but ``extract`` is run concurrently on the shared thread pool, after filling the lazy
+ * caches of SCIP, unless the function type is marked with ``trait::is_exclusive_function``.
+ */
+template <typename Function> class ParallelVectorFunction {
+public:
+	using DataVector = std::vector<trait::data_of_t<Function>>;
+
+	/** Default construct all functions. */
+	ParallelVectorFunction() = default;
+
+	/** Store a copy of the functions. */
+	ParallelVectorFunction(std::vector<Function> functions) : data_functions{std::move(functions)} {}
+
+	/** Call before_reset on all functions. */
+	auto before_reset(scip::Model& model) -> void {
+		for (auto& func : data_functions) {
+			func.before_reset(model);
+		}
+	}
+
+	/** Return data extracted from all functions as a vector. */
+	auto extract(scip::Model& model, bool done) -> DataVector {
+		return internal::timed(latency, [&] {
+			auto results = std::vector<std::optional<trait::data_of_t<Function>>>(data_functions.size());
+			auto const extract_one = [&](std::size_t i) { results[i].emplace(data_functions[i].extract(model, done)); };
+
+			auto futures = std::vector<std::future<void>>{};
+			if (!trait::is_exclusive_function_v<Function> && internal::prepare_parallel(model)) {
+				futures.reserve(data_functions.size());
+				for (std::size_t i = 0; i < data_functions.size(); ++i) {
+					futures.push_back(utility::ThreadPool::shared().submit([&extract_one, i] { extract_one(i); }));
+				}
+			} else {
+				for (std::size_t i = 0; i < data_functions.size(); ++i) {
+					extract_one(i);
+				}
+			}
+			internal::wait_all(futures);
+
+			auto data = DataVector{};
+			data.reserve(results.size());
+			for (auto& result : results) {
+				data.push_back(std::move(result).value());
+			}
+			return data;
+		});
+	}
+
+	/** Duration of the last call to extract. */
+	[[nodiscard]] auto last_latency() const noexcept -> std::chrono::nanoseconds { return latency; }
+
+private:
+	std::vector<Function> data_functions;
+	std::chrono::nanoseconds latency = {};
+};
+
+/**
+ * Combine multiple data into a map of data, extracting data concurrently.
+ *
+ * Same as MapFunction, but ``extract`` is run concurrently on the shared thread pool, after filling the lazy
+ * caches of SCIP, unless the function type is marked with ``trait::is_exclusive_function``.
+ */
+template <typename Key, typename Function> class ParallelMapFunction {
+public:
+	using DataMap = std::map<Key, trait::data_of_t<Function>>;
+
+	/** Default construct all functions. */
+	ParallelMapFunction() = default;
+
+	/** Store a copy of the functions. */
+	ParallelMapFunction(std::map<Key, Function> functions) : data_functions{std::move(functions)} {}
+
+	/** Call before_reset on all functions. */
+	void before_reset(scip::Model& model) {
+		for (auto& [_, func] : data_functions) {
+			func.before_reset(model);
+		}
+	}
+
+	/** Return data extracted from all functions as a map. */
+	DataMap extract(scip::Model& model, bool done) {
+		return internal::timed(latency, [&] {
+			auto results = std::vector<std::optional<trait::data_of_t<Function>>>(data_functions.size());
+			auto const parallel = !trait::is_exclusive_function_v<Function> && internal::prepare_parallel(model);
+			auto futures = std::vector<std::future<void>>{};
+			auto i = std::size_t{0};
+			for (auto& [_, func] : data_functions) {
+				auto const extract_one = [&result = results[i], &func = func, &model, done] {
+					result.emplace(func.extract(model, done));
+				};
+				if (parallel) {
+					futures.push_back(utility::ThreadPool::shared().submit(extract_one));
+				} else {
+					extract_one();
+				}
+				++i;
+			}
+			internal::wait_all(futures);
+
+			auto data = DataMap{};
+			i = 0;
+			for (auto const& [key, _] : data_functions) {
+				data.emplace_hint(data.end(), key, std::move(results[i++]).value());
+			}
+			return data;
+		});
+	}
+
+	/** Duration of the last call to extract. */
+	[[nodiscard]] auto last_latency() const noexcept -> std::chrono::nanoseconds { return latency; }
+
+private:
+	std::map<Key, Function> data_functions;
+	std::chrono::nanoseconds latency = {};
+};
+
+}  // namespace ecole::data
+
+namespace ecole::trait {
+
+/** Composites are exclusive if any of their functions is. */
+template <typename... Functions>
+struct is_exclusive_function<data::TupleFunction<Functions...>> :
+	std::disjunction<is_exclusive_function<Functions>...> {};
+template <typename... Functions>
+struct is_exclusive_function<data::ParallelTupleFunction<Functions...>> :
+	std::disjunction<is_exclusive_function<Functions>...> {};
+template <typename Function>
+struct is_exclusive_function<data::VectorFunction<Function>> : is_exclusive_function<Function> {};
+template <typename Function>
+struct is_exclusive_function<data::ParallelVectorFunction<Function>> : is_exclusive_function<Function> {};
+template <typename Key, typename Function>
+struct is_exclusive_function<data::MapFunction<Key, Function>> : is_exclusive_function<Function> {};
+template <typename Key, typename Function>
+struct is_exclusive_function<data::ParallelMapFunction<Key, Function>> : is_exclusive_function<Function> {};
+
+/** The wrapped function is unknown, and conservatively assumed to modify the model. */
+template <typename Data> struct is_exclusive_function<data::DynamicFunction<Data>> : std::true_type {};
+
+}  // namespace ecole::trait
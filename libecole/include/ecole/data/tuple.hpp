@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <tuple>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/memory.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -29,6 +31,22 @@ public:
 			[&model, done](auto&... functions) { return std::tuple{functions.extract(model, done)...}; }, data_functions);
 	}
 
+	/** Bytes held by the caches of all functions. */
+	[[nodiscard]] auto memory_usage() const -> std::size_t {
+		return std::apply(
+			[](auto const&... functions) { return (std::size_t{0} + ... + data::memory_usage(functions)); }, data_functions);
+	}
+
+	/** Release the caches of all functions. */
+	auto evict() -> void {
+		std::apply([](auto&... functions) { ((data::evict(functions)), ...); }, data_functions);
+	}
+
+	/** Give the memory of the data functions of the environment to all functions. */
+	auto track_data_functions(std::size_t bytes) -> void {
+		std::apply([bytes](auto&... functions) { ((data::track_data_functions(functions, bytes)), ...); }, data_functions);
+	}
+
 private:
 	std::tuple<Functions...> data_functions;
 };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ecole/dataset/sample.hpp"
+#include "ecole/dataset/writer.hpp"
+#include "ecole/export.hpp"
+
+namespace ecole::dataset {
+
+/**
+ * Random access to the samples of a dataset written by a DatasetWriter.
+ *
+ * Shard files are memory mapped.
+ * Samples of uncompressed chunks are read in place, without copy, while compressed chunks are decompressed
+ * when one of their samples is accessed, keeping the last one in cache.
+ * A chunk that was not completely written, for instance if the writer was interrupted, is ignored.
+ *
+ * Reading samples is thread safe.
+ */
+class ECOLE_EXPORT DatasetReader {
+public:
+	/** Open all shards of a dataset directory, or a single shard file. */
+	ECOLE_EXPORT DatasetReader(std::filesystem::path const& path);
+
+	/** Number of samples in the dataset. */
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return n_samples; }
+	[[nodiscard]] auto schema() const noexcept -> std::vector<ColumnSchema> const& { return the_schema; }
+
+	/** Read a sample, whose columns stay valid as long as the returned owner. */
+	[[nodiscard]] ECOLE_EXPORT auto get(std::size_t index) const -> SampleRef;
+
+private:
+	class Mapping;
+
+	struct ChunkInfo {
+		std::shared_ptr<Mapping const> mapping;
+		std::byte const* payload;
+		std::uint64_t stored_size;
+		std::uint64_t raw_size;
+		Compression compression;
+		std::size_t first_sample;
+		std::size_t n_samples;
+	};
+
+	std::vector<ColumnSchema> the_schema;
+	std::vector<ChunkInfo> chunks;
+	std::size_t n_samples = 0;
+
+	mutable std::mutex cache_mutex;
+	mutable std::size_t cached_chunk = 0;
+	mutable std::shared_ptr<std::vector<std::byte> const> cached_payload;
+
+	auto add_shard(std::filesystem::path const& file) -> void;
+	/** The decompressed payload of a chunk, and the object keeping it alive. */
+	[[nodiscard]] auto payload_of(std::size_t chunk_idx) const
+		-> std::pair<std::byte const*, std::shared_ptr<void const>>;
+};
+
+}  // namespace ecole::dataset
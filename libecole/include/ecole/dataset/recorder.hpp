@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ecole/dataset/sample.hpp"
+#include "ecole/dataset/writer.hpp"
+
+namespace ecole::dataset {
+
+/**
+ * Write the observation, action set, and action of every transition to a dataset.
+ *
+ * The state returned by reset or step is kept until the action taken on it is known, then written as a sample
+ * with the columns ``observation.*``, ``action_set``, and ``action``.
+ * Terminal states, on which no action is taken, are not written.
+ */
+class Recorder {
+public:
+	explicit Recorder(std::shared_ptr<DatasetWriter> writer_) : writer{std::move(writer_)} {}
+
+	/** Keep a copy of a state, replacing the previous one if no action was taken on it. */
+	template <typename Observation, typename ActionSet>
+	auto observe(Observation const& observation, ActionSet const& action_set, bool done) -> void {
+		pending.clear();
+		if (done) {
+			return;
+		}
+		add_columns(pending, "observation", observation);
+		add_columns(pending, "action_set", action_set);
+		// The observation may be moved before the action is known
+		storage.resize(pending.size());
+		for (std::size_t i = 0; i < pending.size(); ++i) {
+			storage[i].assign(pending[i].data.begin(), pending[i].data.end());
+			pending[i].data = {storage[i].data(), storage[i].size()};
+		}
+	}
+
+	/** Write the kept state with the action taken on it. */
+	template <typename Action> auto act(Action const& action) -> void {
+		if (pending.empty()) {
+			return;
+		}
+		add_columns(pending, "action", action);
+		writer->append(pending);
+		pending.clear();
+	}
+
+	[[nodiscard]] auto get_writer() const noexcept -> std::shared_ptr<DatasetWriter> const& { return writer; }
+
+private:
+	std::shared_ptr<DatasetWriter> writer;
+	Sample pending;
+	std::vector<std::vector<std::byte>> storage;
+};
+
+/**
+ * An Environment writing its transitions to a dataset.
+ *
+ * Samples are written by the background thread of the DatasetWriter, the environment only copies the observation
+ * and action set once.
+ */
+template <typename Environment> class RecordingEnvironment : public Environment {
+public:
+	template <typename... Args>
+	RecordingEnvironment(std::shared_ptr<DatasetWriter> writer, Args&&... args) :
+		Environment(std::forward<Args>(args)...), the_recorder{std::move(writer)} {}
+
+	template <typename Instance, typename... Args> auto reset(Instance&& instance, Args&&... args) {
+		auto transition = Environment::reset(std::forward<Instance>(instance), std::forward<Args>(args)...);
+		the_recorder.observe(std::get<0>(transition), std::get<1>(transition), std::get<3>(transition));
+		return transition;
+	}
+
+	/** Transition, writing the previous state only if the transition succeeds. */
+	template <typename... Args> auto step(typename Environment::Action const& action, Args&&... args) {
+		auto transition = Environment::step(action, std::forward<Args>(args)...);
+		the_recorder.act(action);
+		the_recorder.observe(std::get<0>(transition), std::get<1>(transition), std::get<3>(transition));
+		return transition;
+	}
+
+	auto& recorder() { return the_recorder; }
+
+private:
+	Recorder the_recorder;
+};
+
+}  // namespace ecole::dataset
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <nonstd/span.hpp>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/default.hpp"
+#include "ecole/export.hpp"
+#include "ecole/none.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+
+namespace ecole::dataset {
+
+/** Type of the elements of a column, with the kind and size of the Numpy array-interface protocol. */
+struct ECOLE_EXPORT DType {
+	/** One of 'b' (boolean), 'i' (signed integer), 'u' (unsigned integer), or 'f' (floating point). */
+	char kind;
+	std::uint8_t itemsize;
+
+	constexpr auto operator==(DType const& other) const noexcept -> bool {
+		return kind == other.kind && itemsize == other.itemsize;
+	}
+	constexpr auto operator!=(DType const& other) const noexcept -> bool { return !(*this == other); }
+};
+
+template <typename T> constexpr auto dtype_of() noexcept -> DType {
+	static_assert(std::is_arithmetic_v<T>, "Only arithmetic types can be stored in datasets");
+	if constexpr (std::is_same_v<T, bool>) {
+		return {'b', sizeof(T)};
+	} else if constexpr (std::is_floating_point_v<T>) {
+		return {'f', sizeof(T)};
+	} else if constexpr (std::is_signed_v<T>) {
+		return {'i', sizeof(T)};
+	} else {
+		return {'u', sizeof(T)};
+	}
+}
+
+/** Name, element type, and number of dimensions, shared by a column in all samples. */
+struct ECOLE_EXPORT ColumnSchema {
+	std::string name;
+	DType dtype;
+	std::size_t ndim;
+};
+
+/** A view on a named, C-contiguous, array of a sample. */
+struct ECOLE_EXPORT Column {
+	std::string name;
+	DType dtype;
+	std::vector<std::size_t> shape;
+	nonstd::span<std::byte const> data;
+};
+
+/** The columns of a sample, viewing memory owned elsewhere. */
+using Sample = std::vector<Column>;
+
+/** A sample read from a dataset, whose column views are kept valid by the owner. */
+struct ECOLE_EXPORT SampleRef {
+	Sample columns;
+	std::shared_ptr<void const> owner;
+};
+
+/******************************************
+ *  Conversion of Ecole types to columns  *
+ ******************************************/
+
+/**
+ * Add the columns of a value to a sample.
+ *
+ * Nested arrays are named with dotted names, e.g. ``observation.edge_features.values``.
+ * NoneType does not add any column.
+ * Optional values add a boolean ``<name>.has_value`` column, followed by the columns of the value, or of a default
+ * value when empty, so that all samples have the same columns.
+ * The columns view the value, which must outlive them.
+ */
+template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+auto add_columns(Sample& sample, std::string name, T const& value) -> void {
+	auto const* const data = reinterpret_cast<std::byte const*>(&value);
+	sample.push_back({std::move(name), dtype_of<T>(), {}, {data, sizeof(T)}});
+}
+
+template <typename T, std::size_t N>
+auto add_columns(Sample& sample, std::string name, xt::xtensor<T, N> const& tensor) -> void {
+	auto const* const data = reinterpret_cast<std::byte const*>(tensor.data());
+	auto shape = std::vector<std::size_t>(tensor.shape().begin(), tensor.shape().end());
+	sample.push_back({std::move(name), dtype_of<T>(), std::move(shape), {data, tensor.size() * sizeof(T)}});
+}
+
+template <typename T, std::size_t N>
+auto add_columns(Sample& sample, std::string name, std::array<T, N> const& array) -> void {
+	auto const* const data = reinterpret_cast<std::byte const*>(array.data());
+	sample.push_back({std::move(name), dtype_of<T>(), {N}, {data, N * sizeof(T)}});
+}
+
+template <typename T> auto add_columns(Sample& sample, std::string name, nonstd::span<T> span) -> void {
+	auto const* const data = reinterpret_cast<std::byte const*>(span.data());
+	sample.push_back({std::move(name), dtype_of<std::remove_const_t<T>>(), {span.size()}, {data, span.size_bytes()}});
+}
+
+inline auto add_columns(Sample& /*sample*/, std::string const& /*name*/, NoneType /*none*/) -> void {}
+
+inline auto add_columns(Sample& sample, std::string const& name, observation::NodeBipartiteObs const& obs) -> void {
+	add_columns(sample, name + ".variable_features", obs.variable_features);
+	add_columns(sample, name + ".row_features", obs.row_features);
+	add_columns(sample, name + ".edge_features.values", obs.edge_features.values);
+	add_columns(sample, name + ".edge_features.indices", obs.edge_features.indices);
+	add_columns(sample, name + ".edge_features.shape", obs.edge_features.shape);
+}
+
+inline auto add_columns(Sample& sample, std::string const& name, observation::Khalil2016Obs const& obs) -> void {
+	add_columns(sample, name + ".features", obs.features);
+}
+
+/** Whether a type can be converted to columns. */
+template <typename T, typename = void> struct is_recordable : std::false_type {};
+template <typename T>
+struct is_recordable<
+	T,
+	std::void_t<decltype(add_columns(std::declval<Sample&>(), std::declval<std::string>(), std::declval<T const&>()))>>
+	: std::true_type {};
+template <typename T> inline constexpr bool is_recordable_v = is_recordable<T>::value;
+
+template <typename T, std::enable_if_t<is_recordable_v<T>, int> = 0>
+auto add_columns(Sample& sample, std::string name, std::optional<T> const& value) -> void {
+	// Static, as the columns view the values
+	static constexpr auto has_value = std::array{false, true};
+	static auto const empty = T{};
+	add_columns(sample, name + ".has_value", has_value[value.has_value() ? 1 : 0]);
+	add_columns(sample, std::move(name), value.has_value() ? value.value() : empty);
+}
+
+/** Default actions are chosen by SCIP, and cannot be recorded. */
+template <typename T, std::enable_if_t<is_recordable_v<T>, int> = 0>
+auto add_columns(Sample& sample, std::string name, Defaultable<T> const& value) -> void {
+	if (std::holds_alternative<DefaultType>(value)) {
+		throw std::invalid_argument{"Cannot record a Default action."};
+	}
+	add_columns(sample, std::move(name), std::get<T>(value));
+}
+
+}  // namespace ecole::dataset
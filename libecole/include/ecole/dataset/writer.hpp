@@ -0,0 +1,117 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ecole/dataset/sample.hpp"
+#include "ecole/export.hpp"
+
+namespace ecole::dataset {
+
+/** Compression of the chunks of a dataset. */
+enum struct ECOLE_EXPORT Compression { none, zlib };
+
+/** Whether the library was compiled with support for the given compression. */
+ECOLE_EXPORT auto supports(Compression compression) noexcept -> bool;
+
+/**
+ * Append samples to a dataset of shard files, in a directory.
+ *
+ * Samples are grouped in chunks, in which each column of all the samples is stored contiguously.
+ * All samples must have the same columns as the first one, with the same types and number of dimensions.
+ * Full chunks are compressed and written by a background thread, while the next one is filled.
+ * When too many chunks are waiting to be written, appending blocks until one is written.
+ *
+ * Errors of the background thread are thrown by the next call to append, flush, or close.
+ * Append, flush, and close can be called concurrently, for instance by environments sharing a writer.
+ */
+class ECOLE_EXPORT DatasetWriter {
+public:
+	struct ECOLE_EXPORT Parameters {
+		std::size_t samples_per_chunk = 256;        // NOLINT(readability-magic-numbers)
+		std::size_t samples_per_shard = 1U << 16U;  // NOLINT(readability-magic-numbers)
+		Compression compression = Compression::none;
+		int compression_level = 1;
+		std::size_t max_pending_chunks = 4;  // NOLINT(readability-magic-numbers)
+	};
+
+	/** Create the directory if needed, and write new shards, failing if some already exist. */
+	ECOLE_EXPORT DatasetWriter(std::filesystem::path directory, Parameters parameters);
+	ECOLE_EXPORT DatasetWriter(std::filesystem::path directory);
+	DatasetWriter(DatasetWriter const&) = delete;
+	DatasetWriter(DatasetWriter&&) = delete;
+	/** Close the writer, ignoring errors. */
+	ECOLE_EXPORT ~DatasetWriter();
+
+	auto operator=(DatasetWriter const&) -> DatasetWriter& = delete;
+	auto operator=(DatasetWriter&&) -> DatasetWriter& = delete;
+
+	/** Copy a sample in the current chunk. */
+	ECOLE_EXPORT auto append(Sample const& sample) -> void;
+	/** Write the current chunk, even if not full, and wait for all chunks to be written. */
+	ECOLE_EXPORT auto flush() -> void;
+	/** Flush and stop the background thread. No sample can be appended afterward. */
+	ECOLE_EXPORT auto close() -> void;
+
+	[[nodiscard]] auto directory() const noexcept -> std::filesystem::path const& { return the_directory; }
+	[[nodiscard]] auto get_parameters() const noexcept -> Parameters const& { return parameters; }
+	/** Number of samples appended, including the ones not yet written. */
+	[[nodiscard]] auto n_samples() const -> std::size_t {
+		auto const lock = std::lock_guard{writer_mutex};
+		return the_n_samples;
+	}
+	/** The columns of the samples, empty until the first sample is appended, and then constant. */
+	[[nodiscard]] auto schema() const -> std::vector<ColumnSchema> {
+		auto const lock = std::lock_guard{writer_mutex};
+		return the_schema;
+	}
+
+private:
+	/** The values of a column for all samples of a chunk. */
+	struct ChunkColumn {
+		std::vector<std::uint64_t> shapes;
+		std::vector<std::uint64_t> offsets = {0};
+		std::vector<std::byte> data;
+	};
+
+	/** A chunk handed to the background thread. */
+	struct Chunk {
+		std::size_t shard;
+		std::size_t n_samples;
+		std::vector<ChunkColumn> columns;
+	};
+
+	std::filesystem::path the_directory;
+	Parameters parameters;
+	std::vector<ColumnSchema> the_schema;
+	std::size_t the_n_samples = 0;
+	std::size_t samples_in_shard = 0;
+	Chunk chunk;
+	bool closed = false;
+	/** Protect the state above, modified by append, flush, and close. */
+	mutable std::mutex writer_mutex;
+
+	std::thread io_thread;
+	std::mutex queue_mutex;
+	std::condition_variable queue_changed;
+	std::deque<Chunk> queue;
+	bool writing = false;
+	bool stopping = false;
+	std::exception_ptr io_error;
+
+	auto flush_locked() -> void;
+	auto push_chunk() -> void;
+	[[nodiscard]] auto encode(Chunk const& chunk) const -> std::vector<std::byte>;
+	auto rethrow_io_error() -> void;
+	auto write_chunks() -> void;
+};
+
+}  // namespace ecole::dataset
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::dynamics {
+
+/**
+ * A native branching policy made of an observation function and a scoring function.
+ *
+ * At every decision, the observation is extracted and given to the scoring function along with the branching
+ * candidates.
+ * The scoring function returns one score per candidate and the candidate with the highest score is branched on.
+ * The policy is meant to be used with ``BranchingDynamics::solve_with_policy``.
+ *
+ * @tparam ObservationFunction A data function extracting the policy input.
+ * @tparam ScoringFunction A callable taking the observation and the action set, and returning a range of scores.
+ */
+template <typename ObservationFunction, typename ScoringFunction> class ScoringPolicy {
+public:
+	ScoringPolicy(ObservationFunction observation_function_ = {}, ScoringFunction scoring_function_ = {}) :
+		observation_function{std::move(observation_function_)}, scoring_function{std::move(scoring_function_)} {}
+
+	/** Reset the observation function, must be called before solving. */
+	auto before_reset(scip::Model& model) -> void { observation_function.before_reset(model); }
+
+	/** Select the candidate with the highest score. */
+	auto operator()(scip::Model& model, xt::xtensor<std::size_t, 1> const& action_set) -> BranchingDynamics::Action {
+		auto const scores = scoring_function(observation_function.extract(model, false), action_set);
+		auto const n_scores = static_cast<std::size_t>(std::distance(std::begin(scores), std::end(scores)));
+		if (n_scores != action_set.size()) {
+			throw std::invalid_argument{"Scoring function must return one score per branching candidate."};
+		}
+		auto const best = std::max_element(std::begin(scores), std::end(scores));
+		return action_set[static_cast<std::size_t>(std::distance(std::begin(scores), best))];
+	}
+
+private:
+	ObservationFunction observation_function;
+	ScoringFunction scoring_function;
+};
+
+}  // namespace ecole::dynamics
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <optional>
 
 #include <xtensor/xtensor.hpp>
@@ -11,10 +12,25 @@
 
 namespace ecole::dynamics {
 
+/** Latency statistics of the decisions taken by a native policy. */
+struct ECOLE_EXPORT PolicyStatistics {
+	/** Number of branching decisions taken. */
+	std::size_t n_decisions = 0;
+	/** Total wall time spent taking decisions, in seconds. */
+	double total_time = 0.;
+	/** Largest wall time spent on a single decision, in seconds. */
+	double max_time = 0.;
+
+	/** Average wall time spent on a decision, in seconds. */
+	[[nodiscard]] ECOLE_EXPORT auto mean_time() const noexcept -> double;
+};
+
 class ECOLE_EXPORT BranchingDynamics : public DefaultSetDynamicsRandomState {
 public:
 	using Action = Defaultable<std::size_t>;
 	using ActionSet = std::optional<xt::xtensor<std::size_t, 1>>;
+	/** A native policy mapping the current model and branching candidates to an action. */
+	using Policy = std::function<Action(scip::Model&, xt::xtensor<std::size_t, 1> const&)>;
 
 	using DefaultSetDynamicsRandomState::set_dynamics_random_state;
 
@@ -24,6 +40,17 @@ public:
 
 	ECOLE_EXPORT auto step_dynamics(scip::Model& model, Action maybe_var_idx) const -> std::tuple<bool, ActionSet>;
 
+	/**
+	 * Solve the model, branching with a native policy.
+	 *
+	 * The policy is called directly inside the branchrule on the solver thread, so the whole solve completes without
+	 * giving control back to the caller.
+	 * Stateful policies (such as a ScoringPolicy) can be passed with ``std::ref``.
+	 *
+	 * @return Latency statistics of the decisions taken by the policy.
+	 */
+	ECOLE_EXPORT auto solve_with_policy(scip::Model& model, Policy policy) const -> PolicyStatistics;
+
 private:
 	bool pseudo_candidates;
 };
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "ecole/dynamics/parts.hpp"
 #include "ecole/export.hpp"
@@ -15,6 +18,28 @@ namespace ecole::dynamics {
  */
 using ParamDict = std::map<std::string, scip::Param>;
 
+/** Metrics of a configuration solved during a race. */
+struct ECOLE_EXPORT RaceMetrics {
+	/** Whether the configuration solved the instance to optimality (or infeasibility). */
+	bool is_solved = false;
+	/** Whether the configuration was stopped because another one won the race, or dominated it. */
+	bool interrupted = false;
+	double solving_time = 0.;
+	double primal_bound = std::numeric_limits<double>::quiet_NaN();
+	double dual_bound = std::numeric_limits<double>::quiet_NaN();
+	double gap = std::numeric_limits<double>::quiet_NaN();
+	long long n_nodes = 0;
+	long long n_lp_iterations = 0;
+};
+
+/** Outcome of a race between configurations. */
+struct ECOLE_EXPORT RaceResult {
+	/** Index of the best configuration. */
+	std::size_t winner = 0;
+	/** Metrics of every configuration, in the order they were given. */
+	std::vector<RaceMetrics> metrics;
+};
+
 class ECOLE_EXPORT ConfiguringDynamics : public DefaultSetDynamicsRandomState {
 public:
 	using Action = ParamDict;
@@ -25,6 +50,28 @@ public:
 	ECOLE_EXPORT auto reset_dynamics(scip::Model& model) const -> std::tuple<bool, ActionSet>;
 
 	ECOLE_EXPORT auto step_dynamics(scip::Model& model, Action const& param_dict) const -> std::tuple<bool, ActionSet>;
+
+	/**
+	 * Solve the problem concurrently with multiple configurations.
+	 *
+	 * Every configuration solves its own copy of the original problem, starting from the parameters of the given model.
+	 * Copies are solved on the shared thread pool.
+	 * After every node, configurations publish their primal and dual bounds.
+	 * A configuration that solved at least 100 nodes is dominated, and interrupted (``SCIPinterruptSolve``), when
+	 * another has both bounds at least as tight and a gap less than half of its own.
+	 * Once a configuration has solved the instance, all others are interrupted at their next node.
+	 * The winner is the first configuration to solve the instance, or the one with the smallest gap if none does (for
+	 * instance when limits are set).
+	 * The given model is left unchanged.
+	 *
+	 * @param model The problem to solve, in problem stage.
+	 * @param configurations The candidate parameters.
+	 * @param n_threads The number of configurations solved simultaneously, or the size of the shared thread pool if zero.
+	 */
+	ECOLE_EXPORT auto race(
+		scip::Model const& model,
+		std::vector<ParamDict> const& configurations,
+		std::size_t n_threads = 0) const -> RaceResult;
 };
 
 }  // namespace ecole::dynamics
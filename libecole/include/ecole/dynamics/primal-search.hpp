@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <nonstd/span.hpp>
 #include <scip/def.h>
@@ -14,6 +17,16 @@
 
 namespace ecole::dynamics {
 
+/** Outcome of a single partial solution evaluated in probing mode. */
+struct ECOLE_EXPORT PrimalSearchTrial {
+	/** Whether the probing LP was solved without error nor cutoff. */
+	bool lp_solved = false;
+	/** Whether the completed solution was feasible and stored by SCIP. */
+	bool solution_kept = false;
+	/** Objective value of the probing LP in the original problem, NaN if the LP was not solved. */
+	SCIP_Real objective = std::numeric_limits<SCIP_Real>::quiet_NaN();
+};
+
 class ECOLE_EXPORT PrimalSearchDynamics : public DefaultSetDynamicsRandomState {
 public:
 	/** An array of variable identifiers in the transformed problem. */
@@ -30,6 +43,16 @@ public:
 
 	ECOLE_EXPORT auto step_dynamics(scip::Model& model, Action action) -> std::tuple<bool, ActionSet>;
 
+	/**
+	 * Evaluate many partial solutions in a single step.
+	 *
+	 * All candidates are tried in the same probing session, backtracking to the probing root between them so that
+	 * the LP warm start is reused.
+	 * The whole batch counts as a single trial.
+	 */
+	ECOLE_EXPORT auto step_batch_dynamics(scip::Model& model, std::vector<Action> const& actions)
+		-> std::tuple<bool, ActionSet, std::vector<PrimalSearchTrial>>;
+
 private:
 	int trials_per_node;
 	int depth_freq;
@@ -38,6 +61,9 @@ private:
 
 	unsigned int trials_spent = 0;        // to keep track of the number of trials during each search
 	SCIP_RESULT result = SCIP_DIDNOTRUN;  // the final result of each search (several trials)
+
+	/** Record the trial outcome and continue solving if all trials have been spent. */
+	auto end_trial(scip::Model& model, bool solution_kept) -> std::tuple<bool, ActionSet>;
 };
 
 }  // namespace ecole::dynamics
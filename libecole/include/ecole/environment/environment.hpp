@@ -1,18 +1,24 @@
 #pragma once
 
+#include <cstddef>
 #include <map>
 #include <random>
 #include <tuple>
 #include <type_traits>
 
+#include "ecole/data/memory.hpp"
 #include "ecole/data/parser.hpp"
 #include "ecole/exception.hpp"
 #include "ecole/information/abstract.hpp"
+#include "ecole/information/memory.hpp"
 #include "ecole/random.hpp"
 #include "ecole/reward/abstract.hpp"
+#include "ecole/scip/exception.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/seed.hpp"
 #include "ecole/traits.hpp"
+#include "ecole/utility/metrics.hpp"
+#include "ecole/utility/tracing.hpp"
 
 #include <optional>
 
@@ -72,6 +78,26 @@ public:
 		the_scip_params(std::move(scip_params)),
 		the_rng(spawn_random_generator()) {}
 
+	/**
+	 * Fully customize environment, using the given random generator.
+	 *
+	 * Unlike other constructors, this does not advance Ecole's global source of randomness.
+	 */
+	template <typename... Args>
+	Environment(
+		RandomGenerator rng,
+		ObservationFunction observation_function,
+		RewardFunction reward_function,
+		InformationFunction information_function,
+		std::map<std::string, scip::Param> scip_params,
+		Args&&... args) :
+		the_dynamics(std::forward<Args>(args)...),
+		the_reward_function(data::parse(std::move(reward_function))),
+		the_observation_function(data::parse(std::move(observation_function))),
+		the_information_function(data::parse(std::move(information_function))),
+		the_scip_params(std::move(scip_params)),
+		the_rng(std::move(rng)) {}
+
 	/**
 	 * Set the random seed for the environment, hence making its internals deterministic.
 	 *
@@ -103,24 +129,34 @@ public:
 	template <typename... Args>
 	auto reset(scip::Model&& new_model, Args&&... args)
 		-> std::tuple<OptionalObservation, ActionSet, Reward, bool, InformationMap> {
+		ECOLE_TRACE_SPAN("Environment::reset", "environment");
+		auto const timer = utility::metrics::Timer{reset_seconds()};
 		can_transition = true;
 		try {
 			// Create clean new Model
 			model() = std::move(new_model);
 			model().set_params(scip_params());
+			if (memory_limit().has_value()) {
+				model().set_param("limits/memory", static_cast<double>(memory_limit().value()) / bytes_per_megabyte);
+			}
 			dynamics().set_dynamics_random_state(model(), rng());
 
 			// Reset data extraction function and bring model to initial state.
-			reward_function().before_reset(model());
-			observation_function().before_reset(model());
-			information_function().before_reset(model());
+			{
+				ECOLE_TRACE_SPAN("Environment::before_reset", "data");
+				reward_function().before_reset(model());
+				observation_function().before_reset(model());
+				information_function().before_reset(model());
+			}
 
 			// Place the environment in its initial state
 			auto [done, action_set] = dynamics().reset_dynamics(model(), std::forward<Args>(args)...);
 			can_transition = !done;
+			count_done(done);
 
 			// Extract additional information to be returned by reset
 			auto [reward, observation, information] = extract_reward_observation_information(done);
+			enforce_memory_limit();
 
 			return {
 				std::move(observation),
@@ -129,8 +165,9 @@ public:
 				done,
 				std::move(information),
 			};
-		} catch (std::exception const&) {
+		} catch (std::exception const& error) {
 			can_transition = false;
+			count_exception(error);
 			throw;
 		}
 	}
@@ -167,15 +204,21 @@ public:
 	auto step(Action const& action, Args&&... args)
 		-> std::tuple<OptionalObservation, ActionSet, Reward, bool, InformationMap> {
 		if (!can_transition) {
-			throw MarkovError{"Environment need to be reset."};
+			auto error = MarkovError{"Environment need to be reset."};
+			count_exception(error);
+			throw error;
 		}
+		ECOLE_TRACE_SPAN("Environment::step", "environment");
+		auto const timer = utility::metrics::Timer{step_seconds()};
 		try {
 			// Transition the environment to the next state
 			auto [done, action_set] = dynamics().step_dynamics(model(), action, std::forward<Args>(args)...);
 			can_transition = !done;
+			count_done(done);
 
 			// Extract additional information to be returned by step
 			auto [reward, observation, information] = extract_reward_observation_information(done);
+			enforce_memory_limit();
 
 			return {
 				std::move(observation),
@@ -184,8 +227,9 @@ public:
 				done,
 				std::move(information),
 			};
-		} catch (std::exception const&) {
+		} catch (std::exception const& error) {
 			can_transition = false;
+			count_exception(error);
 			throw;
 		}
 	}
@@ -198,6 +242,19 @@ public:
 	auto& scip_params() { return the_scip_params; }
 	auto& rng() { return the_rng; }
 
+	/**
+	 * Soft limit on the memory of the Model and data functions, in bytes.
+	 *
+	 * When set, it is given to SCIP as ``limits/memory`` at every reset, which stops solving (ending the episode)
+	 * past the limit, and the caches of data functions are evicted after any transition exceeding it.
+	 */
+	auto& memory_limit() { return the_memory_limit; }
+
+	/** Memory held by the current Model and by the caches of the data functions. */
+	auto memory_usage() -> information::MemoryReport {
+		return information::MemoryReport::of(model(), data_functions_memory());
+	}
+
 private:
 	Dynamics the_dynamics;
 	scip::Model the_model;
@@ -206,14 +263,80 @@ private:
 	InformationFunction the_information_function;
 	std::map<std::string, scip::Param> the_scip_params;
 	RandomGenerator the_rng;
+	std::optional<std::size_t> the_memory_limit;
 	bool can_transition = false;
 
+	static constexpr double bytes_per_megabyte = 1024. * 1024.;
+
+	auto data_functions_memory() const -> std::size_t {
+		return data::memory_usage(the_reward_function) + data::memory_usage(the_observation_function) +
+					 data::memory_usage(the_information_function);
+	}
+
+	// Metrics are shared by all environment types, having the same names
+	static auto reset_seconds() -> utility::metrics::Histogram const& {
+		static auto const histogram = utility::metrics::Histogram{"ecole_environment_reset_seconds", "Duration of resets."};
+		return histogram;
+	}
+
+	static auto step_seconds() -> utility::metrics::Histogram const& {
+		static auto const histogram = utility::metrics::Histogram{"ecole_environment_step_seconds", "Duration of steps."};
+		return histogram;
+	}
+
+	static auto count_done(bool done) -> void {
+		static auto const episodes = utility::metrics::Counter{"ecole_environment_episodes_total", "Finished episodes."};
+		if (done) {
+			episodes.increment();
+		}
+	}
+
+	static auto count_exception(std::exception const& error) -> void {
+		static auto const exceptions_help = "Exceptions raised by resets and steps.";
+		static auto const scip_errors =
+			utility::metrics::Counter{"ecole_environment_exceptions_total", exceptions_help, {{"type", "ScipError"}}};
+		static auto const markov_errors =
+			utility::metrics::Counter{"ecole_environment_exceptions_total", exceptions_help, {{"type", "MarkovError"}}};
+		static auto const other_errors =
+			utility::metrics::Counter{"ecole_environment_exceptions_total", exceptions_help, {{"type", "other"}}};
+		if (dynamic_cast<scip::ScipError const*>(&error) != nullptr) {
+			scip_errors.increment();
+		} else if (dynamic_cast<MarkovError const*>(&error) != nullptr) {
+			markov_errors.increment();
+		} else {
+			other_errors.increment();
+		}
+	}
+
+	auto enforce_memory_limit() -> void {
+		if (memory_limit().has_value() && (memory_usage().total() > memory_limit().value())) {
+			data::evict(reward_function());
+			data::evict(observation_function());
+			data::evict(information_function());
+		}
+	}
+
 	// extract reward, observation and information (in that order)
 	auto extract_reward_observation_information(bool done) -> std::tuple<Reward, OptionalObservation, InformationMap> {
-		auto reward = reward_function().extract(model(), done);
+		auto reward = [&] {
+			ECOLE_TRACE_SPAN("RewardFunction::extract", "data");
+			return reward_function().extract(model(), done);
+		}();
 		// Don't extract observations in final states
-		auto observation = done ? OptionalObservation{} : observation_function().extract(model(), done);
-		auto information = information_function().extract(model(), done);
+		auto observation = [&]() -> OptionalObservation {
+			if (done) {
+				return {};
+			}
+			ECOLE_TRACE_SPAN("ObservationFunction::extract", "data");
+			return observation_function().extract(model(), done);
+		}();
+		auto information = [&] {
+			ECOLE_TRACE_SPAN("InformationFunction::extract", "data");
+			if constexpr (data::has_track_data_functions_v<InformationFunction>) {
+				data::track_data_functions(information_function(), data_functions_memory());
+			}
+			return information_function().extract(model(), done);
+		}();
 
 		return {std::move(reward), std::move(observation), std::move(information)};
 	}
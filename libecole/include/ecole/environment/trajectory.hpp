@@ -0,0 +1,328 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <nonstd/span.hpp>
+
+#include "ecole/default.hpp"
+#include "ecole/export.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole::environment {
+
+/**
+ * An action owning its data, as kept in a Trajectory.
+ *
+ * Actions that are views, such as the spans of the PrimalSearchDynamics, are copied in vectors.
+ */
+template <typename Action> struct StoredAction {
+	using type = Action;
+	static auto store(Action const& action) -> type { return action; }
+	static auto view(type const& action) -> Action const& { return action; }
+};
+
+template <typename Index, typename Value>
+struct StoredAction<std::pair<nonstd::span<Index const>, nonstd::span<Value const>>> {
+	using Action = std::pair<nonstd::span<Index const>, nonstd::span<Value const>>;
+	using type = std::pair<std::vector<Index>, std::vector<Value>>;
+	static auto store(Action const& action) -> type {
+		return {{action.first.begin(), action.first.end()}, {action.second.begin(), action.second.end()}};
+	}
+	static auto view(type const& action) -> Action {
+		return {{action.first.data(), action.first.size()}, {action.second.data(), action.second.size()}};
+	}
+};
+
+template <typename Action> using stored_action_t = typename StoredAction<Action>::type;
+
+/**
+ * Everything needed to replay an episode without the agent.
+ *
+ * The dynamics are seeded from the random generator state and the SCIP parameters at the start of the episode, so
+ * that taking the same actions on the same instance gives the same transitions.
+ * This does not hold if the episode depends on time, such as with a SCIP time limit.
+ */
+template <typename Action> struct Trajectory {
+	/** Path of the instance file, if the episode was reset from one. */
+	std::string instance;
+	/** Fingerprint of the instance, to check that an episode is replayed on the same one. */
+	std::uint64_t fingerprint = 0;
+	/** State of the random generator of the environment before the reset, as given by ecole::serialize. */
+	std::string random_state;
+	std::map<std::string, scip::Param> scip_params;
+	/** Memory limit of the environment, which also sets a SCIP parameter. */
+	std::optional<std::size_t> memory_limit;
+	std::vector<stored_action_t<Action>> actions;
+};
+
+/** Hash of the original problem of a Model, written in the CIP format. */
+ECOLE_EXPORT auto fingerprint(scip::Model const& model) -> std::uint64_t;
+
+namespace internal {
+
+/** Identify the binary format of trajectories. */
+inline constexpr auto trajectory_magic = std::string_view{"ECOLETRJ"};
+inline constexpr std::uint32_t trajectory_version = 1;
+
+template <typename T> struct is_vector : std::false_type {};
+template <typename T> struct is_vector<std::vector<T>> : std::true_type {};
+template <typename T> struct is_map : std::false_type {};
+template <typename K, typename V> struct is_map<std::map<K, V>> : std::true_type {};
+template <typename T> struct is_pair : std::false_type {};
+template <typename A, typename B> struct is_pair<std::pair<A, B>> : std::true_type {};
+template <typename T> struct is_variant : std::false_type {};
+template <typename... Ts> struct is_variant<std::variant<Ts...>> : std::true_type {};
+template <typename T> struct is_optional : std::false_type {};
+template <typename T> struct is_optional<std::optional<T>> : std::true_type {};
+
+inline auto read_bytes(std::istream& in, void* data, std::size_t size) -> void {
+	if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+		throw std::runtime_error{"Truncated trajectory."};
+	}
+}
+
+/** Write a value in the native byte order, with sizes as 64 bits integers. */
+template <typename T> auto write_value(std::ostream& out, T const& value) -> void {
+	if constexpr (std::is_arithmetic_v<T>) {
+		out.write(reinterpret_cast<char const*>(&value), sizeof(T));  // NOLINT
+	} else if constexpr (std::is_same_v<T, DefaultType>) {
+		// Nothing to write
+	} else if constexpr (std::is_same_v<T, std::string>) {
+		write_value(out, static_cast<std::uint64_t>(value.size()));
+		out.write(value.data(), static_cast<std::streamsize>(value.size()));
+	} else if constexpr (is_vector<T>::value || is_map<T>::value) {
+		write_value(out, static_cast<std::uint64_t>(value.size()));
+		for (auto const& item : value) {
+			write_value(out, item);
+		}
+	} else if constexpr (is_pair<T>::value) {
+		write_value(out, value.first);
+		write_value(out, value.second);
+	} else if constexpr (is_variant<T>::value) {
+		write_value(out, static_cast<std::uint8_t>(value.index()));
+		std::visit([&out](auto const& item) { write_value(out, item); }, value);
+	} else if constexpr (is_optional<T>::value) {
+		write_value(out, static_cast<std::uint8_t>(value.has_value()));
+		if (value.has_value()) {
+			write_value(out, value.value());
+		}
+	} else {
+		static_assert(!sizeof(T), "Values of this type cannot be written in a trajectory.");
+	}
+}
+
+template <typename T> auto read_value(std::istream& in) -> T;
+
+/** Read the alternative of a variant of the given index. */
+template <typename Variant, std::size_t... I>
+auto read_variant(std::istream& in, std::size_t index, std::index_sequence<I...> /*indices*/) -> Variant {
+	auto value = std::optional<Variant>{};
+	auto const read_alternative = [&](auto alternative_index) {
+		constexpr auto i = decltype(alternative_index)::value;
+		value.emplace(std::in_place_index<i>, read_value<std::variant_alternative_t<i, Variant>>(in));
+		return true;
+	};
+	((index == I && read_alternative(std::integral_constant<std::size_t, I>{})) || ...);
+	if (!value.has_value()) {
+		throw std::runtime_error{"Invalid variant index in trajectory."};
+	}
+	return std::move(value).value();
+}
+
+template <typename T> auto read_value(std::istream& in) -> T {
+	if constexpr (std::is_arithmetic_v<T>) {
+		auto value = T{};
+		read_bytes(in, &value, sizeof(T));
+		return value;
+	} else if constexpr (std::is_same_v<T, DefaultType>) {
+		return Default;
+	} else if constexpr (std::is_same_v<T, std::string>) {
+		auto value = std::string(read_value<std::uint64_t>(in), '\0');
+		read_bytes(in, value.data(), value.size());
+		return value;
+	} else if constexpr (is_vector<T>::value) {
+		auto const size = read_value<std::uint64_t>(in);
+		auto value = T{};
+		for (std::uint64_t i = 0; i < size; ++i) {
+			value.push_back(read_value<typename T::value_type>(in));
+		}
+		return value;
+	} else if constexpr (is_map<T>::value) {
+		auto const size = read_value<std::uint64_t>(in);
+		auto value = T{};
+		for (std::uint64_t i = 0; i < size; ++i) {
+			auto item = read_value<std::pair<typename T::key_type, typename T::mapped_type>>(in);
+			value.insert(std::move(item));
+		}
+		return value;
+	} else if constexpr (is_pair<T>::value) {
+		auto first = read_value<typename T::first_type>(in);
+		auto second = read_value<typename T::second_type>(in);
+		return {std::move(first), std::move(second)};
+	} else if constexpr (is_variant<T>::value) {
+		auto const index = read_value<std::uint8_t>(in);
+		return read_variant<T>(in, index, std::make_index_sequence<std::variant_size_v<T>>{});
+	} else if constexpr (is_optional<T>::value) {
+		if (read_value<std::uint8_t>(in) == 0) {
+			return std::nullopt;
+		}
+		return read_value<typename T::value_type>(in);
+	} else {
+		static_assert(!sizeof(T), "Values of this type cannot be read from a trajectory.");
+	}
+}
+
+}  // namespace internal
+
+/** Write a trajectory in a compact binary format. */
+template <typename Action> auto write_trajectory(std::ostream& out, Trajectory<Action> const& trajectory) -> void {
+	out.write(internal::trajectory_magic.data(), static_cast<std::streamsize>(internal::trajectory_magic.size()));
+	internal::write_value(out, internal::trajectory_version);
+	internal::write_value(out, trajectory.instance);
+	internal::write_value(out, trajectory.fingerprint);
+	internal::write_value(out, trajectory.random_state);
+	internal::write_value(out, trajectory.scip_params);
+	internal::write_value(out, trajectory.memory_limit);
+	internal::write_value(out, trajectory.actions);
+	if (!out) {
+		throw std::runtime_error{"Could not write trajectory."};
+	}
+}
+
+/** Read a trajectory written by write_trajectory for the same action type. */
+template <typename Action> auto read_trajectory(std::istream& in) -> Trajectory<Action> {
+	auto magic = std::string(internal::trajectory_magic.size(), '\0');
+	internal::read_bytes(in, magic.data(), magic.size());
+	if (magic != internal::trajectory_magic) {
+		throw std::runtime_error{"Not an Ecole trajectory."};
+	}
+	if (auto const version = internal::read_value<std::uint32_t>(in); version != internal::trajectory_version) {
+		throw std::runtime_error{"Unsupported trajectory version " + std::to_string(version) + "."};
+	}
+	auto trajectory = Trajectory<Action>{};
+	trajectory.instance = internal::read_value<std::string>(in);
+	trajectory.fingerprint = internal::read_value<std::uint64_t>(in);
+	trajectory.random_state = internal::read_value<std::string>(in);
+	trajectory.scip_params = internal::read_value<std::map<std::string, scip::Param>>(in);
+	trajectory.memory_limit = internal::read_value<std::optional<std::size_t>>(in);
+	trajectory.actions = internal::read_value<std::vector<stored_action_t<Action>>>(in);
+	return trajectory;
+}
+
+/** Keep the trajectory of the current episode of an environment. */
+template <typename Action> class TrajectoryRecorder {
+public:
+	/** Start a new trajectory, with the state of the environment before the reset. */
+	auto reset(
+		scip::Model const& instance,
+		std::string instance_path,
+		RandomGenerator const& rng,
+		std::map<std::string, scip::Param> const& scip_params,
+		std::optional<std::size_t> memory_limit) -> void {
+		the_trajectory = {std::move(instance_path), fingerprint(instance), serialize(rng), scip_params, memory_limit, {}};
+	}
+
+	/** Add an action, once the environment successfully transitioned with it. */
+	auto act(Action const& action) -> void { the_trajectory.actions.push_back(StoredAction<Action>::store(action)); }
+
+	[[nodiscard]] auto trajectory() const noexcept -> Trajectory<Action> const& { return the_trajectory; }
+
+private:
+	Trajectory<Action> the_trajectory;
+};
+
+/**
+ * An Environment keeping the trajectory of its current episode.
+ *
+ * Only transitions without additional dynamics arguments are recorded, as they are not replayed.
+ */
+template <typename Environment> class TrajectoryRecordingEnvironment : public Environment {
+public:
+	using Action = typename Environment::Action;
+
+	using Environment::Environment;
+
+	auto reset(scip::Model const& instance) {
+		the_recorder.reset(instance, "", this->rng(), this->scip_params(), this->memory_limit());
+		return Environment::reset(instance);
+	}
+
+	auto reset(std::string const& filename) {
+		auto instance = scip::Model::from_file(filename);
+		the_recorder.reset(instance, filename, this->rng(), this->scip_params(), this->memory_limit());
+		return Environment::reset(std::move(instance));
+	}
+
+	/** Transition, keeping the action only if the transition succeeds. */
+	auto step(Action const& action) {
+		auto transition = Environment::step(action);
+		the_recorder.act(action);
+		return transition;
+	}
+
+	[[nodiscard]] auto trajectory() const noexcept -> Trajectory<Action> const& { return the_recorder.trajectory(); }
+
+private:
+	TrajectoryRecorder<Action> the_recorder;
+};
+
+/**
+ * Replay a trajectory on an environment, calling a function with every transition.
+ *
+ * The environment can extract different observations, rewards, and information than the one that recorded the
+ * trajectory, but must have the same dynamics.
+ * The function is called with the tuple returned by reset, then by every step.
+ *
+ * @throw std::invalid_argument if the instance does not have the fingerprint of the trajectory.
+ * @throw std::runtime_error if the episode ends before all actions are replayed.
+ */
+template <typename Environment, typename Action, typename Function>
+auto replay(Environment& env, Trajectory<Action> const& trajectory, scip::Model const& instance, Function&& func)
+	-> void {
+	if (fingerprint(instance) != trajectory.fingerprint) {
+		throw std::invalid_argument{"The instance is not the one of the trajectory."};
+	}
+	env.rng() = deserialize(trajectory.random_state);
+	env.scip_params() = trajectory.scip_params;
+	env.memory_limit() = trajectory.memory_limit;
+	auto done = false;
+	{
+		auto transition = env.reset(instance);
+		done = std::get<3>(transition);
+		func(std::move(transition));
+	}
+	for (auto const& action : trajectory.actions) {
+		if (done) {
+			throw std::runtime_error{"The replayed episode ended before the end of the trajectory."};
+		}
+		auto transition = env.step(StoredAction<Action>::view(action));
+		done = std::get<3>(transition);
+		func(std::move(transition));
+	}
+}
+
+/** Replay a trajectory on the instance file it was recorded from. */
+template <typename Environment, typename Action, typename Function>
+auto replay(Environment& env, Trajectory<Action> const& trajectory, Function&& func) -> void {
+	if (trajectory.instance.empty()) {
+		throw std::invalid_argument{"The trajectory was not recorded from an instance file."};
+	}
+	replay(env, trajectory, scip::Model::from_file(trajectory.instance), std::forward<Function>(func));
+}
+
+}  // namespace ecole::environment
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ecole/export.hpp"
+#include "ecole/information/abstract.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::information {
+
+/** Memory held by a Model and by the caches of the data functions extracting data from it, in bytes. */
+struct ECOLE_EXPORT MemoryReport {
+	std::size_t scip_used = 0;
+	std::size_t scip_total = 0;
+	std::size_t scip_extern_estimate = 0;
+	std::size_t data_functions = 0;
+
+	/** Read the memory of the given Model. */
+	static auto of(scip::Model const& model, std::size_t data_functions = 0) -> MemoryReport {
+		return {model.memory_used(), model.memory_total(), model.memory_extern_estimate(), data_functions};
+	}
+
+	/** Memory allocated for the Model and data functions, as counted by the memory limit. */
+	[[nodiscard]] auto total() const noexcept -> std::size_t {
+		return scip_total + scip_extern_estimate + data_functions;
+	}
+};
+
+/** The fields of a MemoryReport, and its total, in a dictionary. */
+inline auto to_information_map(MemoryReport const& report) -> InformationMap<std::size_t> {
+	return {
+		{"scip_used", report.scip_used},
+		{"scip_total", report.scip_total},
+		{"scip_extern_estimate", report.scip_extern_estimate},
+		{"data_functions", report.data_functions},
+		{"total", report.total()},
+	};
+}
+
+/**
+ * Memory used by the Model and data functions.
+ *
+ * Return the fields of MemoryReport, and its total, in a dictionary.
+ * The memory of data functions is only known when this is the information function of an Environment, it is
+ * zero otherwise.
+ */
+class MemoryUsage {
+public:
+	auto before_reset(scip::Model& /*model*/) -> void {}
+
+	auto extract(scip::Model& model, bool /* done */) -> InformationMap<std::size_t> {
+		return to_information_map(MemoryReport::of(model, data_functions_memory));
+	}
+
+	/** Set the memory of the data functions reported by the next extractions. */
+	auto track_data_functions(std::size_t bytes) noexcept -> void { data_functions_memory = bytes; }
+
+private:
+	std::size_t data_functions_memory = 0;
+};
+
+}  // namespace ecole::information
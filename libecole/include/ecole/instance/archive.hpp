@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ecole/export.hpp"
+#include "ecole/instance/abstract.hpp"
+#include "ecole/instance/files.hpp"
+#include "ecole/random.hpp"
+
+namespace ecole::instance {
+
+/**
+ * Write problem instances in a single archive file, read by the ArchiveGenerator.
+ *
+ * Instances are stored one after the other in the format of the file they come from (MPS, LP...), compressed with
+ * zlib when available, and followed by an index of their offsets written when closing the archive.
+ */
+class ECOLE_EXPORT ArchiveWriter {
+public:
+	struct ECOLE_EXPORT Parameters {
+		/** Whether to compress instances, ignored if Ecole is compiled without zlib. */
+		bool compress = true;
+		int compression_level = 6;  // NOLINT(readability-magic-numbers)
+	};
+
+	ECOLE_EXPORT ArchiveWriter(std::filesystem::path const& path, Parameters parameters);
+	ECOLE_EXPORT ArchiveWriter(std::filesystem::path const& path);
+	ArchiveWriter(ArchiveWriter const&) = delete;
+	ArchiveWriter(ArchiveWriter&&) = delete;
+	/** Close the archive, ignoring errors. */
+	ECOLE_EXPORT ~ArchiveWriter();
+	auto operator=(ArchiveWriter const&) -> ArchiveWriter& = delete;
+	auto operator=(ArchiveWriter&&) -> ArchiveWriter& = delete;
+
+	/**
+	 * Add the content of a problem file, whose format is given by its extension, possibly followed by ".gz".
+	 *
+	 * The instance is named after the file name, without its extensions.
+	 */
+	ECOLE_EXPORT auto add_file(std::filesystem::path const& problem_file) -> void;
+	/** Add a problem, written in the format of the given extension, and named after the model. */
+	ECOLE_EXPORT auto add(scip::Model const& model, std::string const& extension = "mps") -> void;
+	/** Write the index of the instances, after which no instance can be added. */
+	ECOLE_EXPORT auto close() -> void;
+
+	[[nodiscard]] ECOLE_EXPORT auto size() const noexcept -> std::size_t { return entries.size(); }
+
+	/** Location of an instance in an archive. */
+	struct ECOLE_EXPORT Entry {
+		std::uint64_t offset;
+		std::uint64_t stored_size;
+		std::uint64_t raw_size;
+		bool compressed;
+		std::string extension;
+		std::string name;
+	};
+
+private:
+	std::filesystem::path the_path;
+	Parameters parameters;
+	std::ofstream file;
+	std::uint64_t offset;
+	std::vector<Entry> entries;
+
+	auto add_content(std::vector<std::byte> const& content, std::string extension, std::string const& name) -> void;
+};
+
+/**
+ * Iterate over the instances of an archive written by the ArchiveWriter.
+ *
+ * Only the index of the archive is read on construction.
+ * The archive is memory mapped, and every instance is read with a single copy in an anonymous in-memory file parsed
+ * by SCIP, and named as in the archive.
+ * Instances are sampled as files are in the FileGenerator.
+ */
+class ECOLE_EXPORT ArchiveGenerator : public InstanceGenerator {
+public:
+	struct ECOLE_EXPORT Parameters {
+		using SamplingMode = FileGenerator::Parameters::SamplingMode;
+
+		std::filesystem::path archive = "instances.ecar";
+		SamplingMode sampling_mode = SamplingMode::remove_and_repeat;
+		/** Only use the instances of index ``shard_index`` modulo ``num_shards``. */
+		std::size_t shard_index = 0;
+		std::size_t num_shards = 1;
+	};
+
+	ECOLE_EXPORT ArchiveGenerator(Parameters parameters, RandomGenerator rng);
+	ECOLE_EXPORT ArchiveGenerator(Parameters parameters);
+	ECOLE_EXPORT ArchiveGenerator();
+
+	ECOLE_EXPORT auto next() -> scip::Model override;
+	ECOLE_EXPORT void seed(Seed seed) override;
+	[[nodiscard]] ECOLE_EXPORT auto done() const -> bool override;
+
+	[[nodiscard]] ECOLE_EXPORT auto get_parameters() const noexcept -> Parameters const& { return parameters; }
+	/** Number of instances in the shard of this generator. */
+	[[nodiscard]] ECOLE_EXPORT auto size() const noexcept -> std::size_t { return entries.size(); }
+
+private:
+	class Mapping;
+
+	RandomGenerator rng;
+	Parameters parameters;
+	std::shared_ptr<Mapping const> mapping;
+	std::vector<ArchiveWriter::Entry> entries;
+	std::size_t entries_remaining;
+
+	void reset_entry_list();
+	[[nodiscard]] auto load(ArchiveWriter::Entry const& entry) const -> scip::Model;
+};
+
+}  // namespace ecole::instance
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -21,6 +23,11 @@ public:
 		std::string directory = "instances";
 		bool recursive = true;
 		SamplingMode sampling_mode = SamplingMode::remove_and_repeat;
+		/** Only use the files of index ``shard_index`` modulo ``num_shards``, in sorted order. */
+		std::size_t shard_index = 0;
+		std::size_t num_shards = 1;
+		/** Number of files selected ahead, read in the page cache, with the next one parsed in the background. */
+		std::size_t prefetch = 0;
 	};
 
 	ECOLE_EXPORT FileGenerator(Parameters parameters, RandomGenerator rng);
@@ -38,8 +45,12 @@ private:
 	Parameters parameters;
 	std::vector<std::filesystem::path> files;
 	std::size_t files_remaining;
+	std::deque<std::filesystem::path> upcoming;
+	std::future<scip::Model> next_model;
 
 	void reset_file_list();
+	void select_upcoming();
+	void discard_upcoming() noexcept;
 };
 
 }  // namespace ecole::instance
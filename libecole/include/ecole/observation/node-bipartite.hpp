@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 
 #include <xtensor/xtensor.hpp>
@@ -68,6 +69,11 @@ public:
 
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<NodeBipartiteObs>;
 
+	/** Bytes held by the cached static features. */
+	[[nodiscard]] ECOLE_EXPORT auto memory_usage() const noexcept -> std::size_t;
+	/** Drop the cached features, extracting all features until the next root node. */
+	ECOLE_EXPORT auto evict() -> void;
+
 private:
 	NodeBipartiteObs the_cache;
 	bool use_cache = false;
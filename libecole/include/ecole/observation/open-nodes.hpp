@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/export.hpp"
+#include "ecole/observation/abstract.hpp"
+
+namespace ecole::observation {
+
+struct ECOLE_EXPORT OpenNodesObs {
+	static inline std::size_t constexpr n_features = 6;
+
+	enum struct ECOLE_EXPORT Features : std::size_t {
+		number = 0,
+		depth,
+		lowerbound,
+		estimate,
+		node_type,
+		parent_number,
+	};
+
+	/** Position of the open node in the search frontier, stored in the ``node_type`` feature. */
+	enum struct ECOLE_EXPORT NodeType : std::size_t { child = 0, sibling, leaf };
+
+	xt::xtensor<double, 2> features;
+};
+
+/**
+ * Features of all the open nodes of the branch-and-bound tree.
+ *
+ * The frontier is made of the children and siblings of the focus node, and of the other leaves
+ * (``SCIPgetOpenNodesData``).
+ * Open nodes are given together so that a policy can evaluate them in a single batch.
+ */
+class ECOLE_EXPORT OpenNodes {
+public:
+	auto before_reset(scip::Model& /*model*/) -> void {}
+
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<OpenNodesObs>;
+};
+
+}  // namespace ecole::observation
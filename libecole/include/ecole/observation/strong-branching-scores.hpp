@@ -8,6 +8,7 @@
 
 #include "ecole/export.hpp"
 #include "ecole/observation/abstract.hpp"
+#include "ecole/traits.hpp"
 
 namespace ecole::observation {
 
@@ -24,3 +25,10 @@ private:
 };
 
 }  // namespace ecole::observation
+
+namespace ecole::trait {
+
+/** Strong branching modifies the model while computing scores. */
+template <> struct is_exclusive_function<observation::StrongBranchingScores> : std::true_type {};
+
+}  // namespace ecole::trait
@@ -1,13 +1,27 @@
 #pragma once
 
+#include <cstdint>
 #include <random>
 #include <string>
 
 #include "ecole/export.hpp"
+#ifdef ECOLE_PHILOX_RANDOM_GENERATOR
+#include "ecole/utility/philox.hpp"
+#endif
 
 namespace ecole {
 
+/**
+ * The random generator used throughout Ecole.
+ *
+ * Ecole can be configured with ``ECOLE_PHILOX_RANDOM_GENERATOR`` to use a counter-based generator, with a state of a
+ * few bytes, instead of the Mersenne Twister.
+ */
+#ifdef ECOLE_PHILOX_RANDOM_GENERATOR
+using RandomGenerator = utility::Philox4x32;
+#else
 using RandomGenerator = std::mt19937;
+#endif
 using Seed = RandomGenerator::result_type;
 
 /**
@@ -28,8 +42,18 @@ ECOLE_EXPORT auto seed(Seed val) -> void;
  */
 ECOLE_EXPORT auto spawn_random_generator() -> RandomGenerator;
 
+/**
+ * Get the random generator of a given stream, as spawned after seeding.
+ *
+ * The result is the same as the stream-th call to spawn_random_generator following a call to seed, but does not
+ * depend on the global state, and hence on the order in which threads spawn generators.
+ */
+ECOLE_EXPORT auto make_random_generator(Seed seed, std::uint64_t stream) -> RandomGenerator;
+
 /**
  * Convert the state of the random generator to a string.
+ *
+ * The string is a compact binary representation when using the counter-based generator, and text otherwise.
  */
 ECOLE_EXPORT auto serialize(RandomGenerator const& rng) -> std::string;
 
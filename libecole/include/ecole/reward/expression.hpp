@@ -0,0 +1,148 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "ecole/export.hpp"
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole::reward {
+
+/**
+ * Exception class indicating that a reward expression divided by zero.
+ */
+class ECOLE_EXPORT ZeroDivisionError : public std::domain_error {
+public:
+	using std::domain_error::domain_error;
+};
+
+/**
+ * Solver statistics gathered once per extraction and shared by all leaves of an expression.
+ */
+struct ECOLE_EXPORT SolverStatistics {
+	/** Bit flags selecting which statistics to gather. */
+	enum Field : unsigned {
+		none = 0U,
+		lp_iterations = 1U << 0U,
+		n_nodes = 1U << 1U,
+		cpu_time = 1U << 2U,
+		wall_time = 1U << 3U,
+	};
+
+	std::uint64_t n_lp_iterations = 0;
+	std::uint64_t n_total_nodes = 0;
+	std::chrono::nanoseconds cpu_now = {};
+	std::chrono::nanoseconds wall_now = {};
+	bool done = false;
+
+	/** Query the requested statistics from the model. */
+	ECOLE_EXPORT static auto gather(scip::Model& model, bool done, unsigned fields) -> SolverStatistics;
+};
+
+/**
+ * A reward function computing an arithmetic expression of built-in rewards.
+ *
+ * The expression is stored as a flat program in postfix order.
+ * On every extraction, the solver statistics needed by the leaves are queried once, then the program is
+ * evaluated on a stack.
+ * Leaves have the same semantics as their respective reward functions (LpIterations, NNodes, SolvingTime, IsDone,
+ * Constant), and the operators follow Python float semantics.
+ * Other reward functions can be used as opaque leaves through a pair of callbacks.
+ */
+class ECOLE_EXPORT RewardExpression {
+public:
+	enum struct Op : std::uint8_t {
+		// Leaves
+		constant,
+		lp_iterations,
+		n_nodes,
+		cpu_time,
+		wall_time,
+		is_done,
+		function,
+		// Unary operators
+		neg,
+		abs,
+		exp,
+		log,
+		log2,
+		log10,
+		sqrt,
+		sin,
+		cos,
+		tan,
+		asin,
+		acos,
+		atan,
+		sinh,
+		cosh,
+		tanh,
+		asinh,
+		acosh,
+		atanh,
+		isfinite,
+		isinf,
+		isnan,
+		cumsum,
+		// Binary operators
+		add,
+		sub,
+		mul,
+		truediv,
+		floordiv,
+		mod,
+		pow,
+	};
+
+	/** Create a constant expression. */
+	ECOLE_EXPORT RewardExpression(Reward value = 0.);
+
+	/** A reward function evaluated as an opaque leaf. */
+	struct Function {
+		std::function<void(scip::Model&)> before_reset;
+		std::function<Reward(scip::Model&, bool)> extract;
+	};
+
+	ECOLE_EXPORT static auto is_leaf(Op op) noexcept -> bool;
+	ECOLE_EXPORT static auto is_unary(Op op) noexcept -> bool;
+	ECOLE_EXPORT static auto is_binary(Op op) noexcept -> bool;
+
+	/** An expression returning a constant value. */
+	ECOLE_EXPORT static auto constant(Reward value) -> RewardExpression;
+	/** A leaf reading the solver statistics (every leaf operation except constant and function). */
+	ECOLE_EXPORT static auto leaf(Op op) -> RewardExpression;
+	/** A leaf forwarding to an arbitrary reward function. */
+	ECOLE_EXPORT static auto function(Function func) -> RewardExpression;
+	ECOLE_EXPORT static auto unary(Op op, RewardExpression operand) -> RewardExpression;
+	ECOLE_EXPORT static auto binary(Op op, RewardExpression lhs, RewardExpression rhs) -> RewardExpression;
+
+	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done = false) -> Reward;
+
+	/** The solver statistics needed by the expression, as SolverStatistics::Field flags. */
+	[[nodiscard]] auto fields() const noexcept -> unsigned { return statistics_fields; }
+	/** The number of operations in the program. */
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return program.size(); }
+
+private:
+	struct Instruction {
+		Op op;
+		Reward value = 0.;             // Constant value or cumulated sum
+		std::uint64_t last_count = 0;  // Last LP iterations or nodes count
+		std::chrono::nanoseconds last_time = {};
+		std::size_t function_idx = 0;
+	};
+
+	std::vector<Instruction> program;
+	std::vector<Function> functions;
+	std::vector<Reward> stack;
+	unsigned statistics_fields = SolverStatistics::none;
+
+	auto append(RewardExpression&& other) -> void;
+};
+
+}  // namespace ecole::reward
@@ -14,6 +14,8 @@ public:
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done = false) -> Reward;
 
+	[[nodiscard]] auto uses_wall_clock() const noexcept -> bool { return wall; }
+
 private:
 	bool wall = false;
 	std::chrono::nanoseconds solving_time_offset;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <tuple>
 #include <variant>
 
+#include <scip/type_result.h>
 #include <scip/type_timing.h>
 
 #include "ecole/utility/unreachable.hpp"
@@ -35,14 +37,46 @@ constexpr inline double max_bound_distance_none = 1.0;
 constexpr inline int frequency_always = 1;
 constexpr inline int frequency_offset_none = 0;
 
+/** Parameter given by SCIP to the callback function. */
+template <Type type> struct Call;
+
+/** Parameter given by SCIP to the branchrule function. */
+template <> struct Call<Type::Branchrule> {
+	/** The method of the Branchrule callback being called. */
+	enum struct Where { LP, External, Pseudo };
+
+	bool allow_add_constraints;
+	Where where;
+};
+using BranchruleCall = Call<Type::Branchrule>;
+
+/** Parameter given by SCIP to the heuristic functions. */
+template <> struct Call<Type::Heuristic> {
+	SCIP_HEURTIMING heuristic_timing;
+	bool node_infeasible;
+};
+using HeuristicCall = Call<Type::Heuristic>;
+
+using DynamicCall = std::variant<Call<Type::Branchrule>, Call<Type::Heuristic>>;
+
 /** Parameter passed to create a reverse callback. */
 template <Type type> struct Constructor;
 
 /** Parameter passed to a reverse branchrule. */
 template <> struct Constructor<Type::Branchrule> {
+	/** Function called by the branchrule on the solver thread. */
+	using Handler = std::function<SCIP_RESULT(Call<Type::Branchrule> const&)>;
+
 	int priority = priority_max;
 	int max_depth = max_depth_none;
 	double max_bound_distance = max_bound_distance_none;
+	/**
+	 * Optional handler executed directly inside the branchrule.
+	 *
+	 * When set, the branchrule calls the handler and returns its result to SCIP instead of pausing iterative solving.
+	 * Solving therefore never gives back control until it terminates.
+	 */
+	Handler handler = nullptr;
 };
 using BranchruleConstructor = Constructor<Type::Branchrule>;
 
@@ -58,26 +92,4 @@ using HeuristicConstructor = Constructor<Type::Heuristic>;
 
 using DynamicConstructor = std::variant<Constructor<Type::Branchrule>, Constructor<Type::Heuristic>>;
 
-/** Parameter given by SCIP to the callback function. */
-template <Type type> struct Call;
-
-/** Parameter given by SCIP to the branchrule function. */
-template <> struct Call<Type::Branchrule> {
-	/** The method of the Branchrule callback being called. */
-	enum struct Where { LP, External, Pseudo };
-
-	bool allow_add_constraints;
-	Where where;
-};
-using BranchruleCall = Call<Type::Branchrule>;
-
-/** Parameter given by SCIP to the heuristic functions. */
-template <> struct Call<Type::Heuristic> {
-	SCIP_HEURTIMING heuristic_timing;
-	bool node_infeasible;
-};
-using HeuristicCall = Call<Type::Heuristic>;
-
-using DynamicCall = std::variant<Call<Type::Branchrule>, Call<Type::Heuristic>>;
-
 }  // namespace ecole::scip::callback
@@ -64,6 +64,17 @@ public:
 	[[nodiscard]] ECOLE_EXPORT Model copy() const;
 	[[nodiscard]] ECOLE_EXPORT Model copy_orig() const;
 
+	/**
+	 * Copy the subproblem of the current node.
+	 *
+	 * While solving, the transformed problem is copied with the local bounds of the focus node, making the copy an
+	 * independent problem rooted at that node.
+	 * It can be used to explore different decisions from the same node (e.g. lookahead rollouts).
+	 * The rest of the branch-and-bound tree (other open nodes, solutions, statistics) is not copied.
+	 * Outside of solving, this is the same as ``copy``.
+	 */
+	[[nodiscard]] ECOLE_EXPORT Model copy_local() const;
+
 	/**
 	 * Compare if two model share the same SCIP pointer, _i.e._ the same memory.
 	 */
@@ -84,11 +95,19 @@ public:
 	 * Writes the Model into a file.
 	 */
 	ECOLE_EXPORT void write_problem(std::filesystem::path const& filename) const;
+	/**
+	 * Writes the Model into a file, in the format of the given extension (e.g. "mps") rather than the file name.
+	 */
+	ECOLE_EXPORT void write_problem(std::filesystem::path const& filename, std::string const& extension) const;
 
 	/**
 	 * Read a problem file into the Model.
 	 */
 	ECOLE_EXPORT void read_problem(std::string const& filename);
+	/**
+	 * Read a problem file into the Model, in the format of the given extension rather than the file name.
+	 */
+	ECOLE_EXPORT void read_problem(std::string const& filename, std::string const& extension);
 
 	/**
 	 * Change whether or not to write logging messages in the logger.
@@ -100,6 +119,13 @@ public:
 
 	[[nodiscard]] ECOLE_EXPORT SCIP_STAGE stage() const noexcept;
 
+	/** Bytes of block memory used by SCIP, as with SCIPgetMemUsed. */
+	[[nodiscard]] ECOLE_EXPORT std::size_t memory_used() const noexcept;
+	/** Bytes of block memory allocated by SCIP, including unused blocks, as with SCIPgetMemTotal. */
+	[[nodiscard]] ECOLE_EXPORT std::size_t memory_total() const noexcept;
+	/** Estimate of the bytes allocated outside of block memory, such as by the LP solver (SCIPgetMemExternEstim). */
+	[[nodiscard]] ECOLE_EXPORT std::size_t memory_extern_estimate() const noexcept;
+
 	[[nodiscard]] ECOLE_EXPORT ParamType get_param_type(std::string const& name) const;
 
 	/**
@@ -136,6 +162,15 @@ public:
 	[[nodiscard]] ECOLE_EXPORT nonstd::span<SCIP_ROW*> lp_rows() const;
 	[[nodiscard]] ECOLE_EXPORT std::size_t nnz() const noexcept;
 
+	/**
+	 * Compute the data that SCIP computes lazily on first access.
+	 *
+	 * This is the objective norm, and at a node with a solved LP, the LP activities of rows, the reduced costs of
+	 * columns, and the LP branching candidates.
+	 * Reading them afterwards, until the model changes, does not write to the model, and can be done concurrently.
+	 */
+	ECOLE_EXPORT void fill_lazy_caches();
+
 	ECOLE_EXPORT void transform_prob();
 	ECOLE_EXPORT void presolve();
 	ECOLE_EXPORT void solve();
@@ -30,6 +30,7 @@ public:
 	ECOLE_EXPORT auto get_scip_ptr() noexcept -> SCIP*;
 
 	[[nodiscard]] ECOLE_EXPORT auto copy() const -> Scimpl;
+	[[nodiscard]] ECOLE_EXPORT auto copy_local() const -> Scimpl;
 	[[nodiscard]] ECOLE_EXPORT auto copy_orig() const -> Scimpl;
 
 	ECOLE_EXPORT auto solve_iter(nonstd::span<callback::DynamicConstructor const> arg_packs)
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+
 #include <scip/scip.h>
 
 #include "ecole/scip/exception.hpp"
@@ -14,4 +17,18 @@ template <typename Func, typename... Arguments> inline void call(Func func, Argu
 	}
 }
 
+/** Number of LP iterations performed so far, zero in stages where SCIP does not count them. */
+inline auto n_lp_iterations(SCIP* scip) -> std::uint64_t {
+	switch (SCIPgetStage(scip)) {
+	// Only stages when the following call is authorized
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_SOLVING:
+	case SCIP_STAGE_SOLVED:
+		return static_cast<std::uint64_t>(SCIPgetNLPIterations(scip));
+	default:
+		return 0;
+	}
+}
+
 }  // namespace ecole::scip
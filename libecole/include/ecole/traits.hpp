@@ -113,6 +113,21 @@ template <typename T> inline constexpr bool is_dynamics_v = internal::has_step_d
 
 template <typename T> using data_of_t = utility::return_t<decltype(&T::extract)>;
 
+/****************************************
+ *  Exclusive access of data functions  *
+ ****************************************/
+
+/**
+ * Whether a data function modifies the model during extraction.
+ *
+ * The caches that SCIP fills on first access, such as the LP branching candidates, row activities, or objective
+ * norm, do not count, as parallel data functions fill them beforehand with scip::Model::fill_lazy_caches.
+ * Such functions cannot extract data concurrently with other functions.
+ * Specialize to ``std::true_type`` for these functions.
+ */
+template <typename T> struct is_exclusive_function : std::false_type {};
+template <typename T> inline constexpr bool is_exclusive_function_v = is_exclusive_function<T>::value;
+
 /***********************************
  *  Detection of observation type  *
  ***********************************/
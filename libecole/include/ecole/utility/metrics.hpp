@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility::metrics {
+
+/** Names and values of the labels identifying a time series of a metric. */
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+/** Maximum number of values of all metrics, a counter using one and a histogram its number of buckets plus two. */
+inline constexpr std::size_t max_slots = 1024;
+
+/**
+ * Start recording metrics.
+ *
+ * Each thread adds to its own copy of the metrics, without synchronization, which are summed when read.
+ */
+ECOLE_EXPORT auto enable() -> void;
+
+/** Stop recording metrics, keeping their values. */
+ECOLE_EXPORT auto disable() -> void;
+
+/** Whether metrics are currently recorded. */
+ECOLE_EXPORT auto is_enabled() noexcept -> bool;
+
+/** Set all metrics back to zero. */
+ECOLE_EXPORT auto reset() -> void;
+
+/** Format all metrics in the Prometheus text exposition format. */
+ECOLE_EXPORT auto to_prometheus() -> std::string;
+
+/** Write all metrics to a file in the Prometheus text format, replacing it atomically. */
+ECOLE_EXPORT auto write_prometheus(std::filesystem::path const& filename) -> void;
+
+/** Upper bounds of histogram buckets suited for durations in seconds, from 10us to 10s. */
+ECOLE_EXPORT auto default_latency_bounds() -> std::vector<double>;
+
+/**
+ * A monotonic count of events.
+ *
+ * Counters with the same name and labels share their value, so that they can be declared as static variables.
+ */
+class ECOLE_EXPORT Counter {
+public:
+	ECOLE_EXPORT Counter(std::string_view name, std::string_view help, Labels const& labels = {});
+
+	/** Add to the count, if metrics are enabled. */
+	ECOLE_EXPORT auto increment(std::uint64_t amount = 1) const noexcept -> void;
+
+	/** Count summed over all threads. */
+	[[nodiscard]] ECOLE_EXPORT auto value() const -> std::uint64_t;
+
+private:
+	std::size_t slot;
+};
+
+/**
+ * A distribution of values, counted in buckets of given upper bounds.
+ *
+ * Histograms with the same name and labels share their values, and must have the same bounds.
+ */
+class ECOLE_EXPORT Histogram {
+public:
+	ECOLE_EXPORT Histogram(
+		std::string_view name,
+		std::string_view help,
+		std::vector<double> bounds = default_latency_bounds(),
+		Labels const& labels = {});
+
+	/** Add a value to the distribution, if metrics are enabled. */
+	ECOLE_EXPORT auto observe(double value) const noexcept -> void;
+
+	/** Number of values observed by all threads. */
+	[[nodiscard]] ECOLE_EXPORT auto count() const -> std::uint64_t;
+	/** Sum of the values observed by all threads. */
+	[[nodiscard]] ECOLE_EXPORT auto sum() const -> double;
+
+	[[nodiscard]] auto bounds() const noexcept -> std::vector<double> const& { return upper_bounds; }
+
+private:
+	std::size_t slot;
+	std::vector<double> upper_bounds;
+};
+
+/**
+ * Observe the duration of a scope in seconds in a histogram.
+ *
+ * Nothing is observed if metrics were disabled when the timer was created.
+ */
+class ECOLE_EXPORT Timer {
+public:
+	ECOLE_EXPORT Timer(Histogram const& histogram) noexcept;
+	Timer(Timer const&) = delete;
+	Timer(Timer&&) = delete;
+	ECOLE_EXPORT ~Timer();
+
+	Timer& operator=(Timer const&) = delete;
+	Timer& operator=(Timer&&) = delete;
+
+private:
+	Histogram const* histogram;
+	std::int64_t start_ns = -1;
+};
+
+/**
+ * Serve the metrics on a Unix domain socket.
+ *
+ * A background thread answers every connection with the metrics in the Prometheus text format, as an HTTP response
+ * if the client sends an HTTP request (such as ``curl --unix-socket``), and as plain text otherwise.
+ * The socket file is removed when the exporter is destroyed.
+ */
+class ECOLE_EXPORT SocketExporter {
+public:
+	ECOLE_EXPORT SocketExporter(std::filesystem::path path);
+	SocketExporter(SocketExporter const&) = delete;
+	SocketExporter(SocketExporter&&) = delete;
+	ECOLE_EXPORT ~SocketExporter();
+
+	SocketExporter& operator=(SocketExporter const&) = delete;
+	SocketExporter& operator=(SocketExporter&&) = delete;
+
+	/** Stop serving and remove the socket file. */
+	ECOLE_EXPORT auto close() -> void;
+
+	[[nodiscard]] auto path() const noexcept -> std::filesystem::path const& { return the_path; }
+
+private:
+	class Server;
+	std::filesystem::path the_path;
+	std::unique_ptr<Server> server;
+};
+
+}  // namespace ecole::utility::metrics
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace ecole::utility {
+
+class Philox4x32;
+
+namespace internal {
+
+/** Whether the type is used as a seed sequence, rather than a seed value or a generator to copy. */
+template <typename T>
+inline constexpr bool is_seed_seq_v = !std::is_convertible_v<T, std::uint32_t> && !std::is_same_v<T, Philox4x32>;
+
+}  // namespace internal
+
+/**
+ * Philox4x32-10 counter-based random number engine.
+ *
+ * Satisfy the same RandomNumberEngine interface as std::mt19937, with a state of a few bytes.
+ * The output is a function of a 64 bits key, a 64 bits stream identifier, and the position in the stream, so that
+ * independent streams are created in constant time without shared state, and discard jumps in constant time.
+ *
+ * Algorithm from
+ * Salmon JK, Moraes MA, Dror RO, Shaw DE (2011). "Parallel random numbers: as easy as 1, 2, 3."
+ * Proceedings of the International Conference for High Performance Computing, Networking, Storage and Analysis.
+ * doi:10.1145/2063384.2063405.
+ */
+class Philox4x32 {
+public:
+	using result_type = std::uint32_t;
+
+	static constexpr result_type default_seed = 5489U;
+	/** Size of the binary representation of the state. */
+	static constexpr std::size_t state_size = 3 * sizeof(std::uint64_t);
+	using State = std::array<unsigned char, state_size>;
+
+	static constexpr auto min() noexcept -> result_type { return std::numeric_limits<result_type>::min(); }
+	static constexpr auto max() noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
+
+	Philox4x32() noexcept : Philox4x32{default_seed} {}
+	explicit Philox4x32(result_type value) noexcept { seed(value); }
+	/** Create the generator of a given stream, positioned at the start of the stream. */
+	Philox4x32(std::uint64_t key, std::uint64_t stream) noexcept { seed(key, stream); }
+	template <typename SeedSeq, typename = std::enable_if_t<internal::is_seed_seq_v<SeedSeq>>>
+	explicit Philox4x32(SeedSeq& seq) {
+		seed(seq);
+	}
+
+	auto seed(result_type value = default_seed) noexcept -> void { seed(value, 0); }
+	auto seed(std::uint64_t key_, std::uint64_t stream_) noexcept -> void;
+	/** Key and stream are generated from the sequence. */
+	template <typename SeedSeq, typename = std::enable_if_t<internal::is_seed_seq_v<SeedSeq>>>
+	auto seed(SeedSeq& seq) -> void;
+
+	auto operator()() noexcept -> result_type;
+
+	/** Advance the state by n positions in constant time. */
+	auto discard(unsigned long long n) noexcept -> void;
+
+	[[nodiscard]] auto key() const noexcept -> std::uint64_t { return the_key; }
+	[[nodiscard]] auto stream() const noexcept -> std::uint64_t { return the_stream; }
+	[[nodiscard]] auto position() const noexcept -> std::uint64_t { return the_position; }
+
+	/** Portable (little-endian) binary representation of the state. */
+	[[nodiscard]] auto to_bytes() const noexcept -> State;
+	static auto from_bytes(State const& state) noexcept -> Philox4x32;
+
+	friend auto operator==(Philox4x32 const& a, Philox4x32 const& b) noexcept -> bool {
+		return a.the_key == b.the_key && a.the_stream == b.the_stream && a.the_position == b.the_position;
+	}
+	friend auto operator!=(Philox4x32 const& a, Philox4x32 const& b) noexcept -> bool { return !(a == b); }
+
+	template <typename CharT, typename Traits>
+	friend auto operator<<(std::basic_ostream<CharT, Traits>& os, Philox4x32 const& rng)
+		-> std::basic_ostream<CharT, Traits>& {
+		auto const space = os.widen(' ');
+		return os << rng.the_key << space << rng.the_stream << space << rng.the_position;
+	}
+	template <typename CharT, typename Traits>
+	friend auto operator>>(std::basic_istream<CharT, Traits>& is, Philox4x32& rng) -> std::basic_istream<CharT, Traits>& {
+		std::uint64_t key = 0;
+		std::uint64_t stream = 0;
+		std::uint64_t position = 0;
+		if (is >> key >> stream >> position) {
+			rng.set_state(key, stream, position);
+		}
+		return is;
+	}
+
+	/** The Philox4x32-10 bijection, exposed for testing against known answers. */
+	static auto block(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) noexcept
+		-> std::array<std::uint32_t, 4>;
+
+private:
+	std::uint64_t the_key = 0;
+	std::uint64_t the_stream = 0;
+	std::uint64_t the_position = 0;  // Number of values drawn from the stream
+	std::array<std::uint32_t, 4> buffer = {};
+
+	auto set_state(std::uint64_t key_, std::uint64_t stream_, std::uint64_t position_) noexcept -> void;
+	auto generate_block() noexcept -> void;
+};
+
+/**********************************
+ *  Implementation of Philox4x32  *
+ **********************************/
+
+inline auto Philox4x32::block(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) noexcept
+	-> std::array<std::uint32_t, 4> {
+	constexpr auto multiplier_0 = std::uint64_t{0xD2511F53};
+	constexpr auto multiplier_1 = std::uint64_t{0xCD9E8D57};
+	constexpr auto weyl_0 = std::uint32_t{0x9E3779B9};
+	constexpr auto weyl_1 = std::uint32_t{0xBB67AE85};
+	constexpr auto n_rounds = 10;
+
+	for (int round = 0; round < n_rounds; ++round) {
+		if (round > 0) {
+			key[0] += weyl_0;
+			key[1] += weyl_1;
+		}
+		auto const product_0 = multiplier_0 * counter[0];
+		auto const product_1 = multiplier_1 * counter[2];
+		counter = {
+			static_cast<std::uint32_t>(product_1 >> 32U) ^ counter[1] ^ key[0],
+			static_cast<std::uint32_t>(product_1),
+			static_cast<std::uint32_t>(product_0 >> 32U) ^ counter[3] ^ key[1],
+			static_cast<std::uint32_t>(product_0),
+		};
+	}
+	return counter;
+}
+
+inline auto Philox4x32::seed(std::uint64_t key_, std::uint64_t stream_) noexcept -> void {
+	set_state(key_, stream_, 0);
+}
+
+template <typename SeedSeq, typename> auto Philox4x32::seed(SeedSeq& seq) -> void {
+	auto words = std::array<std::uint32_t, 4>{};
+	seq.generate(words.begin(), words.end());
+	auto const join = [](std::uint32_t low, std::uint32_t high) { return (std::uint64_t{high} << 32U) | low; };
+	set_state(join(words[0], words[1]), join(words[2], words[3]), 0);
+}
+
+inline auto Philox4x32::operator()() noexcept -> result_type {
+	auto const offset = the_position & 3U;
+	if (offset == 0) {
+		generate_block();
+	}
+	++the_position;
+	return buffer[offset];
+}
+
+inline auto Philox4x32::discard(unsigned long long n) noexcept -> void {
+	set_state(the_key, the_stream, the_position + n);
+}
+
+inline auto Philox4x32::to_bytes() const noexcept -> State {
+	auto state = State{};
+	auto out = state.begin();
+	for (auto const word : {the_key, the_stream, the_position}) {
+		for (std::size_t i = 0; i < sizeof(word); ++i) {
+			*(out++) = static_cast<unsigned char>(word >> (8U * i));
+		}
+	}
+	return state;
+}
+
+inline auto Philox4x32::from_bytes(State const& state) noexcept -> Philox4x32 {
+	auto words = std::array<std::uint64_t, 3>{};
+	auto in = state.begin();
+	for (auto& word : words) {
+		for (std::size_t i = 0; i < sizeof(word); ++i) {
+			word |= std::uint64_t{*(in++)} << (8U * i);
+		}
+	}
+	auto rng = Philox4x32{};
+	rng.set_state(words[0], words[1], words[2]);
+	return rng;
+}
+
+inline auto Philox4x32::set_state(std::uint64_t key_, std::uint64_t stream_, std::uint64_t position_) noexcept
+	-> void {
+	the_key = key_;
+	the_stream = stream_;
+	the_position = position_;
+	// The buffer must hold the current block when positioned in its middle
+	if ((the_position & 3U) != 0) {
+		generate_block();
+	}
+}
+
+inline auto Philox4x32::generate_block() noexcept -> void {
+	// The counter is made of the block index in the low words, and the stream in the high words
+	auto const block_idx = the_position >> 2U;
+	buffer = block(
+		{
+			static_cast<std::uint32_t>(block_idx),
+			static_cast<std::uint32_t>(block_idx >> 32U),
+			static_cast<std::uint32_t>(the_stream),
+			static_cast<std::uint32_t>(the_stream >> 32U),
+		},
+		{static_cast<std::uint32_t>(the_key), static_cast<std::uint32_t>(the_key >> 32U)});
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include <nonstd/span.hpp>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility {
+
+/**
+ * A single producer, single consumer ring of messages in POSIX shared memory.
+ *
+ * The ring is made of a fixed number of slots of fixed capacity, aligned on cache lines.
+ * The producer writes a message in the next slot, and the consumer reads it in place, without copy.
+ * A slot read by the consumer is only recycled once it is released, possibly out of order.
+ * When the next slot is not yet released, the producer waits (backpressure), and when no message is available,
+ * the consumer waits, spinning then sleeping with an exponential backoff.
+ *
+ * The process creating the ring owns its name, which is unlinked when the creating object is destroyed.
+ * Other processes open the ring by name, and keep the memory mapped until they are destroyed.
+ */
+class ECOLE_EXPORT SharedRing {
+public:
+	/** Wait forever when no timeout is given. */
+	using Timeout = std::optional<std::chrono::nanoseconds>;
+
+	/** A message read from the ring, valid until the slot is released. */
+	struct Message {
+		std::size_t slot;
+		nonstd::span<std::byte const> data;
+	};
+
+	/** Create a new shared memory segment, failing if the name is already used. */
+	ECOLE_EXPORT static auto create(std::string name, std::size_t n_slots, std::size_t slot_capacity) -> SharedRing;
+	/** Open a shared memory segment created by another SharedRing. */
+	ECOLE_EXPORT static auto open(std::string name) -> SharedRing;
+
+	ECOLE_EXPORT SharedRing(SharedRing&& other) noexcept;
+	SharedRing(SharedRing const&) = delete;
+	ECOLE_EXPORT ~SharedRing();
+
+	ECOLE_EXPORT auto operator=(SharedRing&& other) noexcept -> SharedRing&;
+	auto operator=(SharedRing const&) -> SharedRing& = delete;
+
+	/**
+	 * Wait for the next slot to be free and return its memory for writing.
+	 *
+	 * @return The slot memory, of size slot_capacity, or nothing if the timeout expired.
+	 * @post The message must be published with commit_write before writing another one.
+	 */
+	ECOLE_EXPORT auto begin_write(Timeout timeout = {}) -> std::optional<nonstd::span<std::byte>>;
+	/** Publish the message written in the slot returned by begin_write. */
+	ECOLE_EXPORT auto commit_write(std::size_t size) -> void;
+
+	/**
+	 * Wait for the next message.
+	 *
+	 * @return The message, or nothing if the timeout expired.
+	 * @post The slot of the message must be released for the producer to reuse it.
+	 */
+	ECOLE_EXPORT auto read(Timeout timeout = {}) -> std::optional<Message>;
+	/** Give back a slot read by the consumer to the producer. */
+	ECOLE_EXPORT auto release(std::size_t slot) -> void;
+
+	[[nodiscard]] auto name() const noexcept -> std::string const& { return the_name; }
+	[[nodiscard]] ECOLE_EXPORT auto n_slots() const noexcept -> std::size_t;
+	[[nodiscard]] ECOLE_EXPORT auto slot_capacity() const noexcept -> std::size_t;
+	/** Number of messages written, and read, since the creation of the ring. */
+	[[nodiscard]] ECOLE_EXPORT auto n_written() const noexcept -> std::uint64_t;
+	[[nodiscard]] ECOLE_EXPORT auto n_read() const noexcept -> std::uint64_t;
+
+private:
+	std::string the_name;
+	void* memory = nullptr;
+	std::size_t memory_size = 0;
+	bool owner = false;
+	bool writing = false;
+
+	SharedRing(std::string name, void* memory, std::size_t memory_size, bool owner) noexcept;
+};
+
+}  // namespace ecole::utility
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility {
+
+/**
+ * A fixed size pool of worker threads.
+ *
+ * Tasks are executed in submission order by the first available worker.
+ * The destructor waits for all submitted tasks to complete.
+ * Tasks must not wait on other tasks submitted to the same pool, as this can deadlock if all workers are waiting.
+ */
+class ECOLE_EXPORT ThreadPool {
+public:
+	/** Create a pool with the given number of workers, or the number of hardware threads if zero. */
+	ECOLE_EXPORT ThreadPool(std::size_t n_threads = 0);
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	ECOLE_EXPORT ~ThreadPool();
+
+	ThreadPool& operator=(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+	/** A process-wide pool, lazily created with one worker per hardware thread. */
+	ECOLE_EXPORT static auto shared() -> ThreadPool&;
+
+	/** Number of worker threads. */
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return workers.size(); }
+
+	/** Whether the calling thread is a worker of any pool, in which case it must not wait on other tasks. */
+	[[nodiscard]] ECOLE_EXPORT static auto in_worker_thread() noexcept -> bool;
+
+	/**
+	 * Execute a function asynchronously.
+	 *
+	 * @return A future holding the function result, or the exception it threw.
+	 */
+	template <typename Function> auto submit(Function&& func) -> std::future<std::invoke_result_t<Function>>;
+
+private:
+	std::vector<std::thread> workers;
+	std::queue<std::function<void()>> tasks;
+	std::mutex tasks_mutex;
+	std::condition_variable tasks_available;
+	bool stopping = false;
+
+	ECOLE_EXPORT auto push(std::function<void()> task) -> void;
+	auto work() -> void;
+};
+
+/**********************************
+ *  Implementation of ThreadPool  *
+ *********************************/
+
+template <typename Function>
+auto ThreadPool::submit(Function&& func) -> std::future<std::invoke_result_t<Function>> {
+	using Return = std::invoke_result_t<Function>;
+	// std::function must be copyable, so the (move only) packaged_task is shared
+	auto task = std::make_shared<std::packaged_task<Return()>>(std::forward<Function>(func));
+	auto future = task->get_future();
+	push([task = std::move(task)] { (*task)(); });
+	return future;
+}
+
+}  // namespace ecole::utility
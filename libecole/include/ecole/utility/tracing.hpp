@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility::tracing {
+
+/** A completed span, with times in nanoseconds since the first use of the tracer. */
+struct Event {
+	char const* name = nullptr;
+	char const* category = nullptr;
+	std::int64_t start_ns = 0;
+	std::int64_t duration_ns = 0;
+	std::uint32_t thread_id = 0;
+};
+
+/** Default number of events kept per thread. */
+inline constexpr std::size_t default_capacity = 1U << 16U;
+
+/**
+ * Start recording spans.
+ *
+ * Each thread records in its own ring buffer of the given capacity, overwriting its oldest events when full.
+ * The buffer of a thread is released when it exits, its events being kept in a shared buffer of the same capacity.
+ * Previously recorded events are discarded.
+ */
+ECOLE_EXPORT auto enable(std::size_t capacity_per_thread = default_capacity) -> void;
+
+/** Stop recording spans, keeping the events recorded so far. */
+ECOLE_EXPORT auto disable() -> void;
+
+/** Whether spans are currently recorded. */
+ECOLE_EXPORT auto is_enabled() noexcept -> bool;
+
+/** Discard all recorded events. */
+ECOLE_EXPORT auto clear() -> void;
+
+/** Copy the events recorded by all threads, sorted by start time. */
+ECOLE_EXPORT auto collect() -> std::vector<Event>;
+
+/** Return a string with a static lifetime equal to the given one, for use as a dynamic span name. */
+ECOLE_EXPORT auto intern(std::string_view str) -> char const*;
+
+/** Format the recorded events in the Chrome Trace Event format, as read by chrome://tracing or Perfetto. */
+ECOLE_EXPORT auto to_chrome_json() -> std::string;
+
+/** Write the recorded events to a file in the Chrome Trace Event format. */
+ECOLE_EXPORT auto write_chrome_json(std::string const& filename) -> void;
+
+/**
+ * Record the duration of a scope.
+ *
+ * The name and category are not copied and must outlive the tracer, such as string literals or interned strings.
+ * Nothing is recorded if tracing was disabled when the span was created.
+ */
+class ECOLE_EXPORT Span {
+public:
+	ECOLE_EXPORT Span(char const* name, char const* category = "ecole") noexcept;
+	Span(Span const&) = delete;
+	Span(Span&&) = delete;
+	ECOLE_EXPORT ~Span();
+
+	Span& operator=(Span const&) = delete;
+	Span& operator=(Span&&) = delete;
+
+private:
+	char const* name;
+	char const* category;
+	std::int64_t start_ns = -1;
+};
+
+}  // namespace ecole::utility::tracing
+
+/**
+ * Trace the enclosing scope.
+ *
+ * Compiled out unless Ecole is built with ``ECOLE_ENABLE_TRACING``.
+ */
+#ifdef ECOLE_ENABLE_TRACING
+#define ECOLE_TRACE_CONCAT_IMPL(a, b) a##b
+#define ECOLE_TRACE_CONCAT(a, b) ECOLE_TRACE_CONCAT_IMPL(a, b)
+#define ECOLE_TRACE_SPAN(...) \
+	::ecole::utility::tracing::Span const ECOLE_TRACE_CONCAT(ecole_trace_span_, __LINE__) { __VA_ARGS__ }
+#else
+#define ECOLE_TRACE_SPAN(...) static_cast<void>(0)
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Binary layout of the shard files of a dataset.
+ *
+ * A shard starts with a FileHeader, followed by one ColumnHeader per column, then by chunks.
+ * Every chunk is a ChunkHeader followed by its (possibly compressed) payload, padded to the alignment.
+ * Once decompressed, the payload starts with the offsets of the column blocks.
+ * Each column block holds the shapes of all samples, the offsets of their data, and, aligned, their data.
+ * All offsets are in bytes, and all integers are little endian, as on the machines writing them.
+ */
+namespace ecole::dataset::format {
+
+constexpr std::size_t alignment = 64;
+constexpr char file_magic[8] = "ECOLEDS";         // NOLINT(cppcoreguidelines-avoid-c-arrays)
+constexpr std::uint32_t chunk_magic = 0x4b4e4843;  // "CHNK"
+constexpr std::uint32_t version = 1;
+
+struct FileHeader {
+	char magic[8];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+	std::uint32_t version;
+	std::uint32_t n_columns;
+	std::uint8_t reserved[48];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+struct ColumnHeader {
+	char name[48];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+	char kind;
+	std::uint8_t itemsize;
+	std::uint8_t reserved[6];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+	std::uint64_t ndim;
+};
+
+struct ChunkHeader {
+	std::uint32_t magic;
+	std::uint32_t compression;
+	std::uint64_t n_samples;
+	std::uint64_t raw_size;
+	std::uint64_t stored_size;
+	std::uint8_t reserved[32];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+static_assert(sizeof(FileHeader) == alignment);
+static_assert(sizeof(ColumnHeader) == alignment);
+static_assert(sizeof(ChunkHeader) == alignment);
+
+constexpr auto align(std::size_t size) noexcept -> std::size_t {
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+/** Size of the column offsets at the beginning of a payload. */
+constexpr auto column_offsets_size(std::size_t n_columns) noexcept -> std::size_t {
+	return align(n_columns * sizeof(std::uint64_t));
+}
+
+/** Size of the shapes and offsets at the beginning of a column block, before the data. */
+constexpr auto column_index_size(std::size_t n_samples, std::size_t ndim) noexcept -> std::size_t {
+	return align((n_samples * ndim + n_samples + 1) * sizeof(std::uint64_t));
+}
+
+}  // namespace ecole::dataset::format
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#ifdef ECOLE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#include "ecole/dataset/reader.hpp"
+
+#include "dataset/format.hpp"
+
+namespace ecole::dataset {
+
+/** A read only memory map of a whole file. */
+class DatasetReader::Mapping {
+public:
+	explicit Mapping(std::filesystem::path const& file) {
+		auto const fd = ::open(file.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+		if (fd < 0) {
+			throw std::system_error{{errno, std::generic_category()}, fmt::format("Could not open {}", file.string())};
+		}
+		struct stat status = {};
+		if (fstat(fd, &status) == 0) {
+			the_size = static_cast<std::size_t>(status.st_size);
+		}
+		if (the_size > 0) {
+			memory = mmap(nullptr, the_size, PROT_READ, MAP_SHARED, fd, 0);
+		}
+		auto const error = errno;
+		::close(fd);
+		if (memory == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) macro defined by POSIX
+			throw std::system_error{{error, std::generic_category()}, fmt::format("Could not map {}", file.string())};
+		}
+	}
+	Mapping(Mapping const&) = delete;
+	Mapping(Mapping&&) = delete;
+	~Mapping() {
+		if ((memory != nullptr) && (memory != MAP_FAILED)) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+			munmap(memory, the_size);
+		}
+	}
+	auto operator=(Mapping const&) -> Mapping& = delete;
+	auto operator=(Mapping&&) -> Mapping& = delete;
+
+	[[nodiscard]] auto data() const noexcept -> std::byte const* { return static_cast<std::byte const*>(memory); }
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return the_size; }
+
+private:
+	void* memory = nullptr;
+	std::size_t the_size = 0;
+};
+
+namespace {
+
+template <typename T> auto read_as(std::byte const* data) -> T {
+	auto value = T{};
+	std::memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+auto decompress(std::byte const* stored, std::size_t stored_size, std::size_t raw_size, Compression compression)
+	-> std::vector<std::byte> {
+#ifdef ECOLE_HAS_ZLIB
+	if (compression == Compression::zlib) {
+		auto raw = std::vector<std::byte>(raw_size);
+		auto size = static_cast<uLongf>(raw_size);
+		auto const status = uncompress(
+			reinterpret_cast<Bytef*>(raw.data()), &size, reinterpret_cast<Bytef const*>(stored), static_cast<uLong>(stored_size));
+		if ((status != Z_OK) || (size != raw_size)) {
+			throw std::runtime_error{fmt::format("Could not decompress chunk (zlib error {}).", status)};
+		}
+		return raw;
+	}
+#else
+	(void)stored;
+	(void)stored_size;
+	(void)raw_size;
+	(void)compression;
+#endif
+	throw std::runtime_error{"Ecole was compiled without support for the dataset compression."};
+}
+
+}  // namespace
+
+/**********************************
+ *  Definition of DatasetReader  *
+ **********************************/
+
+DatasetReader::DatasetReader(std::filesystem::path const& path) {
+	if (!std::filesystem::is_directory(path)) {
+		add_shard(path);
+		return;
+	}
+	auto files = std::vector<std::filesystem::path>{};
+	for (auto const& entry : std::filesystem::directory_iterator{path}) {
+		if (entry.is_regular_file() && entry.path().extension() == ".ecds") {
+			files.push_back(entry.path());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	for (auto const& file : files) {
+		add_shard(file);
+	}
+}
+
+auto DatasetReader::add_shard(std::filesystem::path const& file) -> void {
+	auto mapping = std::make_shared<Mapping const>(file);
+	auto const* const data = mapping->data();
+	auto const size = mapping->size();
+
+	auto const header = size < sizeof(format::FileHeader) ? format::FileHeader{} : read_as<format::FileHeader>(data);
+	if (
+		!std::equal(std::begin(format::file_magic), std::end(format::file_magic), std::begin(header.magic)) ||
+		(header.version != format::version) ||
+		(size < sizeof(format::FileHeader) + header.n_columns * sizeof(format::ColumnHeader))) {
+		throw std::runtime_error{fmt::format("File {} is not a dataset shard.", file.string())};
+	}
+
+	auto schema = std::vector<ColumnSchema>{};
+	for (std::size_t i = 0; i < header.n_columns; ++i) {
+		auto const column =
+			read_as<format::ColumnHeader>(data + sizeof(format::FileHeader) + i * sizeof(format::ColumnHeader));
+		auto const* const name_end = std::find(std::begin(column.name), std::end(column.name), '\0');
+		schema.push_back({{std::begin(column.name), name_end}, {column.kind, column.itemsize}, column.ndim});
+	}
+	auto const same_column = [](ColumnSchema const& a, ColumnSchema const& b) {
+		return (a.name == b.name) && (a.dtype == b.dtype) && (a.ndim == b.ndim);
+	};
+	if (chunks.empty() && the_schema.empty()) {
+		the_schema = std::move(schema);
+	} else if (!std::equal(the_schema.begin(), the_schema.end(), schema.begin(), schema.end(), same_column)) {
+		throw std::runtime_error{fmt::format("Shard {} has different columns than previous shards.", file.string())};
+	}
+
+	auto offset = sizeof(format::FileHeader) + header.n_columns * sizeof(format::ColumnHeader);
+	while (offset + sizeof(format::ChunkHeader) <= size) {
+		auto const chunk = read_as<format::ChunkHeader>(data + offset);
+		auto const payload = offset + sizeof(format::ChunkHeader);
+		// Stop at the first incomplete chunk
+		if ((chunk.magic != format::chunk_magic) || (payload + chunk.stored_size > size)) {
+			break;
+		}
+		auto const compression = static_cast<Compression>(chunk.compression);
+		if (!supports(compression)) {
+			throw std::runtime_error{
+				fmt::format("Shard {} uses a compression not supported by this version of Ecole.", file.string())};
+		}
+		chunks.push_back(
+			{mapping, data + payload, chunk.stored_size, chunk.raw_size, compression, n_samples, chunk.n_samples});
+		n_samples += chunk.n_samples;
+		offset = payload + format::align(chunk.stored_size);
+	}
+}
+
+auto DatasetReader::payload_of(std::size_t chunk_idx) const -> std::pair<std::byte const*, std::shared_ptr<void const>> {
+	auto const& chunk = chunks[chunk_idx];
+	if (chunk.compression == Compression::none) {
+		return {chunk.payload, chunk.mapping};
+	}
+	auto const lock = std::lock_guard{cache_mutex};
+	if ((cached_payload == nullptr) || (cached_chunk != chunk_idx)) {
+		cached_payload = std::make_shared<std::vector<std::byte> const>(
+			decompress(chunk.payload, chunk.stored_size, chunk.raw_size, chunk.compression));
+		cached_chunk = chunk_idx;
+	}
+	return {cached_payload->data(), cached_payload};
+}
+
+auto DatasetReader::get(std::size_t index) const -> SampleRef {
+	if (index >= n_samples) {
+		throw std::out_of_range{fmt::format("Sample {} is out of range for a dataset of size {}.", index, n_samples)};
+	}
+	auto const chunk_iter = std::upper_bound(
+		chunks.begin(), chunks.end(), index, [](std::size_t idx, ChunkInfo const& chunk) { return idx < chunk.first_sample; });
+	auto const chunk_idx = static_cast<std::size_t>(chunk_iter - chunks.begin()) - 1;
+	auto const& chunk = chunks[chunk_idx];
+	auto [payload, owner] = payload_of(chunk_idx);
+	auto const n_chunk_samples = chunk.n_samples;
+	auto const sample_idx = index - chunk.first_sample;
+
+	auto sample = Sample{};
+	sample.reserve(the_schema.size());
+	for (std::size_t i = 0; i < the_schema.size(); ++i) {
+		auto const& column = the_schema[i];
+		auto const* const block = payload + read_as<std::uint64_t>(payload + i * sizeof(std::uint64_t));
+		auto shape = std::vector<std::size_t>(column.ndim);
+		for (std::size_t d = 0; d < column.ndim; ++d) {
+			shape[d] = read_as<std::uint64_t>(block + (sample_idx * column.ndim + d) * sizeof(std::uint64_t));
+		}
+		auto const* const offsets = block + n_chunk_samples * column.ndim * sizeof(std::uint64_t);
+		auto const begin = read_as<std::uint64_t>(offsets + sample_idx * sizeof(std::uint64_t));
+		auto const end = read_as<std::uint64_t>(offsets + (sample_idx + 1) * sizeof(std::uint64_t));
+		auto const* const data = block + format::column_index_size(n_chunk_samples, column.ndim) + begin;
+		if ((end < begin) || (data + (end - begin) > payload + chunk.raw_size)) {
+			throw std::runtime_error{fmt::format("Sample {} is corrupted.", index)};
+		}
+		sample.push_back({column.name, column.dtype, std::move(shape), {data, end - begin}});
+	}
+	return {std::move(sample), std::move(owner)};
+}
+
+}  // namespace ecole::dataset
@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#ifdef ECOLE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#include "ecole/dataset/writer.hpp"
+
+#include "dataset/format.hpp"
+
+namespace ecole::dataset {
+
+namespace {
+
+auto shard_path(std::filesystem::path const& directory, std::size_t shard) -> std::filesystem::path {
+	return directory / fmt::format("shard-{:05d}.ecds", shard);
+}
+
+auto to_schema(Sample const& sample) -> std::vector<ColumnSchema> {
+	if (sample.empty()) {
+		throw std::invalid_argument{"Samples must have at least one column."};
+	}
+	auto schema = std::vector<ColumnSchema>{};
+	schema.reserve(sample.size());
+	for (auto const& column : sample) {
+		if (column.name.size() >= sizeof(format::ColumnHeader::name)) {
+			throw std::invalid_argument{fmt::format(
+				"Column name '{}' exceeds {} characters.", column.name, sizeof(format::ColumnHeader::name) - 1)};
+		}
+		schema.push_back({column.name, column.dtype, column.shape.size()});
+	}
+	return schema;
+}
+
+auto check_column(Column const& column, ColumnSchema const& schema) -> void {
+	if ((column.name != schema.name) || (column.dtype != schema.dtype) || (column.shape.size() != schema.ndim)) {
+		throw std::invalid_argument{fmt::format(
+			"Column '{}' does not match column '{}' of the first sample, with the same type and dimensions.",
+			column.name,
+			schema.name)};
+	}
+	auto const n_elements =
+		std::accumulate(column.shape.begin(), column.shape.end(), std::size_t{1}, std::multiplies<>{});
+	if (column.data.size() != n_elements * column.dtype.itemsize) {
+		throw std::invalid_argument{
+			fmt::format("Column '{}' has {} bytes of data for its shape.", column.name, column.data.size())};
+	}
+}
+
+/** Compress a chunk payload, with a compression other than none. */
+auto compress(std::vector<std::byte> const& raw, Compression compression, int level) -> std::vector<std::byte> {
+#ifdef ECOLE_HAS_ZLIB
+	if (compression == Compression::zlib) {
+		auto size = compressBound(static_cast<uLong>(raw.size()));
+		auto compressed = std::vector<std::byte>(size);
+		auto const status = compress2(
+			reinterpret_cast<Bytef*>(compressed.data()),
+			&size,
+			reinterpret_cast<Bytef const*>(raw.data()),
+			static_cast<uLong>(raw.size()),
+			level);
+		if (status != Z_OK) {
+			throw std::runtime_error{fmt::format("Could not compress chunk (zlib error {}).", status)};
+		}
+		compressed.resize(size);
+		return compressed;
+	}
+#else
+	(void)raw;
+	(void)compression;
+	(void)level;
+#endif
+	throw std::invalid_argument{"Compression is not supported."};
+}
+
+auto write_file_header(std::ofstream& file, std::vector<ColumnSchema> const& schema) -> void {
+	auto header = format::FileHeader{};
+	std::copy(std::begin(format::file_magic), std::end(format::file_magic), std::begin(header.magic));
+	header.version = format::version;
+	header.n_columns = static_cast<std::uint32_t>(schema.size());
+	file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+	for (auto const& column : schema) {
+		auto column_header = format::ColumnHeader{};
+		std::copy(column.name.begin(), column.name.end(), std::begin(column_header.name));
+		column_header.kind = column.dtype.kind;
+		column_header.itemsize = column.dtype.itemsize;
+		column_header.ndim = column.ndim;
+		file.write(reinterpret_cast<char const*>(&column_header), sizeof(column_header));
+	}
+}
+
+}  // namespace
+
+auto supports(Compression compression) noexcept -> bool {
+	switch (compression) {
+	case Compression::none:
+		return true;
+	case Compression::zlib:
+#ifdef ECOLE_HAS_ZLIB
+		return true;
+#else
+		return false;
+#endif
+	}
+	return false;
+}
+
+/**********************************
+ *  Definition of DatasetWriter  *
+ **********************************/
+
+DatasetWriter::DatasetWriter(std::filesystem::path directory, Parameters parameters_) :
+	the_directory{std::move(directory)}, parameters{parameters_}, chunk{0, 0, {}} {
+	if ((parameters.samples_per_chunk == 0) || (parameters.samples_per_shard == 0) ||
+		(parameters.max_pending_chunks == 0)) {
+		throw std::invalid_argument{"Number of samples per chunk and shard, and of pending chunks must be positive."};
+	}
+	if (!supports(parameters.compression)) {
+		throw std::invalid_argument{"Ecole was compiled without support for the requested compression."};
+	}
+	std::filesystem::create_directories(the_directory);
+	if (std::filesystem::exists(shard_path(the_directory, 0))) {
+		throw std::invalid_argument{fmt::format("Directory {} already contains a dataset.", the_directory.string())};
+	}
+	io_thread = std::thread{[this] { write_chunks(); }};
+}
+
+DatasetWriter::DatasetWriter(std::filesystem::path directory) : DatasetWriter{std::move(directory), Parameters{}} {}
+
+DatasetWriter::~DatasetWriter() {
+	try {
+		close();
+	} catch (std::exception const&) {
+		// Errors can only be reported by calling close explicitly
+	}
+}
+
+auto DatasetWriter::append(Sample const& sample) -> void {
+	auto const lock = std::lock_guard{writer_mutex};
+	if (closed) {
+		throw std::logic_error{"Cannot append samples to a closed DatasetWriter."};
+	}
+	rethrow_io_error();
+	if (the_schema.empty()) {
+		the_schema = to_schema(sample);
+		chunk.columns.resize(the_schema.size());
+	}
+	if (sample.size() != the_schema.size()) {
+		throw std::invalid_argument{fmt::format(
+			"Sample has {} columns, while the first sample had {}.", sample.size(), the_schema.size())};
+	}
+	for (std::size_t i = 0; i < sample.size(); ++i) {
+		check_column(sample[i], the_schema[i]);
+	}
+
+	for (std::size_t i = 0; i < sample.size(); ++i) {
+		auto const& column = sample[i];
+		auto& chunk_column = chunk.columns[i];
+		chunk_column.shapes.insert(chunk_column.shapes.end(), column.shape.begin(), column.shape.end());
+		chunk_column.data.insert(chunk_column.data.end(), column.data.begin(), column.data.end());
+		chunk_column.offsets.push_back(chunk_column.data.size());
+	}
+	++chunk.n_samples;
+	++the_n_samples;
+
+	if (
+		(chunk.n_samples == parameters.samples_per_chunk) ||
+		(samples_in_shard + chunk.n_samples == parameters.samples_per_shard)) {
+		push_chunk();
+	}
+}
+
+auto DatasetWriter::flush() -> void {
+	auto const lock = std::lock_guard{writer_mutex};
+	flush_locked();
+}
+
+auto DatasetWriter::close() -> void {
+	auto const lock = std::lock_guard{writer_mutex};
+	if (closed) {
+		return;
+	}
+	auto error = std::exception_ptr{};
+	try {
+		flush_locked();
+	} catch (...) {
+		error = std::current_exception();
+	}
+	{
+		auto const queue_lock = std::lock_guard{queue_mutex};
+		stopping = true;
+	}
+	queue_changed.notify_all();
+	io_thread.join();
+	closed = true;
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+/** Flush, with the writer mutex held. */
+auto DatasetWriter::flush_locked() -> void {
+	if (closed) {
+		return;
+	}
+	if (chunk.n_samples > 0) {
+		push_chunk();
+	}
+	auto lock = std::unique_lock{queue_mutex};
+	queue_changed.wait(lock, [this] { return (queue.empty() && !writing) || io_error; });
+	lock.unlock();
+	rethrow_io_error();
+}
+
+auto DatasetWriter::push_chunk() -> void {
+	auto const shard = chunk.shard;
+	samples_in_shard += chunk.n_samples;
+	auto next_shard = shard;
+	if (samples_in_shard >= parameters.samples_per_shard) {
+		samples_in_shard = 0;
+		++next_shard;
+	}
+	{
+		auto lock = std::unique_lock{queue_mutex};
+		queue_changed.wait(lock, [this] { return (queue.size() < parameters.max_pending_chunks) || io_error; });
+		if (!io_error) {
+			queue.push_back(std::exchange(chunk, {next_shard, 0, std::vector<ChunkColumn>(the_schema.size())}));
+		}
+	}
+	queue_changed.notify_all();
+	rethrow_io_error();
+}
+
+auto DatasetWriter::encode(Chunk const& to_encode) const -> std::vector<std::byte> {
+	auto const n_columns = the_schema.size();
+	auto column_offsets = std::vector<std::uint64_t>(n_columns);
+	auto size = format::column_offsets_size(n_columns);
+	for (std::size_t i = 0; i < n_columns; ++i) {
+		column_offsets[i] = size;
+		size += format::column_index_size(to_encode.n_samples, the_schema[i].ndim) +
+						format::align(to_encode.columns[i].data.size());
+	}
+
+	auto payload = std::vector<std::byte>(size);
+	std::memcpy(payload.data(), column_offsets.data(), n_columns * sizeof(std::uint64_t));
+	for (std::size_t i = 0; i < n_columns; ++i) {
+		auto const& column = to_encode.columns[i];
+		auto* const block = payload.data() + column_offsets[i];
+		auto* const offsets = std::copy_n(
+			reinterpret_cast<std::byte const*>(column.shapes.data()), column.shapes.size() * sizeof(std::uint64_t), block);
+		std::copy_n(
+			reinterpret_cast<std::byte const*>(column.offsets.data()), column.offsets.size() * sizeof(std::uint64_t), offsets);
+		auto* const data = block + format::column_index_size(to_encode.n_samples, the_schema[i].ndim);
+		std::copy(column.data.begin(), column.data.end(), data);
+	}
+	return payload;
+}
+
+auto DatasetWriter::rethrow_io_error() -> void {
+	auto const lock = std::lock_guard{queue_mutex};
+	if (io_error) {
+		std::rethrow_exception(io_error);
+	}
+}
+
+/** Body of the background thread, writing chunks until stopped. */
+auto DatasetWriter::write_chunks() -> void {
+	auto file = std::ofstream{};
+	auto current_shard = std::optional<std::size_t>{};
+	auto lock = std::unique_lock{queue_mutex};
+	while (true) {
+		queue_changed.wait(lock, [this] { return stopping || !queue.empty(); });
+		if (queue.empty()) {
+			return;
+		}
+		auto to_write = std::move(queue.front());
+		queue.pop_front();
+		writing = true;
+		lock.unlock();
+
+		auto error = std::exception_ptr{};
+		try {
+			if (current_shard != to_write.shard) {
+				auto const path = shard_path(the_directory, to_write.shard);
+				file = std::ofstream{path, std::ios::binary | std::ios::trunc};
+				write_file_header(file, the_schema);
+				current_shard = to_write.shard;
+			}
+			auto const raw = encode(to_write);
+			auto const compressed = (parameters.compression == Compression::none) ?
+																std::vector<std::byte>{} :
+																compress(raw, parameters.compression, parameters.compression_level);
+			auto const& stored = (parameters.compression == Compression::none) ? raw : compressed;
+			auto header = format::ChunkHeader{};
+			header.magic = format::chunk_magic;
+			header.compression = static_cast<std::uint32_t>(parameters.compression);
+			header.n_samples = to_write.n_samples;
+			header.raw_size = raw.size();
+			header.stored_size = stored.size();
+			auto const padding = std::vector<char>(format::align(stored.size()) - stored.size(), 0);
+			file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			file.write(reinterpret_cast<char const*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+			file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+			// Readers only see complete chunks
+			file.flush();
+			if (!file) {
+				throw std::runtime_error{
+					fmt::format("Could not write to {}.", shard_path(the_directory, to_write.shard).string())};
+			}
+		} catch (...) {
+			error = std::current_exception();
+		}
+
+		lock.lock();
+		writing = false;
+		if (error) {
+			io_error = error;
+			queue.clear();
+		}
+		queue_changed.notify_all();
+	}
+}
+
+}  // namespace ecole::dataset
@@ -1,5 +1,9 @@
 #include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <exception>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 #include <xtensor/xtensor.hpp>
@@ -7,9 +11,17 @@
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
+#include "ecole/utility/tracing.hpp"
 
 namespace ecole::dynamics {
 
+auto PolicyStatistics::mean_time() const noexcept -> double {
+	if (n_decisions == 0) {
+		return 0.;
+	}
+	return total_time / static_cast<double>(n_decisions);
+}
+
 BranchingDynamics::BranchingDynamics(bool pseudo_candidates_) noexcept : pseudo_candidates(pseudo_candidates_) {}
 
 namespace {
@@ -46,34 +58,83 @@ auto keep_solving_until_next_LP_callback(scip::Model& model, FCall& fcall, bool
 	return {true, {}};
 }
 
+/** Branch on the given variable index, or let SCIP branch if Default is passed. */
+auto branch(scip::Model& model, Defaultable<std::size_t> maybe_var_idx) -> SCIP_RESULT {
+	// Default fallback to SCIP default branching
+	if (!std::holds_alternative<std::size_t>(maybe_var_idx)) {
+		return SCIP_DIDNOTRUN;
+	}
+	auto const var_idx = std::get<std::size_t>(maybe_var_idx);
+	auto const vars = model.variables();
+	// Error handling
+	if (var_idx >= vars.size()) {
+		throw std::invalid_argument{
+			fmt::format("Branching candidate index {} larger than the number of variables ({}).", var_idx, vars.size())};
+	}
+	// Branching
+	scip::call(SCIPbranchVar, model.get_scip_ptr(), vars[var_idx], nullptr, nullptr, nullptr);
+	return SCIP_BRANCHED;
+}
+
 }  // namespace
 
 auto BranchingDynamics::reset_dynamics(scip::Model& model) const -> std::tuple<bool, ActionSet> {
+	ECOLE_TRACE_SPAN("BranchingDynamics::reset_dynamics", "dynamics");
 	auto fcall = model.solve_iter(scip::callback::BranchruleConstructor{});
 	return keep_solving_until_next_LP_callback(model, fcall, pseudo_candidates);
 }
 
 auto BranchingDynamics::step_dynamics(scip::Model& model, Defaultable<std::size_t> maybe_var_idx) const
 	-> std::tuple<bool, ActionSet> {
-	// Default fallback to SCIP default branching
-	auto scip_result = SCIP_DIDNOTRUN;
-
-	if (std::holds_alternative<std::size_t>(maybe_var_idx)) {
-		auto const var_idx = std::get<std::size_t>(maybe_var_idx);
-		auto const vars = model.variables();
-		// Error handling
-		if (var_idx >= vars.size()) {
-			throw std::invalid_argument{
-				fmt::format("Branching candidate index {} larger than the number of variables ({}).", var_idx, vars.size())};
-		}
-		// Branching
-		scip::call(SCIPbranchVar, model.get_scip_ptr(), vars[var_idx], nullptr, nullptr, nullptr);
-		scip_result = SCIP_BRANCHED;
-	}
-
+	ECOLE_TRACE_SPAN("BranchingDynamics::step_dynamics", "dynamics");
+	auto const scip_result = branch(model, std::move(maybe_var_idx));
 	// Looping until the next LP branchrule rule callback, if it exists.
 	auto fcall = model.solve_iter_continue(scip_result);
 	return keep_solving_until_next_LP_callback(model, fcall, pseudo_candidates);
 }
 
+auto BranchingDynamics::solve_with_policy(scip::Model& model, Policy policy) const -> PolicyStatistics {
+	using Call = scip::callback::BranchruleCall;
+	using Clock = std::chrono::steady_clock;
+
+	auto stats = PolicyStatistics{};
+	// Exceptions cannot cross SCIP, they are stored and rethrown after solving.
+	auto policy_exception = std::exception_ptr{};
+
+	auto handler = [&](Call const& call) -> SCIP_RESULT {
+		// Same as the iterative dynamics, only LP branching is given to the policy.
+		if (call.where != Call::Where::LP) {
+			return SCIP_DIDNOTRUN;
+		}
+		try {
+			auto const start = Clock::now();
+			auto const scip_result = branch(model, policy(model, action_set(model, pseudo_candidates).value()));
+			auto const elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+			stats.n_decisions++;
+			stats.total_time += elapsed;
+			stats.max_time = std::max(stats.max_time, elapsed);
+			return scip_result;
+		} catch (...) {
+			policy_exception = std::current_exception();
+			throw;
+		}
+	};
+
+	try {
+		[[maybe_unused]] auto const fcall = model.solve_iter(scip::callback::BranchruleConstructor{
+			scip::callback::priority_max,
+			scip::callback::max_depth_none,
+			scip::callback::max_bound_distance_none,
+			handler,
+		});
+		assert(!fcall.has_value());
+	} catch (...) {
+		if (policy_exception) {
+			std::rethrow_exception(policy_exception);
+		}
+		throw;
+	}
+	return stats;
+}
+
 }  // namespace ecole::dynamics
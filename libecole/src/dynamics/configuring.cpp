@@ -1,5 +1,22 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <objscip/objeventhdlr.h>
+#include <scip/scip.h>
+
 #include "ecole/dynamics/configuring.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/utils.hpp"
+#include "ecole/utility/thread-pool.hpp"
+#include "ecole/utility/tracing.hpp"
 
 namespace ecole::dynamics {
 
@@ -9,6 +26,7 @@ auto ConfiguringDynamics::reset_dynamics(scip::Model& /* model */) const -> std:
 
 auto ConfiguringDynamics::step_dynamics(scip::Model& model, ParamDict const& param_dict) const
 	-> std::tuple<bool, NoneType> {
+	ECOLE_TRACE_SPAN("ConfiguringDynamics::step_dynamics", "dynamics");
 	for (auto const& [name, value] : param_dict) {
 		model.set_param(name, value);
 	}
@@ -16,4 +34,199 @@ auto ConfiguringDynamics::step_dynamics(scip::Model& model, ParamDict const& par
 	return {true, None};
 }
 
+namespace {
+
+/** Nodes solved by a configuration before it can be found dominated, as bounds are loose at the start. */
+constexpr long long dominance_min_nodes = 100;
+/** A configuration is dominated if another has better bounds, with a gap smaller by this factor. */
+constexpr double dominance_gap_ratio = 0.5;
+
+/** Last bounds of a configuration, in the minimization sense, read by the other configurations. */
+struct RacerBounds {
+	std::atomic<double> primal{std::numeric_limits<double>::infinity()};
+	std::atomic<double> dual{-std::numeric_limits<double>::infinity()};
+	/** Set when the configuration is interrupted because it is dominated. */
+	std::atomic<bool> dominated{false};
+
+	/** Whether these bounds are both at least as tight as the given ones, with a much smaller gap. */
+	[[nodiscard]] auto dominates(double other_primal, double other_dual) const noexcept -> bool {
+		auto const own_primal = primal.load(std::memory_order_relaxed);
+		auto const own_dual = dual.load(std::memory_order_relaxed);
+		return (own_primal <= other_primal) && (own_dual >= other_dual) &&
+					 (own_primal - own_dual < dominance_gap_ratio * (other_primal - other_dual));
+	}
+};
+
+/** State shared between all configurations of a race. */
+struct RaceState {
+	explicit RaceState(std::size_t n_racers) : racers(n_racers) {}
+
+	/** Set by the first configuration to solve the instance. */
+	std::atomic<bool> finished{false};
+	std::vector<RacerBounds> racers;
+};
+
+/**
+ * Event handler that compares the progress of configurations at every node.
+ *
+ * Solving is interrupted when the race is over, or when the configuration is dominated by another.
+ */
+class RaceEventHandler : public ::scip::ObjEventhdlr {
+public:
+	inline static auto constexpr name = "ecole::dynamics::RaceEventHandler";
+
+	RaceEventHandler(SCIP* scip, std::shared_ptr<RaceState> race_, std::size_t index_) :
+		ObjEventhdlr(scip, name, "Event handler for interrupting dominated configurations"),
+		race{std::move(race_)},
+		index{index_} {}
+
+	auto scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE override {
+		return SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODESOLVED, eventhdlr, nullptr, nullptr);
+	}
+
+	auto scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE override {
+		return SCIPdropEvent(scip, SCIP_EVENTTYPE_NODESOLVED, eventhdlr, nullptr, -1);
+	}
+
+	auto scip_exec(SCIP* scip, SCIP_EVENTHDLR* /*eventhdlr*/, SCIP_EVENT* /*event*/, SCIP_EVENTDATA* /*eventdata*/)
+		-> SCIP_RETCODE override {
+		if (race->finished.load(std::memory_order_relaxed)) {
+			return SCIPinterruptSolve(scip);
+		}
+
+		// All configurations solve the same problem, so their bounds can be compared
+		auto const sense = static_cast<double>(SCIPgetObjsense(scip));
+		auto const primal = sense * SCIPgetPrimalbound(scip);
+		auto const dual = sense * SCIPgetDualbound(scip);
+		auto& own = race->racers[index];
+		own.primal.store(primal, std::memory_order_relaxed);
+		own.dual.store(dual, std::memory_order_relaxed);
+
+		if (SCIPgetNNodes(scip) < dominance_min_nodes) {
+			return SCIP_OKAY;
+		}
+		for (std::size_t other = 0; other < race->racers.size(); ++other) {
+			if ((other != index) && race->racers[other].dominates(primal, dual)) {
+				own.dominated = true;
+				return SCIPinterruptSolve(scip);
+			}
+		}
+		return SCIP_OKAY;
+	}
+
+private:
+	std::shared_ptr<RaceState> race;
+	std::size_t index;
+};
+
+auto race_metrics(scip::Model& model, bool interrupted) -> RaceMetrics {
+	auto* const scip = model.get_scip_ptr();
+	if (SCIPgetStage(scip) < SCIP_STAGE_TRANSFORMED) {
+		// Never started solving
+		return {false, interrupted};
+	}
+	return {
+		model.is_solved(),
+		interrupted,
+		SCIPgetSolvingTime(scip),
+		model.primal_bound(),
+		model.dual_bound(),
+		SCIPgetGap(scip),
+		SCIPgetNNodes(scip),
+		SCIPgetNLPIterations(scip),
+	};
+}
+
+/** Index of the configuration with the smallest gap, then smallest solving time. */
+auto best_gap(std::vector<RaceMetrics> const& metrics) -> std::size_t {
+	auto const key = [](auto const& m) { return std::tuple{std::isnan(m.gap), m.gap, m.solving_time}; };
+	auto const best = std::min_element(
+		metrics.begin(), metrics.end(), [&key](auto const& a, auto const& b) { return key(a) < key(b); });
+	return static_cast<std::size_t>(std::distance(metrics.begin(), best));
+}
+
+}  // namespace
+
+auto ConfiguringDynamics::race(
+	scip::Model const& model,
+	std::vector<ParamDict> const& configurations,
+	std::size_t n_threads) const -> RaceResult {
+	if (configurations.empty()) {
+		throw std::invalid_argument{"Racing requires at least one configuration."};
+	}
+	if (model.stage() != SCIP_STAGE_PROBLEM) {
+		throw std::invalid_argument{"Racing requires a model in problem stage."};
+	}
+
+	auto const base_params = model.get_params();
+	auto race_state = std::make_shared<RaceState>(configurations.size());
+	auto winner = std::atomic<std::size_t>{configurations.size()};
+
+	// Copies are created upfront since copying is serialized anyway
+	auto models = std::vector<scip::Model>{};
+	models.reserve(configurations.size());
+	for (std::size_t i = 0; i < configurations.size(); ++i) {
+		auto& copy = models.emplace_back(model.copy_orig());
+		copy.set_params(base_params);
+		copy.set_params(configurations[i]);
+		auto handler = std::make_unique<RaceEventHandler>(copy.get_scip_ptr(), race_state, i);
+		scip::call(SCIPincludeObjEventhdlr, copy.get_scip_ptr(), handler.get(), true);
+		// NOLINTNEXTLINE memory ownership is passed to SCIP
+		handler.release();
+	}
+
+	auto metrics = std::vector<RaceMetrics>(models.size());
+	auto const solve_one = [&models, &race_state, &winner, &metrics](std::size_t i) {
+		auto& racer = models[i];
+		// Configurations that start after the race is over are not solved
+		if (!race_state->finished.load()) {
+			try {
+				racer.solve();
+			} catch (...) {
+				// Stop the other configurations, the error is reported to the caller
+				race_state->finished = true;
+				throw;
+			}
+		}
+		if (racer.is_solved() && !race_state->finished.exchange(true)) {
+			winner = i;
+		}
+		auto const interrupted =
+			race_state->racers[i].dominated.load() || (!racer.is_solved() && race_state->finished.load());
+		metrics[i] = race_metrics(racer, interrupted);
+	};
+	// Workers take the next configuration to solve until none is left
+	auto next = std::atomic<std::size_t>{0};
+	auto const solve_remaining = [&solve_one, &next, n_models = models.size()] {
+		for (auto i = next++; i < n_models; i = next++) {
+			solve_one(i);
+		}
+	};
+
+	auto& pool = utility::ThreadPool::shared();
+	if (utility::ThreadPool::in_worker_thread()) {
+		// Waiting on the shared pool from one of its workers could deadlock
+		solve_remaining();
+	} else {
+		auto const n_workers = std::clamp<std::size_t>(n_threads == 0 ? pool.size() : n_threads, 1, models.size());
+		auto futures = std::vector<std::future<void>>{};
+		futures.reserve(n_workers);
+		for (std::size_t i = 0; i < n_workers; ++i) {
+			futures.push_back(pool.submit(solve_remaining));
+		}
+		// Wait for all workers before rethrowing, as they refer to this stack
+		for (auto& fut : futures) {
+			fut.wait();
+		}
+		for (auto& fut : futures) {
+			fut.get();
+		}
+	}
+
+	auto result = RaceResult{};
+	result.metrics = std::move(metrics);
+	result.winner = winner < configurations.size() ? winner.load() : best_gap(result.metrics);
+	return result;
+}
+
 }  // namespace ecole::dynamics
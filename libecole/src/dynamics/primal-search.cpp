@@ -10,6 +10,7 @@
 #include "ecole/scip/callback.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
+#include "ecole/utility/tracing.hpp"
 
 namespace ecole::dynamics {
 
@@ -49,9 +50,69 @@ auto add_solution_from_lp(SCIP* scip) -> bool {
 	return solution_kept;
 }
 
+void check_action(PrimalSearchDynamics::Action const& action, std::size_t n_vars) {
+	auto const [var_indices, vals] = action;
+
+	// check that both spans have same size
+	if (var_indices.size() != vals.size()) {
+		throw std::invalid_argument{
+			fmt::format("Invalid action: {} variable indices for {} values.", var_indices.size(), vals.size())};
+	}
+
+	// check that variable indices are within range
+	for (auto const var_id : var_indices) {
+		if (var_id >= n_vars) {
+			throw std::invalid_argument{fmt::format("Invalid action: variable index {} is out of range.", var_id)};
+		}
+	}
+}
+
+/**
+ * Fix the (partial) solution in a new probing node, propagate, and try the LP solution.
+ *
+ * Must be called in probing mode, the caller is responsible for backtracking or ending probing.
+ */
+auto probe(SCIP* scip, nonstd::span<SCIP_VAR*> problem_vars, PrimalSearchDynamics::Action const& action)
+	-> PrimalSearchTrial {
+	auto const [var_indices, vals] = action;
+	auto trial = PrimalSearchTrial{};
+	SCIP_Bool lperror = false;
+	SCIP_Bool cutoff = false;
+
+	scip::call(SCIPnewProbingNode, scip);
+
+	// fix variables in the (partial) solution to their given values
+	for (std::size_t i = 0; i < var_indices.size(); i++) {
+		scip::call(SCIPfixVarProbing, scip, problem_vars[var_indices[i]], vals[i]);
+	}
+
+	// propagate
+	scip::call(SCIPpropagateProbing, scip, 0, &cutoff, nullptr);
+	if (cutoff) {
+		return trial;
+	}
+	// build the LP if needed
+	if (!SCIPisLPConstructed(scip)) {
+		scip::call(SCIPconstructLP, scip, &cutoff);
+		if (cutoff) {
+			return trial;
+		}
+	}
+	// solve the LP
+	scip::call(SCIPsolveProbingLP, scip, -1, &lperror, &cutoff);
+	if (!lperror && !cutoff) {
+		trial.lp_solved = true;
+		trial.objective = SCIPretransformObj(scip, SCIPgetLPObjval(scip));
+		// try the LP solution in the original problem
+		trial.solution_kept = add_solution_from_lp(scip);
+	}
+	return trial;
+}
+
 }  // namespace
 
 auto PrimalSearchDynamics::reset_dynamics(scip::Model& model) const -> std::tuple<bool, ActionSet> {
+	ECOLE_TRACE_SPAN("PrimalSearchDynamics::reset_dynamics", "dynamics");
 	if (trials_per_node == 0) {
 		model.solve();
 		return {true, {}};
@@ -69,63 +130,69 @@ auto PrimalSearchDynamics::reset_dynamics(scip::Model& model) const -> std::tupl
 }
 
 auto PrimalSearchDynamics::step_dynamics(scip::Model& model, Action action) -> std::tuple<bool, ActionSet> {
-	auto const [var_indices, vals] = action;
+	ECOLE_TRACE_SPAN("PrimalSearchDynamics::step_dynamics", "dynamics");
 	auto problem_vars = model.variables();
-
-	// check that both spans have same size
-	if (var_indices.size() != vals.size()) {
-		throw std::invalid_argument{
-			fmt::format("Invalid action: {} variable indices for {} values.", var_indices.size(), vals.size())};
-	}
-
-	// check that variable indices are within range
-	for (auto const var_id : var_indices) {
-		if (var_id >= problem_vars.size()) {
-			throw std::invalid_argument{fmt::format("Invalid action: variable index {} is out of range.", var_id)};
-		}
-	}
+	check_action(action, problem_vars.size());
 
 	auto* scip_ptr = model.get_scip_ptr();
 	auto solution_kept = false;  // result of the current action (solution found or not)
 
 	// if the action is not empty, run a search iteration
 	// try to improve the (partial) solution by fixing variables and then re-solving the LP
-	if (not var_indices.empty()) {
-		SCIP_Bool lperror = false;
-		SCIP_Bool cutoff = false;
-
-		// enter probing mode
+	if (not action.first.empty()) {
 		scip::call(SCIPstartProbing, scip_ptr);
-
-		// fix variables in the (partial) solution to their given values
-		for (std::size_t i = 0; i < var_indices.size(); i++) {
-			auto id = var_indices[i];
-			auto* var = problem_vars[id];
-			auto val = vals[i];
-			scip::call(SCIPfixVarProbing, scip_ptr, var, val);
+		try {
+			solution_kept = probe(scip_ptr, problem_vars, action).solution_kept;
+		} catch (std::exception const&) {
+			scip::call(SCIPendProbing, scip_ptr);
+			throw;
 		}
+		scip::call(SCIPendProbing, scip_ptr);
+	}
 
-		// propagate
-		scip::call(SCIPpropagateProbing, scip_ptr, 0, &cutoff, nullptr);
-		if (!cutoff) {
-			// build the LP if needed
-			if (!SCIPisLPConstructed(scip_ptr)) {
-				scip::call(SCIPconstructLP, scip_ptr, &cutoff);
-			}
-			if (!cutoff) {
-				// solve the LP
-				scip::call(SCIPsolveProbingLP, scip_ptr, -1, &lperror, &cutoff);
-				if (!lperror && !cutoff) {
-					// try the LP solution in the original problem
-					solution_kept = add_solution_from_lp(scip_ptr);
+	return end_trial(model, solution_kept);
+}
+
+auto PrimalSearchDynamics::step_batch_dynamics(scip::Model& model, std::vector<Action> const& actions)
+	-> std::tuple<bool, ActionSet, std::vector<PrimalSearchTrial>> {
+	ECOLE_TRACE_SPAN("PrimalSearchDynamics::step_batch_dynamics", "dynamics");
+	auto problem_vars = model.variables();
+	// validate the whole batch before touching the solver
+	for (auto const& action : actions) {
+		check_action(action, problem_vars.size());
+	}
+
+	auto* scip_ptr = model.get_scip_ptr();
+	auto trials = std::vector<PrimalSearchTrial>(actions.size());
+	auto solution_kept = false;
+
+	// a single probing session for all candidates, the LP solver state is kept when backtracking
+	if (std::any_of(actions.begin(), actions.end(), [](auto const& action) { return !action.first.empty(); })) {
+		scip::call(SCIPstartProbing, scip_ptr);
+		try {
+			for (std::size_t i = 0; i < actions.size(); ++i) {
+				if (actions[i].first.empty()) {
+					continue;
+				}
+				trials[i] = probe(scip_ptr, problem_vars, actions[i]);
+				solution_kept = solution_kept || trials[i].solution_kept;
+				scip::call(SCIPbacktrackProbing, scip_ptr, 0);
+				if (SCIPisStopped(scip_ptr)) {
+					break;
 				}
 			}
+		} catch (std::exception const&) {
+			scip::call(SCIPendProbing, scip_ptr);
+			throw;
 		}
-
-		// exit probing mode
 		scip::call(SCIPendProbing, scip_ptr);
 	}
 
+	auto [done, action_set] = end_trial(model, solution_kept);
+	return {done, std::move(action_set), std::move(trials)};
+}
+
+auto PrimalSearchDynamics::end_trial(scip::Model& model, bool solution_kept) -> std::tuple<bool, ActionSet> {
 	// update the final search result depending on the action result
 	if (solution_kept) {
 		result = SCIP_FOUNDSOL;
@@ -137,7 +204,7 @@ auto PrimalSearchDynamics::step_dynamics(scip::Model& model, Action action) -> s
 	trials_spent++;
 
 	// if all trials are exhausted, or if SCIP should be stopped, stop the search and let SCIP proceed
-	if ((trials_spent == static_cast<unsigned int>(trials_per_node)) || SCIPisStopped(scip_ptr)) {
+	if ((trials_spent == static_cast<unsigned int>(trials_per_node)) || SCIPisStopped(model.get_scip_ptr())) {
 		// reset data for the next time the search is triggered
 		trials_spent = 0;
 		result = SCIP_DIDNOTRUN;
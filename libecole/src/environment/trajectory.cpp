@@ -0,0 +1,65 @@
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <scip/scip.h>
+
+#include "ecole/environment/trajectory.hpp"
+#include "ecole/scip/utils.hpp"
+
+namespace ecole::environment {
+
+namespace {
+
+/** Print the original problem in the CIP format to memory, without creating a file. */
+auto print_cip(scip::Model const& model) -> std::string {
+	char* buffer = nullptr;
+	auto size = std::size_t{0};
+	auto* const stream = open_memstream(&buffer, &size);
+	if (stream == nullptr) {
+		throw std::system_error{{errno, std::generic_category()}, "Could not open memory stream"};
+	}
+	try {
+		scip::call(SCIPprintOrigProblem, const_cast<SCIP*>(model.get_scip_ptr()), stream, "cip", true);
+	} catch (...) {
+		std::fclose(stream);
+		std::free(buffer);  // NOLINT(cppcoreguidelines-no-malloc) allocated by open_memstream
+		throw;
+	}
+	// The buffer and size are only valid once the stream is closed
+	std::fclose(stream);
+	auto content = std::string{buffer, size};
+	std::free(buffer);  // NOLINT(cppcoreguidelines-no-malloc) allocated by open_memstream
+	return content;
+}
+
+/** 64 bits FNV-1a hash. */
+auto fnv1a(std::string_view data) noexcept -> std::uint64_t {
+	constexpr auto offset_basis = std::uint64_t{14695981039346656037ULL};
+	constexpr auto prime = std::uint64_t{1099511628211ULL};
+	auto hash = offset_basis;
+	for (auto const byte : data) {
+		hash ^= static_cast<std::uint8_t>(byte);
+		hash *= prime;
+	}
+	return hash;
+}
+
+}  // namespace
+
+auto fingerprint(scip::Model const& model) -> std::uint64_t {
+	auto const cip = print_cip(model);
+	// Skip the statistics section, which holds the problem name (often the path of the file it was read from)
+	auto content = std::string_view{cip};
+	if (auto const objective = content.find("\nOBJECTIVE"); objective != std::string_view::npos) {
+		content.remove_prefix(objective);
+	}
+	return fnv1a(content);
+}
+
+}  // namespace ecole::environment
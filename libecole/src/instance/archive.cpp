@@ -0,0 +1,439 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#ifdef ECOLE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/archive.hpp"
+
+#include "instance/metrics.hpp"
+
+namespace ecole::instance {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/*********************************
+ *  Binary layout of archives  *
+ *********************************/
+
+constexpr char archive_magic[8] = "ECOLEAR";  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+constexpr std::uint32_t archive_version = 2;
+
+/** Header at the beginning of the archive, pointing to the index at its end. */
+struct ArchiveHeader {
+	char magic[8];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+	std::uint32_t version;
+	std::uint32_t reserved0;
+	std::uint64_t n_instances;
+	std::uint64_t index_offset;
+	char reserved[32];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+static_assert(sizeof(ArchiveHeader) == 64);
+
+/** Entry of the index, one per instance, whose name is stored right before its content. */
+struct IndexEntry {
+	std::uint64_t offset;
+	std::uint64_t stored_size;
+	std::uint64_t raw_size;
+	std::uint32_t name_size;
+	std::uint32_t compressed;
+	char extension[16];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+static_assert(sizeof(IndexEntry) == 48);
+
+template <typename T> auto read_as(std::byte const* data) -> T {
+	auto value = T{};
+	std::memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+/** A file descriptor closed on destruction, and the temporary file it refers to, if any, removed. */
+class FileDescriptor {
+public:
+	explicit FileDescriptor(int fd_, std::string path_ = {}, bool temporary_ = false) noexcept :
+		fd{fd_}, the_path{std::move(path_)}, temporary{temporary_} {}
+	FileDescriptor(FileDescriptor const&) = delete;
+	FileDescriptor(FileDescriptor&&) = delete;
+	~FileDescriptor() {
+		::close(fd);
+		if (temporary) {
+			::unlink(the_path.c_str());
+		}
+	}
+	auto operator=(FileDescriptor const&) -> FileDescriptor& = delete;
+	auto operator=(FileDescriptor&&) -> FileDescriptor& = delete;
+
+	[[nodiscard]] auto get() const noexcept -> int { return fd; }
+	/** A path to the file, which SCIP can open. */
+	[[nodiscard]] auto path() const noexcept -> std::string const& { return the_path; }
+
+private:
+	int fd;
+	std::string the_path;
+	bool temporary;
+};
+
+/**
+ * Create an anonymous file in memory.
+ *
+ * Without memfd_create (outside of Linux), a temporary file is created instead, and removed when closed.
+ * It is only unlinked then, as SCIP opens files from their path.
+ */
+auto memory_file(char const* name) -> FileDescriptor {
+#ifdef __linux__
+	auto const fd = memfd_create(name, MFD_CLOEXEC);
+	if (fd < 0) {
+		throw std::system_error{{errno, std::generic_category()}, "Could not create in-memory file"};
+	}
+	return FileDescriptor{fd, fmt::format("/proc/self/fd/{}", fd)};
+#else
+	auto path = (fs::temp_directory_path() / fmt::format("{}-XXXXXX", name)).string();
+	auto const fd = ::mkstemp(path.data());
+	if (fd < 0) {
+		throw std::system_error{{errno, std::generic_category()}, "Could not create temporary file"};
+	}
+	::fcntl(fd, F_SETFD, FD_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+	return FileDescriptor{fd, std::move(path), true};
+#endif
+}
+
+auto write_all(FileDescriptor const& file, std::byte const* data, std::size_t size) -> void {
+	while (size > 0) {
+		auto const written = ::write(file.get(), data, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			throw std::system_error{{errno, std::generic_category()}, "Could not write in-memory file"};
+		}
+		data += written;
+		size -= static_cast<std::size_t>(written);
+	}
+}
+
+auto read_all(FileDescriptor const& file) -> std::vector<std::byte> {
+	struct stat status = {};
+	if (fstat(file.get(), &status) != 0) {
+		throw std::system_error{{errno, std::generic_category()}, "Could not read in-memory file"};
+	}
+	auto content = std::vector<std::byte>(static_cast<std::size_t>(status.st_size));
+	auto read = std::size_t{0};
+	while (read < content.size()) {
+		auto const n = ::pread(file.get(), content.data() + read, content.size() - read, static_cast<off_t>(read));
+		if (n <= 0) {
+			if ((n < 0) && (errno == EINTR)) {
+				continue;
+			}
+			throw std::system_error{{errno, std::generic_category()}, "Could not read in-memory file"};
+		}
+		read += static_cast<std::size_t>(n);
+	}
+	return content;
+}
+
+auto compress(std::vector<std::byte> const& raw, int level) -> std::vector<std::byte> {
+#ifdef ECOLE_HAS_ZLIB
+	auto size = compressBound(static_cast<uLong>(raw.size()));
+	auto compressed = std::vector<std::byte>(size);
+	auto const status = compress2(
+		reinterpret_cast<Bytef*>(compressed.data()),
+		&size,
+		reinterpret_cast<Bytef const*>(raw.data()),
+		static_cast<uLong>(raw.size()),
+		level);
+	if (status != Z_OK) {
+		throw std::runtime_error{fmt::format("Could not compress instance (zlib error {}).", status)};
+	}
+	compressed.resize(size);
+	return compressed;
+#else
+	(void)level;
+	return raw;
+#endif
+}
+
+auto decompress(std::byte const* stored, std::size_t stored_size, std::size_t raw_size) -> std::vector<std::byte> {
+#ifdef ECOLE_HAS_ZLIB
+	auto raw = std::vector<std::byte>(raw_size);
+	auto size = static_cast<uLongf>(raw_size);
+	auto const status = uncompress(
+		reinterpret_cast<Bytef*>(raw.data()), &size, reinterpret_cast<Bytef const*>(stored), static_cast<uLong>(stored_size));
+	if ((status != Z_OK) || (size != raw_size)) {
+		throw std::runtime_error{fmt::format("Could not decompress instance (zlib error {}).", status)};
+	}
+	return raw;
+#else
+	(void)stored;
+	(void)stored_size;
+	(void)raw_size;
+	throw std::runtime_error{"Ecole was compiled without support for compressed archives."};
+#endif
+}
+
+auto compression_supported() noexcept -> bool {
+#ifdef ECOLE_HAS_ZLIB
+	return true;
+#else
+	return false;
+#endif
+}
+
+}  // namespace
+
+/**********************************
+ *  Definition of ArchiveWriter  *
+ **********************************/
+
+ArchiveWriter::ArchiveWriter(fs::path const& path, Parameters parameters_) :
+	the_path{path},
+	parameters{parameters_},
+	file{path, std::ios::binary | std::ios::trunc},
+	offset{sizeof(ArchiveHeader)} {
+	if (!file) {
+		throw std::runtime_error{fmt::format("Could not open {}.", path.string())};
+	}
+	// The header is written with the index, when closing
+	auto const header = ArchiveHeader{};
+	file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+}
+
+ArchiveWriter::ArchiveWriter(fs::path const& path) : ArchiveWriter{path, Parameters{}} {}
+
+ArchiveWriter::~ArchiveWriter() {
+	try {
+		close();
+	} catch (std::exception const&) {
+		// Errors can only be reported by calling close explicitly
+	}
+}
+
+auto ArchiveWriter::add_file(fs::path const& problem_file) -> void {
+	// Gzip files are stored as is, and decompressed by SCIP
+	auto extension = problem_file.extension() == ".gz" ? problem_file.stem().extension() : problem_file.extension();
+	auto input = std::ifstream{problem_file, std::ios::binary};
+	if (!input) {
+		throw std::runtime_error{fmt::format("Could not open {}.", problem_file.string())};
+	}
+	auto content = std::vector<std::byte>(fs::file_size(problem_file));
+	input.read(reinterpret_cast<char*>(content.data()), static_cast<std::streamsize>(content.size()));
+	if (!input) {
+		throw std::runtime_error{fmt::format("Could not read {}.", problem_file.string())};
+	}
+	auto const name = problem_file.extension() == ".gz" ? problem_file.stem().stem() : problem_file.stem();
+	add_content(content, extension.string().substr(std::min<std::size_t>(1, extension.string().size())), name.string());
+}
+
+auto ArchiveWriter::add(scip::Model const& model, std::string const& extension) -> void {
+	auto const memory = memory_file("ecole-archive-instance");
+	model.write_problem(memory.path(), extension);
+	add_content(read_all(memory), extension, model.name());
+}
+
+auto ArchiveWriter::add_content(std::vector<std::byte> const& content, std::string extension, std::string const& name)
+	-> void {
+	if (!file.is_open()) {
+		throw std::logic_error{"Cannot add instances to a closed ArchiveWriter."};
+	}
+	if (extension.empty() || (extension.size() >= sizeof(IndexEntry::extension))) {
+		throw std::invalid_argument{fmt::format("Unsupported problem file extension '{}'.", extension)};
+	}
+	if (name.size() > std::numeric_limits<decltype(IndexEntry::name_size)>::max()) {
+		throw std::invalid_argument{"Instance name is too long."};
+	}
+	file.write(name.data(), static_cast<std::streamsize>(name.size()));
+	offset += name.size();
+	auto const compressed = parameters.compress && compression_supported();
+	auto const stored = compressed ? compress(content, parameters.compression_level) : std::vector<std::byte>{};
+	auto const& to_write = compressed ? stored : content;
+	file.write(reinterpret_cast<char const*>(to_write.data()), static_cast<std::streamsize>(to_write.size()));
+	if (!file) {
+		throw std::runtime_error{fmt::format("Could not write to {}.", the_path.string())};
+	}
+	entries.push_back({offset, to_write.size(), content.size(), compressed, std::move(extension), name});
+	offset += to_write.size();
+}
+
+auto ArchiveWriter::close() -> void {
+	if (!file.is_open()) {
+		return;
+	}
+	for (auto const& entry : entries) {
+		auto const name_size = static_cast<std::uint32_t>(entry.name.size());
+		auto index_entry = IndexEntry{entry.offset, entry.stored_size, entry.raw_size, name_size, entry.compressed, {}};
+		std::copy(entry.extension.begin(), entry.extension.end(), std::begin(index_entry.extension));
+		file.write(reinterpret_cast<char const*>(&index_entry), sizeof(index_entry));
+	}
+	auto header = ArchiveHeader{};
+	std::copy(std::begin(archive_magic), std::end(archive_magic), std::begin(header.magic));
+	header.version = archive_version;
+	header.n_instances = entries.size();
+	header.index_offset = offset;
+	file.seekp(0);
+	file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+	file.close();
+	if (!file) {
+		throw std::runtime_error{fmt::format("Could not write to {}.", the_path.string())};
+	}
+}
+
+/*************************************
+ *  Definition of ArchiveGenerator  *
+ *************************************/
+
+/** A read only memory map of a whole file. */
+class ArchiveGenerator::Mapping {
+public:
+	explicit Mapping(fs::path const& file) {
+		auto const fd = FileDescriptor{::open(file.c_str(), O_RDONLY)};  // NOLINT(cppcoreguidelines-pro-type-vararg)
+		if (fd.get() < 0) {
+			throw std::system_error{{errno, std::generic_category()}, fmt::format("Could not open {}", file.string())};
+		}
+		struct stat status = {};
+		if (fstat(fd.get(), &status) == 0) {
+			the_size = static_cast<std::size_t>(status.st_size);
+		}
+		if (the_size > 0) {
+			memory = mmap(nullptr, the_size, PROT_READ, MAP_SHARED, fd.get(), 0);
+		}
+		if (memory == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) macro defined by POSIX
+			throw std::system_error{{errno, std::generic_category()}, fmt::format("Could not map {}", file.string())};
+		}
+	}
+	Mapping(Mapping const&) = delete;
+	Mapping(Mapping&&) = delete;
+	~Mapping() {
+		if ((memory != nullptr) && (memory != MAP_FAILED)) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+			munmap(memory, the_size);
+		}
+	}
+	auto operator=(Mapping const&) -> Mapping& = delete;
+	auto operator=(Mapping&&) -> Mapping& = delete;
+
+	[[nodiscard]] auto data() const noexcept -> std::byte const* { return static_cast<std::byte const*>(memory); }
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return the_size; }
+
+private:
+	void* memory = nullptr;
+	std::size_t the_size = 0;
+};
+
+ArchiveGenerator::ArchiveGenerator(Parameters parameters_, RandomGenerator rng_) :
+	rng{rng_}, parameters{std::move(parameters_)} {
+	if (parameters.shard_index >= parameters.num_shards) {
+		throw std::invalid_argument{
+			fmt::format("Shard index {} is out of range for {} shards.", parameters.shard_index, parameters.num_shards)};
+	}
+	mapping = std::make_shared<Mapping const>(parameters.archive);
+	auto const* const data = mapping->data();
+	auto const size = mapping->size();
+
+	auto const header = size < sizeof(ArchiveHeader) ? ArchiveHeader{} : read_as<ArchiveHeader>(data);
+	if (
+		!std::equal(std::begin(archive_magic), std::end(archive_magic), std::begin(header.magic)) ||
+		(header.version != archive_version) || (header.index_offset > size) ||
+		(header.n_instances > (size - header.index_offset) / sizeof(IndexEntry))) {
+		throw std::runtime_error{fmt::format("File {} is not an instance archive.", parameters.archive.string())};
+	}
+
+	for (auto i = parameters.shard_index; i < header.n_instances; i += parameters.num_shards) {
+		auto const entry = read_as<IndexEntry>(data + header.index_offset + i * sizeof(IndexEntry));
+		if (
+			(entry.offset > header.index_offset) || (entry.stored_size > header.index_offset - entry.offset) ||
+			(entry.offset < sizeof(ArchiveHeader) + entry.name_size)) {
+			throw std::runtime_error{
+				fmt::format("Instance {} of archive {} is corrupted.", i, parameters.archive.string())};
+		}
+		auto const* const extension_end = std::find(std::begin(entry.extension), std::end(entry.extension), '\0');
+		entries.push_back(
+			{entry.offset,
+			 entry.stored_size,
+			 entry.raw_size,
+			 entry.compressed != 0,
+			 {std::begin(entry.extension), extension_end},
+			 {reinterpret_cast<char const*>(data + entry.offset - entry.name_size), entry.name_size}});
+	}
+	reset_entry_list();
+}
+
+ArchiveGenerator::ArchiveGenerator(Parameters parameters_) :
+	ArchiveGenerator{std::move(parameters_), ecole::spawn_random_generator()} {}
+
+ArchiveGenerator::ArchiveGenerator() : ArchiveGenerator{Parameters{}} {}
+
+auto ArchiveGenerator::next() -> scip::Model {
+	if (done()) {
+		throw IteratorExhausted{};
+	}
+	static auto const histogram = generation_seconds("Archive");
+	auto const timer = utility::metrics::Timer{histogram};
+	if (entries_remaining == 0) {
+		entries_remaining = entries.size();
+	}
+
+	auto choice = std::uniform_int_distribution<std::size_t>{0, entries_remaining - 1};
+	auto const idx = choice(rng);
+
+	// Same sampling as in the FileGenerator, with entries in place of files.
+	if (parameters.sampling_mode == Parameters::SamplingMode::replace) {
+		return load(entries[idx]);
+	}
+	entries_remaining--;
+	std::swap(entries[idx], entries[entries_remaining]);
+	return load(entries[entries_remaining]);
+}
+
+void ArchiveGenerator::seed(Seed seed) {
+	reset_entry_list();
+	rng.seed(seed);
+}
+
+auto ArchiveGenerator::done() const -> bool {
+	auto const no_entries_at_all = entries.empty();
+	auto const seen_all_entries =
+		(entries_remaining == 0 && parameters.sampling_mode == Parameters::SamplingMode::remove);
+	return no_entries_at_all || seen_all_entries;
+}
+
+void ArchiveGenerator::reset_entry_list() {
+	std::sort(begin(entries), end(entries), [](auto const& a, auto const& b) { return a.offset < b.offset; });
+	entries_remaining = entries.size();
+}
+
+/** Copy the instance from the mapped archive in an anonymous file, and let SCIP parse it. */
+auto ArchiveGenerator::load(ArchiveWriter::Entry const& entry) const -> scip::Model {
+	auto const memory = memory_file("ecole-instance");
+	auto const* const stored = mapping->data() + entry.offset;
+	if (entry.compressed) {
+		auto const raw = decompress(stored, entry.stored_size, entry.raw_size);
+		write_all(memory, raw.data(), raw.size());
+	} else {
+		write_all(memory, stored, entry.stored_size);
+	}
+	auto model = scip::Model{};
+	model.read_problem(memory.path(), entry.extension);
+	// Otherwise named after the in-memory file
+	model.set_name(entry.name);
+	return model;
+}
+
+}  // namespace ecole::instance
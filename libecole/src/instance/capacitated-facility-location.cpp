@@ -14,6 +14,9 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/scip/var.hpp"
+#include "ecole/utility/tracing.hpp"
+
+#include "instance/metrics.hpp"
 
 namespace views = ranges::views;
 
@@ -34,6 +37,8 @@ CapacitatedFacilityLocationGenerator::CapacitatedFacilityLocationGenerator() :
 	CapacitatedFacilityLocationGenerator(Parameters{}) {}
 
 scip::Model CapacitatedFacilityLocationGenerator::next() {
+	static auto const histogram = generation_seconds("CapacitatedFacilityLocation");
+	auto const timer = utility::metrics::Timer{histogram};
 	return generate_instance(parameters, rng);
 }
 
@@ -214,11 +219,18 @@ auto add_tightening_cons(
 	}
 }
 
-}  // namespace
+/** The sampled demands, capacities, and costs of a capacitated facility location problem. */
+struct FacilityLocationData {
+	xvector demands;
+	xvector capacities;
+	xvector fixed_costs;
+	xmatrix transportation_costs;
+};
 
-scip::Model CapacitatedFacilityLocationGenerator::generate_instance(
-	CapacitatedFacilityLocationGenerator::Parameters parameters,
-	RandomGenerator& rng) {
+/** Sample the customers demands, and the facilities capacities and costs. */
+auto sample_data(CapacitatedFacilityLocationGenerator::Parameters const& parameters, RandomGenerator& rng)
+	-> FacilityLocationData {
+	ECOLE_TRACE_SPAN("CapacitatedFacilityLocationGenerator::sample_data", "instance");
 
 	// Sample 1D integers array in the given interval (xtensor lazy).
 	// We sample as integer as it is generally preferred by integer programming reseachers.
@@ -228,15 +240,15 @@ scip::Model CapacitatedFacilityLocationGenerator::generate_instance(
 	};
 
 	// Customer demand
-	auto const demands = static_cast<xvector>(randint(parameters.n_customers, parameters.demand_interval));
+	auto demands = static_cast<xvector>(randint(parameters.n_customers, parameters.demand_interval));
 	// Facilities capacity for serving customer demand
 	auto capacities = static_cast<xvector>(randint(parameters.n_facilities, parameters.capacity_interval));
 	// Fixed costs for opening facilities
-	auto const fixed_costs = static_cast<xvector>(
+	auto fixed_costs = static_cast<xvector>(
 		randint(parameters.n_facilities, parameters.fixed_cost_scale_interval) * xt::sqrt(capacities) +
 		randint(parameters.n_facilities, parameters.fixed_cost_cste_interval));
 	// transport costs from facility to customers
-	auto const transportation_costs = static_cast<xmatrix>(
+	auto transportation_costs = static_cast<xmatrix>(
 		unit_transportation_costs(parameters.n_customers, parameters.n_facilities, rng) *
 		xt::view(demands, xt::all(), xt::newaxis()));
 
@@ -244,18 +256,34 @@ scip::Model CapacitatedFacilityLocationGenerator::generate_instance(
 	capacities = capacities * parameters.ratio * xt::sum(demands)() / xt::sum(capacities)();
 	capacities = xt::nearbyint(capacities);
 
+	return {std::move(demands), std::move(capacities), std::move(fixed_costs), std::move(transportation_costs)};
+}
+
+/** Create the SCIP model of the sampled problem. */
+auto build_model(CapacitatedFacilityLocationGenerator::Parameters const& parameters, FacilityLocationData const& data)
+	-> scip::Model {
+	ECOLE_TRACE_SPAN("CapacitatedFacilityLocationGenerator::build_model", "instance");
+
 	auto model = scip::Model::prob_basic();
 	model.set_name(fmt::format("CapacitatedFacilityLocation-{}-{}", parameters.n_customers, parameters.n_facilities));
 	auto* const scip = model.get_scip_ptr();
 
-	auto const facility_vars = add_facility_vars(scip, fixed_costs);
-	auto const serving_vars = add_serving_vars(scip, transportation_costs, parameters.continuous_assignment);
+	auto const facility_vars = add_facility_vars(scip, data.fixed_costs);
+	auto const serving_vars = add_serving_vars(scip, data.transportation_costs, parameters.continuous_assignment);
 
 	add_demand_cons(scip, serving_vars);
-	add_capacity_cons(scip, serving_vars, facility_vars, demands, capacities);
-	add_tightening_cons(scip, serving_vars, facility_vars, demands, capacities);
+	add_capacity_cons(scip, serving_vars, facility_vars, data.demands, data.capacities);
+	add_tightening_cons(scip, serving_vars, facility_vars, data.demands, data.capacities);
 
 	return model;
 }
 
+}  // namespace
+
+scip::Model CapacitatedFacilityLocationGenerator::generate_instance(
+	CapacitatedFacilityLocationGenerator::Parameters parameters,
+	RandomGenerator& rng) {
+	return build_model(parameters, sample_data(parameters, rng));
+}
+
 }  // namespace ecole::instance
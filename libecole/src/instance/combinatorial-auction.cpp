@@ -18,6 +18,9 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/scip/var.hpp"
+#include "ecole/utility/tracing.hpp"
+
+#include "instance/metrics.hpp"
 
 namespace ecole::instance {
 
@@ -32,6 +35,8 @@ CombinatorialAuctionGenerator::CombinatorialAuctionGenerator(Parameters paramete
 CombinatorialAuctionGenerator::CombinatorialAuctionGenerator() : CombinatorialAuctionGenerator(Parameters{}) {}
 
 scip::Model CombinatorialAuctionGenerator::next() {
+	static auto const histogram = generation_seconds("CombinatorialAuction");
+	auto const timer = utility::metrics::Timer{histogram};
 	return generate_instance(parameters, rng);
 }
 
@@ -397,17 +402,11 @@ auto add_constraints(SCIP* scip, xvector<SCIP_VAR*> vars, std::vector<Bundle> co
  *  CombinatorialAuctionGenerator::generate_instance  *
  ******************************************************/
 
-scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
-
-	// check that parameters are valid
-	if (!(parameters.max_value >= parameters.min_value)) {
-		throw std::invalid_argument{
-			"Parameters max_value and min_value must be defined such that: min_value <= max_value."};
-	}
+namespace {
 
-	if (!(parameters.add_item_prob >= 0 && parameters.add_item_prob <= 1)) {
-		throw std::invalid_argument{"Parameter add_item_prob must be in range [0,1]."};
-	}
+/** Sample the values and compatibilities of items, then the bids, returned with the number of dummy items. */
+auto sample_data(CombinatorialAuctionGenerator::Parameters const& parameters, RandomGenerator& rng) {
+	ECOLE_TRACE_SPAN("CombinatorialAuctionGenerator::sample_data", "instance");
 
 	// initialize logger for warnings
 	auto logger = Logger(parameters.warnings);
@@ -423,7 +422,7 @@ scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters paramete
 	compats /= xt::sum(compats, 1);
 
 	// get all bids
-	auto [bids, n_dummy_items] = get_bids(
+	return get_bids(
 		values,
 		compats,
 		parameters.max_value,
@@ -438,8 +437,15 @@ scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters paramete
 		parameters.resale_factor,
 		logger,
 		rng);
+}
+
+/** Create the SCIP model of the sampled bids. */
+auto build_model(
+	CombinatorialAuctionGenerator::Parameters const& parameters,
+	std::vector<std::tuple<Bundle, Price>> const& bids,
+	std::size_t n_dummy_items) -> scip::Model {
+	ECOLE_TRACE_SPAN("CombinatorialAuctionGenerator::build_model", "instance");
 
-	// create scip model
 	auto model = scip::Model::prob_basic();
 	model.set_name(fmt::format("CombinatorialAuction-{}-{}", parameters.n_items, parameters.n_bids));
 	auto* const scip = model.get_scip_ptr();
@@ -461,4 +467,22 @@ scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters paramete
 	return model;
 }
 
+}  // namespace
+
+scip::Model CombinatorialAuctionGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
+
+	// check that parameters are valid
+	if (!(parameters.max_value >= parameters.min_value)) {
+		throw std::invalid_argument{
+			"Parameters max_value and min_value must be defined such that: min_value <= max_value."};
+	}
+
+	if (!(parameters.add_item_prob >= 0 && parameters.add_item_prob <= 1)) {
+		throw std::invalid_argument{"Parameter add_item_prob must be in range [0,1]."};
+	}
+
+	auto const [bids, n_dummy_items] = sample_data(parameters, rng);
+	return build_model(parameters, bids, n_dummy_items);
+}
+
 }  // namespace ecole::instance
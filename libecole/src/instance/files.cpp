@@ -1,10 +1,18 @@
 #include <algorithm>
 #include <iterator>
 #include <random>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
 
 #include "ecole/exception.hpp"
 #include "ecole/instance/files.hpp"
 
+#include "instance/metrics.hpp"
+
 namespace ecole::instance {
 
 namespace fs = std::filesystem;
@@ -23,17 +31,44 @@ template <typename FileIter> auto list_files(FileIter&& dir_iter) {
 	return files;
 }
 
+/**
+ * Ask the kernel to start reading a file in the page cache, without waiting for it.
+ *
+ * Does nothing where posix_fadvise is not available (e.g. macOS), where the next file is still parsed ahead of time.
+ */
+void advise_will_need([[maybe_unused]] fs::path const& file) noexcept {
+#ifdef POSIX_FADV_WILLNEED
+	auto const fd = ::open(file.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+	if (fd >= 0) {
+		posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+		::close(fd);
+	}
+#endif
+}
+
 }  // namespace
 
 FileGenerator::FileGenerator(Parameters parameters_, RandomGenerator rng_) :
 	rng{rng_}, parameters{std::move(parameters_)} {
+	if (parameters.shard_index >= parameters.num_shards) {
+		throw std::invalid_argument{
+			fmt::format("Shard index {} is out of range for {} shards.", parameters.shard_index, parameters.num_shards)};
+	}
 	using opts = fs::directory_options;
 	if (parameters.recursive) {
 		files = list_files(fs::recursive_directory_iterator{parameters.directory, opts::follow_directory_symlink});
 	} else {
 		files = list_files(fs::directory_iterator{parameters.directory, opts::follow_directory_symlink});
 	}
-	// The order in which the files are iterated over is unspecified.
+	// The order in which the files are iterated over is unspecified, so shards are taken in the sorted list.
+	std::sort(begin(files), end(files));
+	if (parameters.num_shards > 1) {
+		auto shard = std::vector<fs::path>{};
+		for (auto i = parameters.shard_index; i < files.size(); i += parameters.num_shards) {
+			shard.push_back(std::move(files[i]));
+		}
+		files = std::move(shard);
+	}
 	reset_file_list();
 }
 
@@ -46,26 +81,24 @@ auto FileGenerator::next() -> scip::Model {
 	if (done()) {
 		throw IteratorExhausted{};
 	}
-	if (files_remaining == 0) {
-		files_remaining = files.size();
+	static auto const histogram = generation_seconds("File");
+	auto const timer = utility::metrics::Timer{histogram};
+	select_upcoming();
+	auto const file = std::move(upcoming.front());
+	upcoming.pop_front();
+	auto model = next_model.valid() ? next_model.get() : scip::Model::from_file(file);
+
+	// Parse the following file, including its decompression, while the current one is used
+	select_upcoming();
+	if ((parameters.prefetch > 0) && !upcoming.empty()) {
+		next_model =
+			std::async(std::launch::async, [next_file = upcoming.front()] { return scip::Model::from_file(next_file); });
 	}
-
-	auto choice = std::uniform_int_distribution<std::size_t>{0, files_remaining - 1};
-	auto const idx = choice(rng);
-
-	// files_remaining is not used in this case, it is only an alias for files.size().
-	if (parameters.sampling_mode == Parameters::SamplingMode::replace) {
-		return scip::Model::from_file(files[idx]);
-	}
-
-	// files[0: files_reamining] are unseen files, while files[files_reamining: -1] are seen.
-	// We mark files[idx] as seen by exchanging it with files[files_remaining]
-	files_remaining--;
-	swap(files[idx], files[files_remaining]);
-	return scip::Model::from_file(files[files_remaining]);
+	return model;
 }
 
 void FileGenerator::seed(Seed seed) {
+	discard_upcoming();
 	reset_file_list();
 	rng.seed(seed);
 }
@@ -73,7 +106,7 @@ void FileGenerator::seed(Seed seed) {
 auto FileGenerator::done() const -> bool {
 	auto const no_files_at_all = files.empty();
 	auto const seen_all_files = (files_remaining == 0 && parameters.sampling_mode == Parameters::SamplingMode::remove);
-	return no_files_at_all || seen_all_files;
+	return upcoming.empty() && (no_files_at_all || seen_all_files);
 }
 
 void FileGenerator::reset_file_list() {
@@ -81,4 +114,39 @@ void FileGenerator::reset_file_list() {
 	files_remaining = files.size();
 }
 
+/** Select files until prefetch files are selected after the next one, in the order they will be returned. */
+void FileGenerator::select_upcoming() {
+	while ((upcoming.size() <= parameters.prefetch) && !files.empty()) {
+		if (files_remaining == 0) {
+			if (parameters.sampling_mode == Parameters::SamplingMode::remove) {
+				return;
+			}
+			files_remaining = files.size();
+		}
+
+		auto choice = std::uniform_int_distribution<std::size_t>{0, files_remaining - 1};
+		auto const idx = choice(rng);
+
+		// files_remaining is not used in this case, it is only an alias for files.size().
+		if (parameters.sampling_mode == Parameters::SamplingMode::replace) {
+			upcoming.push_back(files[idx]);
+		} else {
+			// files[0: files_reamining] are unseen files, while files[files_reamining: -1] are seen.
+			// We mark files[idx] as seen by exchanging it with files[files_remaining]
+			files_remaining--;
+			swap(files[idx], files[files_remaining]);
+			upcoming.push_back(files[files_remaining]);
+		}
+		if (parameters.prefetch > 0) {
+			advise_will_need(upcoming.back());
+		}
+	}
+}
+
+void FileGenerator::discard_upcoming() noexcept {
+	// Waits for the file being parsed, and ignores its errors
+	next_model = {};
+	upcoming.clear();
+}
+
 }  // namespace ecole::instance
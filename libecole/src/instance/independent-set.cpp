@@ -12,8 +12,10 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/scip/var.hpp"
+#include "ecole/utility/tracing.hpp"
 #include "ecole/utility/unreachable.hpp"
 
+#include "instance/metrics.hpp"
 #include "utility/graph.hpp"
 
 namespace views = ranges::views;
@@ -33,6 +35,8 @@ IndependentSetGenerator::IndependentSetGenerator(Parameters parameters_) :
 IndependentSetGenerator::IndependentSetGenerator() : IndependentSetGenerator(Parameters{}) {}
 
 scip::Model IndependentSetGenerator::next() {
+	static auto const histogram = generation_seconds("IndependentSet");
+	auto const timer = utility::metrics::Timer{histogram};
 	return generate_instance(parameters, rng);
 }
 
@@ -48,6 +52,7 @@ namespace {
 
 /** Make a graph according to the IndependentSetGenerator parameters specifications. */
 auto make_graph(IndependentSetGenerator::Parameters parameters, RandomGenerator& rng) -> Graph {
+	ECOLE_TRACE_SPAN("IndependentSetGenerator::sample_data", "instance");
 	switch (parameters.graph_type) {
 	case IndependentSetGenerator::Parameters::GraphType::erdos_renyi:
 		return Graph::erdos_renyi(parameters.n_nodes, parameters.edge_probability, rng);
@@ -136,10 +141,10 @@ private:
 	std::vector<CliqueId> cliques_ids;
 };
 
-}  // namespace
+/** Create the SCIP model of the independent set problem on the sampled graph. */
+auto build_model(IndependentSetGenerator::Parameters const& parameters, Graph const& graph) -> scip::Model {
+	ECOLE_TRACE_SPAN("IndependentSetGenerator::build_model", "instance");
 
-scip::Model IndependentSetGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
-	auto const graph = make_graph(parameters, rng);
 	auto model = scip::Model::prob_basic();
 	model.set_name(fmt::format("IndependentSet-{}", parameters.n_nodes));
 	auto* const scip = model.get_scip_ptr();
@@ -173,4 +178,10 @@ scip::Model IndependentSetGenerator::generate_instance(Parameters parameters, Ra
 	return model;
 }
 
+}  // namespace
+
+scip::Model IndependentSetGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
+	return build_model(parameters, make_graph(parameters, rng));
+}
+
 }  // namespace ecole::instance
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "ecole/utility/metrics.hpp"
+
+namespace ecole::instance {
+
+/** Histogram of the time taken by the next method of a generator, labeled with the name of the generator. */
+inline auto generation_seconds(char const* generator) -> utility::metrics::Histogram {
+	return {
+		"ecole_instance_generation_seconds",
+		"Time to generate, or read, an instance.",
+		utility::metrics::default_latency_bounds(),
+		{{"generator", generator}}};
+}
+
+}  // namespace ecole::instance
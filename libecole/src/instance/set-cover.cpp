@@ -1,5 +1,6 @@
 #include <fmt/format.h>
 #include <map>
+#include <utility>
 
 #include <xtensor/xrandom.hpp>
 #include <xtensor/xsort.hpp>
@@ -11,6 +12,9 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/scip/var.hpp"
+#include "ecole/utility/tracing.hpp"
+
+#include "instance/metrics.hpp"
 
 namespace ecole::instance {
 
@@ -25,6 +29,8 @@ SetCoverGenerator::SetCoverGenerator(Parameters parameters_) :
 SetCoverGenerator::SetCoverGenerator() : SetCoverGenerator(Parameters{}) {}
 
 scip::Model SetCoverGenerator::next() {
+	static auto const histogram = generation_seconds("SetCover");
+	auto const timer = utility::metrics::Timer{histogram};
 	return generate_instance(parameters, rng);
 }
 
@@ -109,7 +115,12 @@ auto add_vars(SCIP* scip, xt::xtensor<SCIP_Real, 1> const& c) -> xt::xtensor<SCI
  *
  * For each set, at least one element is required to the solution.
  */
-auto add_constaints(SCIP* scip, xt::xtensor<SCIP_VAR*, 1> vars, xvector& indices, xvector& indptr, size_t n_rows) {
+auto add_constaints(
+	SCIP* scip,
+	xt::xtensor<SCIP_VAR*, 1> vars,
+	xvector const& indices,
+	xvector const& indptr,
+	size_t n_rows) {
 
 	for (size_t i = 0; i < n_rows; ++i) {
 
@@ -168,7 +179,18 @@ auto convert_csc_to_csr(xvector& indices, xvector& indptr, size_t n_rows, size_t
  *  SetCoverGenerator::generate_instance  *
  ******************************************/
 
-scip::Model SetCoverGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
+namespace {
+
+/** The sampled set cover problem, with the constraint matrix in CSR format. */
+struct SetCoverData {
+	xvector indptr_csr;
+	xvector indices_csr;
+	xt::xtensor<SCIP_Real, 1> c;
+};
+
+/** Sample the constraint matrix and the objective coefficients. */
+auto sample_data(SetCoverGenerator::Parameters const& parameters, RandomGenerator& rng) -> SetCoverData {
+	ECOLE_TRACE_SPAN("SetCoverGenerator::sample_data", "instance");
 
 	auto const n_rows = parameters.n_rows;
 	auto const n_cols = parameters.n_cols;
@@ -223,18 +245,29 @@ scip::Model SetCoverGenerator::generate_instance(Parameters parameters, RandomGe
 	// sample coefficients
 	xt::xtensor<SCIP_Real, 1> c = xt::random::randint<size_t>({n_cols}, 0, max_coef, rng) + 1;
 
-	// create scip model
+	return {std::move(indptr_csr), std::move(indices_csr), std::move(c)};
+}
+
+/** Create the SCIP model of the sampled problem. */
+auto build_model(SetCoverGenerator::Parameters const& parameters, SetCoverData const& data) -> scip::Model {
+	ECOLE_TRACE_SPAN("SetCoverGenerator::build_model", "instance");
+
 	auto model = scip::Model::prob_basic();
 	model.set_name(fmt::format("SetCover-{}-{}", parameters.n_rows, parameters.n_cols));
 	auto* const scip = model.get_scip_ptr();
 	scip::call(SCIPsetObjsense, scip, SCIP_OBJSENSE_MINIMIZE);
 
 	// add variables and constraints
-	auto const vars = add_vars(scip, c);
-	add_constaints(scip, vars, indices_csr, indptr_csr, n_rows);
+	auto const vars = add_vars(scip, data.c);
+	add_constaints(scip, vars, data.indices_csr, data.indptr_csr, parameters.n_rows);
 
 	return model;
+}
+
+}  // namespace
 
-}  // generate_instance
+scip::Model SetCoverGenerator::generate_instance(Parameters parameters, RandomGenerator& rng) {
+	return build_model(parameters, sample_data(parameters, rng));
+}
 
 }  // namespace ecole::instance
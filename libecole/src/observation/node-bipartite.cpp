@@ -384,6 +384,19 @@ auto NodeBipartite::before_reset(scip::Model& /* model */) -> void {
 	cache_computed = false;
 }
 
+auto NodeBipartite::memory_usage() const noexcept -> std::size_t {
+	using value_type = NodeBipartiteObs::value_type;
+	return (the_cache.variable_features.size() + the_cache.row_features.size() +
+					the_cache.edge_features.values.size()) *
+				 sizeof(value_type) +
+				 the_cache.edge_features.indices.size() * sizeof(std::size_t);
+}
+
+auto NodeBipartite::evict() -> void {
+	the_cache = {};
+	cache_computed = false;
+}
+
 auto NodeBipartite::extract(scip::Model& model, bool /* done */) -> std::optional<NodeBipartiteObs> {
 	if (model.stage() == SCIP_STAGE_SOLVING) {
 		if (use_cache) {
@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <tuple>
+
+#include <nonstd/span.hpp>
+#include <scip/scip.h>
+#include <xtensor/xtensor.hpp>
+#include <xtensor/xview.hpp>
+
+#include "ecole/observation/open-nodes.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/utils.hpp"
+
+namespace ecole::observation {
+
+namespace {
+
+using Features = OpenNodesObs::Features;
+using NodeType = OpenNodesObs::NodeType;
+
+template <typename Tensor> void set_node(Tensor&& out, SCIP_NODE* node, NodeType type) {
+	auto const set = [&out](Features feat, auto val) { out[static_cast<std::size_t>(feat)] = static_cast<double>(val); };
+	// Node numbers are shifted by one to start at zero, as in FocusNode
+	set(Features::number, SCIPnodeGetNumber(node) - 1);
+	set(Features::depth, SCIPnodeGetDepth(node));
+	set(Features::lowerbound, SCIPnodeGetLowerbound(node));
+	set(Features::estimate, SCIPnodeGetEstimate(node));
+	set(Features::node_type, static_cast<std::size_t>(type));
+	auto* const parent = SCIPnodeGetParent(node);
+	set(Features::parent_number, parent != nullptr ? SCIPnodeGetNumber(parent) - 1 : -1);
+}
+
+}  // namespace
+
+auto OpenNodes::extract(scip::Model& model, bool /* done */) -> std::optional<OpenNodesObs> {
+	if (model.stage() != SCIP_STAGE_SOLVING) {
+		return {};
+	}
+
+	auto* const scip = model.get_scip_ptr();
+	SCIP_NODE** leaves = nullptr;
+	SCIP_NODE** children = nullptr;
+	SCIP_NODE** siblings = nullptr;
+	int n_leaves = 0;
+	int n_children = 0;
+	int n_siblings = 0;
+	scip::call(SCIPgetOpenNodesData, scip, &leaves, &children, &siblings, &n_leaves, &n_children, &n_siblings);
+
+	auto const node_groups = {
+		std::tuple{nonstd::span{children, static_cast<std::size_t>(n_children)}, NodeType::child},
+		std::tuple{nonstd::span{siblings, static_cast<std::size_t>(n_siblings)}, NodeType::sibling},
+		std::tuple{nonstd::span{leaves, static_cast<std::size_t>(n_leaves)}, NodeType::leaf},
+	};
+
+	auto const n_nodes = static_cast<std::size_t>(n_leaves + n_children + n_siblings);
+	auto obs = OpenNodesObs{xt::xtensor<double, 2>::from_shape({n_nodes, OpenNodesObs::n_features})};
+	auto row = std::size_t{0};
+	for (auto const& [nodes, type] : node_groups) {
+		for (auto* const node : nodes) {
+			set_node(xt::row(obs.features, static_cast<std::ptrdiff_t>(row)), node, type);
+			++row;
+		}
+	}
+	return obs;
+}
+
+}  // namespace ecole::observation
@@ -1,12 +1,24 @@
+#include <atomic>
+#include <cstring>
 #include <locale>
-#include <mutex>
 #include <sstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
 
 #include "ecole/random.hpp"
 
 namespace ecole {
 namespace {
 
+/**
+ * The global source of randomness.
+ *
+ * Generators are identified by the user seed and a stream number, incremented at every spawn.
+ * Both are packed in a single atomic word, so that spawning never takes a lock nor sees a seed with the stream
+ * counter of another seed.
+ * Generators only use the lower 32 bits of the seed, leaving the other 32 bits to the stream counter.
+ */
 class RandomGeneratorManager {
 public:
 	static auto get() -> RandomGeneratorManager&;
@@ -15,13 +27,15 @@ public:
 	auto spawn() -> RandomGenerator;
 
 private:
-	std::mutex m;
-	Seed user_seed = 0;
-	Seed spawn_seed = 0;
+	static constexpr auto stream_bits = 32U;
+	static constexpr auto stream_mask = (std::uint64_t{1} << stream_bits) - 1;
 
-	RandomGeneratorManager();
+	/** The user seed in the upper bits, and the number of spawned generators in the lower bits. */
+	std::atomic<std::uint64_t> state;
+
+	static auto pack(Seed seed) noexcept -> std::uint64_t;
 
-	auto new_seed_seq() -> std::seed_seq;
+	RandomGeneratorManager();
 };
 
 }  // namespace
@@ -34,6 +48,39 @@ auto spawn_random_generator() -> RandomGenerator {
 	return RandomGeneratorManager::get().spawn();
 }
 
+#ifdef ECOLE_PHILOX_RANDOM_GENERATOR
+
+auto make_random_generator(Seed seed, std::uint64_t stream) -> RandomGenerator {
+	return RandomGenerator{seed, stream};
+}
+
+auto serialize(RandomGenerator const& rng) -> std::string {
+	auto const state = rng.to_bytes();
+	auto data = std::string(state.size(), '\0');
+	std::memcpy(data.data(), state.data(), state.size());
+	return data;
+}
+
+auto deserialize(std::string const& data) -> RandomGenerator {
+	auto state = RandomGenerator::State{};
+	if (data.size() != state.size()) {
+		throw std::invalid_argument{
+			fmt::format("Random generator state must have {} bytes, got {}.", state.size(), data.size())};
+	}
+	std::memcpy(state.data(), data.data(), state.size());
+	return RandomGenerator::from_bytes(state);
+}
+
+#else
+
+auto make_random_generator(Seed seed, std::uint64_t stream) -> RandomGenerator {
+	auto const stream_low = static_cast<Seed>(stream);
+	auto const stream_high = static_cast<Seed>(stream >> 32U);
+	// Streams that fit in a Seed keep the same generators as previous versions
+	auto seeds = stream_high == 0 ? std::seed_seq{seed, stream_low} : std::seed_seq{seed, stream_low, stream_high};
+	return RandomGenerator{seeds};
+}
+
 // Not efficient, but operator<< is the only thing we have
 auto serialize(RandomGenerator const& rng) -> std::string {
 	auto osstream = std::ostringstream{};
@@ -51,6 +98,8 @@ auto deserialize(std::string const& data) -> RandomGenerator {
 	return rng;
 }
 
+#endif
+
 /*******************************************
  *  Implementation of RandomGeneratorManager  *
  *******************************************/
@@ -62,23 +111,27 @@ auto RandomGeneratorManager::get() -> RandomGeneratorManager& {
 	return rng;
 }
 
+auto RandomGeneratorManager::pack(Seed seed) noexcept -> std::uint64_t {
+	return static_cast<std::uint64_t>(static_cast<std::uint32_t>(seed)) << stream_bits;
+}
+
 auto RandomGeneratorManager::seed(Seed val) -> void {
-	auto const lk = std::unique_lock{m};
-	user_seed = val;
-	spawn_seed = 0;
+	state.store(pack(val));
 }
 
 auto RandomGeneratorManager::spawn() -> RandomGenerator {
-	auto seeds = new_seed_seq();
-	return RandomGenerator{seeds};
+	auto current = state.load();
+	do {
+		if ((current & stream_mask) == stream_mask) {
+			throw std::runtime_error{"All random generators of the seed have been spawned, Ecole must be seeded again."};
+		}
+	} while (!state.compare_exchange_weak(current, current + 1));
+	auto const seed = static_cast<Seed>(current >> stream_bits);
+	auto const stream = (current & stream_mask) + 1;
+	return make_random_generator(seed, stream);
 }
 
-RandomGeneratorManager::RandomGeneratorManager() : user_seed{std::random_device{}()} {}
-
-auto RandomGeneratorManager::new_seed_seq() -> std::seed_seq {
-	auto const lk = std::unique_lock{m};
-	return {user_seed, ++spawn_seed};
-}
+RandomGeneratorManager::RandomGeneratorManager() : state{pack(std::random_device{}())} {}
 
 }  // namespace
 }  // namespace ecole
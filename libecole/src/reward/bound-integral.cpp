@@ -1,7 +1,8 @@
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <utility>
 
 #include "scip/scip.h"
 #include "scip/type_event.h"
@@ -25,18 +26,25 @@ public:
 	inline static auto constexpr base_name = "ecole::reward::IntegralEventHandler";
 	inline static auto integral_reward_function_counter = 0;
 
-	IntegralEventHandler(SCIP* scip, bool wall_, bool extract_primal_, bool extract_dual_, const char* name_) :
+	IntegralEventHandler(
+		SCIP* scip,
+		bool wall_,
+		Bound bound_,
+		SCIP_Real offset_,
+		SCIP_Real initial_primal_bound_,
+		SCIP_Real initial_dual_bound_,
+		const char* name_) :
 		ObjEventhdlr(scip, name_, "Event handler for primal and dual integrals"),
 		wall{wall_},
-		extract_primal{extract_primal_},
-		extract_dual{extract_dual_} {}
+		bound{bound_},
+		extract_primal{bound_ != Bound::dual},
+		extract_dual{bound_ != Bound::primal},
+		offset{offset_},
+		initial_primal_bound{initial_primal_bound_},
+		initial_dual_bound{initial_dual_bound_} {}
 
 	~IntegralEventHandler() override = default;
 
-	[[nodiscard]] std::vector<std::chrono::nanoseconds> const& get_times() const noexcept { return times; }
-	[[nodiscard]] std::vector<SCIP_Real> const& get_primal_bounds() const noexcept { return primal_bounds; }
-	[[nodiscard]] std::vector<SCIP_Real> const& get_dual_bounds() const noexcept { return dual_bounds; }
-
 	/** Catch primal and dual related events. */
 	SCIP_RETCODE scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override;
 	/** Drop primal and dual related events. */
@@ -44,17 +52,29 @@ public:
 	/* Call extract_metrics() to obtain bounds/times at events. */
 	SCIP_RETCODE scip_exec(SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata) override;
 
-	/** Get and adds primal/dual bounds and times to vectors. */
+	/** Get primal/dual bounds and time, and accumulate the integral since the previous point. */
 	void extract_metrics(SCIP* scip, SCIP_EVENTTYPE event_type = 0);
-	void clear_bounds();
+	/** Return the integral accumulated since the last call and start a new one from the last point. */
+	auto pop_integral() noexcept -> SCIP_Real;
 
 private:
 	bool wall;
+	Bound bound;
 	bool extract_primal;
 	bool extract_dual;
-	std::vector<std::chrono::nanoseconds> times;
-	std::vector<SCIP_Real> primal_bounds;
-	std::vector<SCIP_Real> dual_bounds;
+	SCIP_Real offset;
+	SCIP_Real initial_primal_bound;
+	SCIP_Real initial_dual_bound;
+
+	// Only the last point is kept, the integral is a left Riemann sum accumulated online.
+	bool has_point = false;
+	std::chrono::nanoseconds last_time = {};
+	SCIP_Real last_primal_bound = 0.;
+	SCIP_Real last_dual_bound = 0.;
+	SCIP_Real integral = 0.;
+
+	/** Integrand evaluated at the last point. */
+	[[nodiscard]] auto integrand(SCIP_Objsense obj_sense) const noexcept -> SCIP_Real;
 };
 
 /********************************************
@@ -142,105 +162,52 @@ auto is_bestsol_event(SCIP_EVENTTYPE event) {
 	return event & SCIP_EVENTTYPE_BESTSOLFOUND;
 }
 
-void IntegralEventHandler::extract_metrics(SCIP* scip, SCIP_EVENTTYPE event_type) {
-	if (extract_primal) {
-		if ((is_bestsol_event(event_type)) || (primal_bounds.empty())) {
-			primal_bounds.push_back(get_primal_bound(scip));
-		} else {
-			primal_bounds.push_back(primal_bounds.back());
+auto IntegralEventHandler::integrand(SCIP_Objsense obj_sense) const noexcept -> SCIP_Real {
+	auto const minimize = obj_sense == SCIP_OBJSENSE_MINIMIZE;
+	switch (bound) {
+	case Bound::dual:
+		if (minimize) {
+			return offset - std::max(last_dual_bound, initial_dual_bound);
 		}
-	}
-	if (extract_dual) {
-		if ((is_lp_event(event_type)) || (dual_bounds.empty())) {
-			dual_bounds.push_back(get_dual_bound(scip));
-		} else {
-			dual_bounds.push_back(dual_bounds.back());
+		return -(offset - std::min(last_dual_bound, initial_dual_bound));
+	case Bound::primal:
+		if (minimize) {
+			return -(offset - std::min(last_primal_bound, initial_primal_bound));
 		}
+		return offset - std::max(last_primal_bound, initial_primal_bound);
+	case Bound::primal_dual:
+		if (minimize) {
+			return -(std::max(last_dual_bound, initial_dual_bound) - std::min(last_primal_bound, initial_primal_bound));
+		}
+		return std::min(last_dual_bound, initial_dual_bound) - std::max(last_primal_bound, initial_primal_bound);
 	}
-	times.push_back(time_now(wall));
+	return 0.;
 }
 
-void IntegralEventHandler::clear_bounds() {
-	if (extract_dual) {
-		auto last_dual = dual_bounds.back();
-		dual_bounds.clear();
-		dual_bounds.push_back(last_dual);
+void IntegralEventHandler::extract_metrics(SCIP* scip, SCIP_EVENTTYPE event_type) {
+	// The bounds of the previous point hold until now
+	auto const previous_integrand = has_point ? integrand(SCIPgetObjsense(scip)) : 0.;
+	if (extract_primal && (is_bestsol_event(event_type) || !has_point)) {
+		last_primal_bound = get_primal_bound(scip);
 	}
-	if (extract_primal) {
-		auto last_primal = primal_bounds.back();
-		primal_bounds.clear();
-		primal_bounds.push_back(last_primal);
+	if (extract_dual && (is_lp_event(event_type) || !has_point)) {
+		last_dual_bound = get_dual_bound(scip);
 	}
-	auto last_time = times.back();
-	times.clear();
-	times.push_back(last_time);
-}
-
-/*************************************
- *  Implementation of BoundIntegral  *
- *************************************/
-
-auto compute_dual_integral(
-	std::vector<SCIP_Real> const& dual_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const offset,
-	SCIP_Real const initial_dual_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real dual_integral = 0.0;
-	for (std::size_t i = 0; i < dual_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const dual_bound = dual_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			dual_integral += (offset - std::max(dual_bound, initial_dual_bound)) * time_diff;
-		} else {
-			dual_integral += -(offset - std::min(dual_bound, initial_dual_bound)) * time_diff;
-		}
+	auto const now = time_now(wall);
+	if (has_point) {
+		integral += previous_integrand * std::chrono::duration<double>(now - last_time).count();
 	}
-	return dual_integral;
+	last_time = now;
+	has_point = true;
 }
 
-auto compute_primal_integral(
-	std::vector<SCIP_Real> const& primal_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const offset,
-	SCIP_Real const initial_primal_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real primal_integral = 0.0;
-	for (std::size_t i = 0; i < primal_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const primal_bound = primal_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			primal_integral += -(offset - std::min(primal_bound, initial_primal_bound)) * time_diff;
-		} else {
-			primal_integral += (offset - std::max(primal_bound, initial_primal_bound)) * time_diff;
-		}
-	}
-	return primal_integral;
+auto IntegralEventHandler::pop_integral() noexcept -> SCIP_Real {
+	return std::exchange(integral, 0.);
 }
 
-auto compute_primal_dual_integral(
-	std::vector<SCIP_Real> const& primal_bounds,
-	std::vector<SCIP_Real> const& dual_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const initial_primal_bound,
-	SCIP_Real const initial_dual_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real primal_dual_integral = 0.0;
-
-	for (std::size_t i = 0; i < primal_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const dual_bound = dual_bounds[i];
-		auto const primal_bound = primal_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			primal_dual_integral +=
-				-(std::max(dual_bound, initial_dual_bound) - std::min(primal_bound, initial_primal_bound)) * time_diff;
-		} else {
-			primal_dual_integral +=
-				(std::min(dual_bound, initial_dual_bound) - std::max(primal_bound, initial_primal_bound)) * time_diff;
-		}
-	}
-	return primal_dual_integral;
-}
+/*************************************
+ *  Implementation of BoundIntegral  *
+ *************************************/
 
 /** Return the integral event handler */
 auto get_eventhdlr(scip::Model& model, const char* name) -> auto& {
@@ -252,8 +219,16 @@ auto get_eventhdlr(scip::Model& model, const char* name) -> auto& {
 }
 
 /** Add the integral event handler to the model. */
-void add_eventhdlr(scip::Model& model, bool wall, bool extract_primal, bool extract_dual, const char* name) {
-	auto handler = std::make_unique<IntegralEventHandler>(model.get_scip_ptr(), wall, extract_primal, extract_dual, name);
+void add_eventhdlr(
+	scip::Model& model,
+	bool wall,
+	Bound bound,
+	SCIP_Real offset,
+	SCIP_Real initial_primal_bound,
+	SCIP_Real initial_dual_bound,
+	const char* name) {
+	auto handler = std::make_unique<IntegralEventHandler>(
+		model.get_scip_ptr(), wall, bound, offset, initial_primal_bound, initial_dual_bound, name);
 	scip::call(SCIPincludeObjEventhdlr, model.get_scip_ptr(), handler.get(), true);
 	// NOLINTNEXTLINE memory ownership is passed to SCIP
 	handler.release();
@@ -306,43 +281,22 @@ template <Bound bound> void BoundIntegral<bound>::before_reset(scip::Model& mode
 	// Initalize bounds and event handler
 	if constexpr (bound == Bound::dual) {
 		std::tie(offset, initial_dual_bound) = bound_function(model);
-		add_eventhdlr(model, wall, false, true, name.c_str());
 	} else if constexpr (bound == Bound::primal) {
 		std::tie(offset, initial_primal_bound) = bound_function(model);
-		add_eventhdlr(model, wall, true, false, name.c_str());
 	} else if constexpr (bound == Bound::primal_dual) {
 		std::tie(initial_primal_bound, initial_dual_bound) = bound_function(model);
-		add_eventhdlr(model, wall, true, true, name.c_str());
 	}
+	add_eventhdlr(model, wall, bound, offset, initial_primal_bound, initial_dual_bound, name.c_str());
 
 	// Extract metrics before resetting to get initial reference point
 	get_eventhdlr(model, name.c_str()).extract_metrics(model.get_scip_ptr());
 }
 
 template <Bound bound> Reward BoundIntegral<bound>::extract(scip::Model& model, bool /*done*/) {
-	// Get info from event handler
+	// Close the current interval and take the integral accumulated since the last extraction
 	auto& handler = get_eventhdlr(model, name.c_str());
 	handler.extract_metrics(model.get_scip_ptr());
-
-	auto const& dual_bounds = handler.get_dual_bounds();
-	auto const& primal_bounds = handler.get_primal_bounds();
-	auto const& times = handler.get_times();
-	auto const obj_sense = SCIPgetObjsense(model.get_scip_ptr());
-
-	// Compute primal integral and difference
-	SCIP_Real integral = 0.;
-	if constexpr (bound == Bound::dual) {
-		integral = compute_dual_integral(dual_bounds, times, offset, initial_dual_bound, obj_sense);
-	} else if constexpr (bound == Bound::primal) {
-		integral = compute_primal_integral(primal_bounds, times, offset, initial_primal_bound, obj_sense);
-	} else if constexpr (bound == Bound::primal_dual) {
-		integral = compute_primal_dual_integral(
-			primal_bounds, dual_bounds, times, initial_primal_bound, initial_dual_bound, obj_sense);
-	}
-
-	// Reset arrays for storing bounds
-	handler.clear_bounds();
-	return static_cast<Reward>(integral);
+	return static_cast<Reward>(handler.pop_integral());
 }
 
 template class BoundIntegral<Bound::primal>;
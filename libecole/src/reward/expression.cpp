@@ -0,0 +1,387 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "ecole/reward/expression.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/utils.hpp"
+#include "ecole/utility/chrono.hpp"
+
+namespace ecole::reward {
+
+namespace {
+
+using Op = RewardExpression::Op;
+
+auto field_of(Op op) noexcept -> unsigned {
+	switch (op) {
+	case Op::lp_iterations:
+		return SolverStatistics::lp_iterations;
+	case Op::n_nodes:
+		return SolverStatistics::n_nodes;
+	case Op::cpu_time:
+		return SolverStatistics::cpu_time;
+	case Op::wall_time:
+		return SolverStatistics::wall_time;
+	default:
+		return SolverStatistics::none;
+	}
+}
+
+/** Python float division. */
+auto truediv(Reward x, Reward y) -> Reward {
+	if (y == 0.) {
+		throw ZeroDivisionError{"float division by zero"};
+	}
+	return x / y;
+}
+
+/** Python float modulo, the result has the sign of the divisor. */
+auto mod(Reward x, Reward y) -> Reward {
+	if (y == 0.) {
+		throw ZeroDivisionError{"float modulo"};
+	}
+	auto rem = std::fmod(x, y);
+	if (rem != 0.) {
+		if ((y < 0.) != (rem < 0.)) {
+			rem += y;
+		}
+	} else {
+		rem = std::copysign(0., y);
+	}
+	return rem;
+}
+
+/** Python float floor division, computed as in CPython float_divmod. */
+auto floordiv(Reward x, Reward y) -> Reward {
+	if (y == 0.) {
+		throw ZeroDivisionError{"float floor division by zero"};
+	}
+	auto const rem = std::fmod(x, y);
+	auto div = (x - rem) / y;
+	if ((rem != 0.) && ((y < 0.) != (rem < 0.))) {
+		div -= 1.;
+	}
+	if (div == 0.) {
+		return std::copysign(0., x / y);
+	}
+	auto floor_div = std::floor(div);
+	if (div - floor_div > 0.5) {
+		floor_div += 1.;
+	}
+	return floor_div;
+}
+
+/** Python float power. */
+auto pow(Reward x, Reward y) -> Reward {
+	if (std::isfinite(y)) {
+		if ((x == 0.) && (y < 0.)) {
+			throw ZeroDivisionError{"0.0 cannot be raised to a negative power"};
+		}
+		if ((x < 0.) && (std::floor(y) != y)) {
+			throw std::domain_error{"negative number cannot be raised to a fractional power"};
+		}
+	}
+	auto const result = std::pow(x, y);
+	if (std::isinf(result) && std::isfinite(x) && std::isfinite(y)) {
+		throw std::overflow_error{"Numerical result out of range"};
+	}
+	return result;
+}
+
+/** Python math module functions, raising on domain and range errors. */
+auto math(Op op, Reward x) -> Reward {
+	auto result = 0.;
+	switch (op) {
+	case Op::exp:
+		result = std::exp(x);
+		break;
+	case Op::log:
+		result = std::log(x);
+		break;
+	case Op::log2:
+		result = std::log2(x);
+		break;
+	case Op::log10:
+		result = std::log10(x);
+		break;
+	case Op::sqrt:
+		result = std::sqrt(x);
+		break;
+	case Op::sin:
+		result = std::sin(x);
+		break;
+	case Op::cos:
+		result = std::cos(x);
+		break;
+	case Op::tan:
+		result = std::tan(x);
+		break;
+	case Op::asin:
+		result = std::asin(x);
+		break;
+	case Op::acos:
+		result = std::acos(x);
+		break;
+	case Op::atan:
+		result = std::atan(x);
+		break;
+	case Op::sinh:
+		result = std::sinh(x);
+		break;
+	case Op::cosh:
+		result = std::cosh(x);
+		break;
+	case Op::tanh:
+		result = std::tanh(x);
+		break;
+	case Op::asinh:
+		result = std::asinh(x);
+		break;
+	case Op::acosh:
+		result = std::acosh(x);
+		break;
+	case Op::atanh:
+		result = std::atanh(x);
+		break;
+	default:
+		throw std::logic_error{"Not a math function."};
+	}
+	if (std::isnan(result) && !std::isnan(x)) {
+		throw std::domain_error{"math domain error"};
+	}
+	if (std::isinf(result) && std::isfinite(x)) {
+		// Poles of log(0) and atanh(+-1) are domain errors in Python
+		if (op == Op::log || op == Op::log2 || op == Op::log10 || op == Op::atanh) {
+			throw std::domain_error{"math domain error"};
+		}
+		throw std::overflow_error{"math range error"};
+	}
+	return result;
+}
+
+}  // namespace
+
+/************************************
+ *  Definition of SolverStatistics  *
+ ************************************/
+
+auto SolverStatistics::gather(scip::Model& model, bool done, unsigned fields) -> SolverStatistics {
+	auto stats = SolverStatistics{};
+	stats.done = done;
+	if ((fields & lp_iterations) != 0U) {
+		stats.n_lp_iterations = scip::n_lp_iterations(model.get_scip_ptr());
+	}
+	if ((fields & n_nodes) != 0U) {
+		stats.n_total_nodes = static_cast<std::uint64_t>(SCIPgetNTotalNodes(model.get_scip_ptr()));
+	}
+	if ((fields & cpu_time) != 0U) {
+		stats.cpu_now = utility::cpu_clock::now().time_since_epoch();
+	}
+	if ((fields & wall_time) != 0U) {
+		stats.wall_now = std::chrono::steady_clock::now().time_since_epoch();
+	}
+	return stats;
+}
+
+/************************************
+ *  Definition of RewardExpression  *
+ ************************************/
+
+RewardExpression::RewardExpression(Reward value) : program{{Op::constant, value}}, stack(1) {}
+
+auto RewardExpression::is_leaf(Op op) noexcept -> bool {
+	return op <= Op::function;
+}
+
+auto RewardExpression::is_unary(Op op) noexcept -> bool {
+	return (op >= Op::neg) && (op <= Op::cumsum);
+}
+
+auto RewardExpression::is_binary(Op op) noexcept -> bool {
+	return op >= Op::add;
+}
+
+auto RewardExpression::constant(Reward value) -> RewardExpression {
+	return RewardExpression{value};
+}
+
+auto RewardExpression::leaf(Op op) -> RewardExpression {
+	if (!is_leaf(op) || op == Op::function) {
+		throw std::invalid_argument{"Not a solver statistic leaf."};
+	}
+	auto expr = RewardExpression{};
+	expr.program.front().op = op;
+	expr.statistics_fields = field_of(op);
+	return expr;
+}
+
+auto RewardExpression::function(Function func) -> RewardExpression {
+	if (!func.before_reset || !func.extract) {
+		throw std::invalid_argument{"Function leaf needs both before_reset and extract."};
+	}
+	auto expr = RewardExpression{};
+	expr.program.front().op = Op::function;
+	expr.functions.push_back(std::move(func));
+	return expr;
+}
+
+auto RewardExpression::unary(Op op, RewardExpression operand) -> RewardExpression {
+	if (!is_unary(op)) {
+		throw std::invalid_argument{"Not a unary operation."};
+	}
+	operand.program.push_back({op});
+	return operand;
+}
+
+auto RewardExpression::binary(Op op, RewardExpression lhs, RewardExpression rhs) -> RewardExpression {
+	if (!is_binary(op)) {
+		throw std::invalid_argument{"Not a binary operation."};
+	}
+	lhs.append(std::move(rhs));
+	lhs.program.push_back({op});
+	// The right operand is evaluated while the left one is on the stack
+	lhs.stack.resize(lhs.stack.size() + 1);
+	return lhs;
+}
+
+auto RewardExpression::append(RewardExpression&& other) -> void {
+	auto const function_offset = functions.size();
+	for (auto& instruction : other.program) {
+		if (instruction.op == Op::function) {
+			instruction.function_idx += function_offset;
+		}
+		program.push_back(instruction);
+	}
+	for (auto& func : other.functions) {
+		functions.push_back(std::move(func));
+	}
+	stack.resize(std::max(stack.size(), other.stack.size()));
+	statistics_fields |= other.statistics_fields;
+}
+
+auto RewardExpression::before_reset(scip::Model& model) -> void {
+	auto const time_fields = SolverStatistics::cpu_time | SolverStatistics::wall_time;
+	auto const stats = SolverStatistics::gather(model, false, statistics_fields & time_fields);
+	for (auto& instruction : program) {
+		switch (instruction.op) {
+		case Op::lp_iterations:
+		case Op::n_nodes:
+			instruction.last_count = 0;
+			break;
+		case Op::cpu_time:
+			instruction.last_time = stats.cpu_now;
+			break;
+		case Op::wall_time:
+			instruction.last_time = stats.wall_now;
+			break;
+		case Op::function:
+			functions[instruction.function_idx].before_reset(model);
+			break;
+		case Op::cumsum:
+			instruction.value = 0.;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+auto RewardExpression::extract(scip::Model& model, bool done) -> Reward {
+	auto const stats = SolverStatistics::gather(model, done, statistics_fields);
+	// The stack is sized when building the expression, no allocation happens here
+	auto top = stack.begin();
+	auto const push = [&top](Reward value) { *(top++) = value; };
+
+	for (auto& instruction : program) {
+		auto const op = instruction.op;
+		if (is_leaf(op)) {
+			switch (op) {
+			case Op::constant:
+				push(instruction.value);
+				break;
+			case Op::lp_iterations: {
+				auto const diff = stats.n_lp_iterations - instruction.last_count;
+				instruction.last_count += diff;
+				push(static_cast<Reward>(diff));
+				break;
+			}
+			case Op::n_nodes: {
+				auto const diff = stats.n_total_nodes - instruction.last_count;
+				instruction.last_count += diff;
+				push(static_cast<Reward>(diff));
+				break;
+			}
+			case Op::cpu_time:
+			case Op::wall_time: {
+				auto const now = op == Op::cpu_time ? stats.cpu_now : stats.wall_now;
+				push(std::chrono::duration<Reward>{now - instruction.last_time}.count());
+				instruction.last_time = now;
+				break;
+			}
+			case Op::is_done:
+				push(stats.done ? 1. : 0.);
+				break;
+			default:
+				push(functions[instruction.function_idx].extract(model, done));
+				break;
+			}
+		} else if (is_unary(op)) {
+			auto& x = *(top - 1);
+			switch (op) {
+			case Op::neg:
+				x = -x;
+				break;
+			case Op::abs:
+				x = std::abs(x);
+				break;
+			case Op::isfinite:
+				x = std::isfinite(x) ? 1. : 0.;
+				break;
+			case Op::isinf:
+				x = std::isinf(x) ? 1. : 0.;
+				break;
+			case Op::isnan:
+				x = std::isnan(x) ? 1. : 0.;
+				break;
+			case Op::cumsum:
+				instruction.value += x;
+				x = instruction.value;
+				break;
+			default:
+				x = math(op, x);
+				break;
+			}
+		} else {
+			auto const y = *(--top);
+			auto& x = *(top - 1);
+			switch (op) {
+			case Op::add:
+				x = x + y;
+				break;
+			case Op::sub:
+				x = x - y;
+				break;
+			case Op::mul:
+				x = x * y;
+				break;
+			case Op::truediv:
+				x = truediv(x, y);
+				break;
+			case Op::floordiv:
+				x = floordiv(x, y);
+				break;
+			case Op::mod:
+				x = mod(x, y);
+				break;
+			default:
+				x = pow(x, y);
+				break;
+			}
+		}
+	}
+	return stack.front();
+}
+
+}  // namespace ecole::reward
@@ -50,6 +50,10 @@ Model Model::copy_orig() const {
 	return std::make_unique<Scimpl>(scimpl->copy_orig());
 }
 
+Model Model::copy_local() const {
+	return std::make_unique<Scimpl>(scimpl->copy_local());
+}
+
 bool Model::operator==(Model const& other) const noexcept {
 	return scimpl == other.scimpl;
 }
@@ -74,10 +78,18 @@ void Model::write_problem(std::filesystem::path const& filename) const {
 	scip::call(SCIPwriteOrigProblem, const_cast<SCIP*>(get_scip_ptr()), filename.c_str(), nullptr, true);
 }
 
+void Model::write_problem(std::filesystem::path const& filename, std::string const& extension) const {
+	scip::call(SCIPwriteOrigProblem, const_cast<SCIP*>(get_scip_ptr()), filename.c_str(), extension.c_str(), true);
+}
+
 void Model::read_problem(std::string const& filename) {
 	scip::call(SCIPreadProb, get_scip_ptr(), filename.c_str(), nullptr);
 }
 
+void Model::read_problem(std::string const& filename, std::string const& extension) {
+	scip::call(SCIPreadProb, get_scip_ptr(), filename.c_str(), extension.c_str());
+}
+
 void Model::set_messagehdlr_quiet(bool quiet) noexcept {
 	SCIPsetMessagehdlrQuiet(get_scip_ptr(), static_cast<SCIP_Bool>(quiet));
 }
@@ -94,6 +106,18 @@ SCIP_STAGE Model::stage() const noexcept {
 	return SCIPgetStage(const_cast<SCIP*>(get_scip_ptr()));
 }
 
+std::size_t Model::memory_used() const noexcept {
+	return static_cast<std::size_t>(SCIPgetMemUsed(const_cast<SCIP*>(get_scip_ptr())));
+}
+
+std::size_t Model::memory_total() const noexcept {
+	return static_cast<std::size_t>(SCIPgetMemTotal(const_cast<SCIP*>(get_scip_ptr())));
+}
+
+std::size_t Model::memory_extern_estimate() const noexcept {
+	return static_cast<std::size_t>(SCIPgetMemExternEstim(const_cast<SCIP*>(get_scip_ptr())));
+}
+
 ParamType Model::get_param_type(std::string const& name) const {
 	auto* scip_param = SCIPgetParam(const_cast<SCIP*>(get_scip_ptr()), name.c_str());
 	if (scip_param == nullptr) {
@@ -244,6 +268,30 @@ std::size_t Model::nnz() const noexcept {
 	return static_cast<std::size_t>(SCIPgetNNZs(const_cast<SCIP*>(get_scip_ptr())));
 }
 
+void Model::fill_lazy_caches() {
+	auto* const scip = get_scip_ptr();
+	auto const stage = SCIPgetStage(scip);
+	if ((stage >= SCIP_STAGE_TRANSFORMED) && (stage <= SCIP_STAGE_SOLVING)) {
+		SCIPgetObjNorm(scip);
+	}
+	if ((stage != SCIP_STAGE_SOLVING) || (SCIPhasCurrentNodeLP(scip) == FALSE)) {
+		return;
+	}
+	for (auto* const row : lp_rows()) {
+		SCIPgetRowLPActivity(scip, row);
+		SCIPgetRowActivity(scip, row);
+	}
+	auto const lp_status = SCIPgetLPSolstat(scip);
+	if (lp_status == SCIP_LPSOLSTAT_OPTIMAL) {
+		for (auto* const col : lp_columns()) {
+			SCIPgetColRedcost(scip, col);
+		}
+	}
+	if ((lp_status == SCIP_LPSOLSTAT_OPTIMAL) || (lp_status == SCIP_LPSOLSTAT_UNBOUNDEDRAY)) {
+		[[maybe_unused]] auto const cands = lp_branch_cands();
+	}
+}
+
 void Model::transform_prob() {
 	scip::call(SCIPtransformProb, get_scip_ptr());
 }
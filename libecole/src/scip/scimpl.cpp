@@ -17,6 +17,8 @@
 #include "ecole/scip/scimpl.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/utility/coroutine.hpp"
+#include "ecole/utility/metrics.hpp"
+#include "ecole/utility/tracing.hpp"
 
 namespace ecole::scip {
 
@@ -29,6 +31,13 @@ namespace {
 using Controller = utility::Coroutine<callback::DynamicCall, SCIP_RESULT>;
 using Executor = typename Controller::Executor;
 
+/** Time waited for the solving thread to reach the next reverse callback, or finish. */
+auto coroutine_wait_seconds() -> utility::metrics::Histogram const& {
+	static auto const histogram = utility::metrics::Histogram{
+		"ecole_scip_coroutine_wait_seconds", "Time waited for SCIP to reach the next callback, or finish solving."};
+	return histogram;
+}
+
 /**
  * Function to add a callback to SCIP.
  *
@@ -66,6 +75,22 @@ auto handle_executor(SCIP* scip, std::weak_ptr<Executor>& weak_executor, callbac
 	}
 }
 
+/**
+ * In a callback, call the user handler on the solver thread.
+ *
+ * Exceptions cannot cross SCIP, so they are reported as an error to SCIP.
+ */
+template <typename Handler, typename CallType>
+auto handle_native(Handler const& handler, CallType const& call, SCIP_RESULT* result) noexcept -> SCIP_RETCODE {
+	try {
+		*result = handler(call);
+		return SCIP_OKAY;
+	} catch (...) {
+		*result = SCIP_DIDNOTRUN;
+		return SCIP_ERROR;
+	}
+}
+
 class ReverseBranchrule : public ::scip::ObjBranchrule {
 public:
 	ReverseBranchrule(
@@ -73,6 +98,7 @@ public:
 		int priority,
 		int maxdepth,
 		SCIP_Real maxbounddist,
+		callback::BranchruleConstructor::Handler handler,
 		std::weak_ptr<Executor> weak_executor) :
 		ObjBranchrule{
 			scip,
@@ -81,6 +107,7 @@ public:
 			priority,
 			maxdepth,
 			maxbounddist},
+		m_handler{std::move(handler)},
 		m_weak_executor{std::move(weak_executor)} {}
 
 	auto scip_execlp(SCIP* scip, SCIP_BRANCHRULE* /*branchrule*/, SCIP_Bool allow_add_constraints, SCIP_RESULT* result)
@@ -102,9 +129,14 @@ public:
 	}
 
 private:
+	callback::BranchruleConstructor::Handler m_handler;
 	std::weak_ptr<Executor> m_weak_executor;
 
 	auto scip_exec_any(SCIP* scip, SCIP_RESULT* result, callback::BranchruleCall call) -> SCIP_RETCODE {
+		// Native handler are run directly on the solver thread, without pausing iterative solving.
+		if (m_handler) {
+			return handle_native(m_handler, call, result);
+		}
 		auto retcode = SCIP_OKAY;
 		std::tie(retcode, *result) = handle_executor(scip, m_weak_executor, call);
 		return retcode;
@@ -119,7 +151,8 @@ auto include_reverse_callback<callback::Type::Branchrule>(
 	scip::call(
 		SCIPincludeObjBranchrule,
 		scip,
-		new ReverseBranchrule(scip, args.priority, args.max_depth, args.max_bound_distance, std::move(executor)),
+		new ReverseBranchrule(
+			scip, args.priority, args.max_depth, args.max_bound_distance, std::move(args.handler), std::move(executor)),
 		true);
 }  // NOLINT
 
@@ -215,6 +248,20 @@ auto Scimpl::get_scip_ptr() noexcept -> SCIP* {
 	return m_scip.get();
 }
 
+namespace {
+
+/** Copy the (transformed) problem, either globally or with the local bounds of the focus node. */
+auto copy_transformed(SCIP* source, bool global) -> std::unique_ptr<SCIP, ScipDeleter> {
+	auto dest = create_scip();
+	// Copy operation is not thread safe
+	static auto m = std::mutex{};
+	auto g = std::lock_guard{m};
+	scip::call(SCIPcopy, source, dest.get(), nullptr, nullptr, "", global, false, false, false, nullptr);
+	return dest;
+}
+
+}  // namespace
+
 auto Scimpl::copy() const -> Scimpl {
 	if (m_scip == nullptr) {
 		return {nullptr};
@@ -222,12 +269,17 @@ auto Scimpl::copy() const -> Scimpl {
 	if (SCIPgetStage(m_scip.get()) == SCIP_STAGE_INIT) {
 		return {create_scip()};
 	}
-	auto dest = create_scip();
-	// Copy operation is not thread safe
-	static auto m = std::mutex{};
-	auto g = std::lock_guard{m};
-	scip::call(SCIPcopy, m_scip.get(), dest.get(), nullptr, nullptr, "", true, false, false, false, nullptr);
-	return {std::move(dest)};
+	return {copy_transformed(m_scip.get(), true)};
+}
+
+auto Scimpl::copy_local() const -> Scimpl {
+	if (m_scip == nullptr) {
+		return {nullptr};
+	}
+	if (SCIPgetStage(m_scip.get()) == SCIP_STAGE_INIT) {
+		return {create_scip()};
+	}
+	return {copy_transformed(m_scip.get(), false)};
 }
 
 auto Scimpl::copy_orig() const -> Scimpl {
@@ -247,6 +299,7 @@ auto Scimpl::copy_orig() const -> Scimpl {
 
 auto Scimpl::solve_iter(nonstd::span<callback::DynamicConstructor const> arg_packs)
 	-> std::optional<callback::DynamicCall> {
+	ECOLE_TRACE_SPAN("Scimpl::solve_iter", "scip");
 	auto* const scip_ptr = get_scip_ptr();
 	m_controller = std::make_unique<Controller>([=](std::weak_ptr<Executor> const& executor) {
 		for (auto const pack : arg_packs) {
@@ -254,11 +307,15 @@ auto Scimpl::solve_iter(nonstd::span<callback::DynamicConstructor const> arg_pac
 		}
 		scip::call(SCIPsolve, scip_ptr);
 	});
+	auto const timer = utility::metrics::Timer{coroutine_wait_seconds()};
 	return m_controller->wait();
 }
 
 auto Scimpl::solve_iter_continue(SCIP_RESULT result) -> std::optional<callback::DynamicCall> {
+	// Includes solving until the next callback on the solver thread
+	ECOLE_TRACE_SPAN("Scimpl::solve_iter_continue", "scip");
 	m_controller->resume(result);
+	auto const timer = utility::metrics::Timer{coroutine_wait_seconds()};
 	return m_controller->wait();
 }
 
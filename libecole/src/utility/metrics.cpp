@@ -0,0 +1,618 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ecole/utility/metrics.hpp"
+
+namespace ecole::utility::metrics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**********************************
+ *  Per thread values of metrics  *
+ **********************************/
+
+enum class Type { counter, histogram };
+
+/** A time series, identified by its formatted labels in a Family. */
+struct Series {
+	std::size_t slot;
+	std::vector<double> bounds;
+};
+
+/** All the time series of a metric name. */
+struct Family {
+	std::string help;
+	Type type;
+	std::map<std::string, Series> series;
+};
+
+/** The values of all metrics written by a single thread. */
+struct Shard {
+	std::array<std::atomic<std::uint64_t>, max_slots> slots{};
+};
+
+std::atomic<bool> enabled{false};
+
+struct Registry {
+	std::mutex mutex;
+	std::map<std::string, Family, std::less<>> families;
+	std::size_t n_slots = 0;
+	/** Slots holding the bits of a double (the sum of histograms) rather than an integer. */
+	std::array<bool, max_slots> is_real{};
+	/** The shards of living threads. */
+	std::vector<Shard const*> shards;
+	/** The values of the threads that exited. */
+	std::array<std::uint64_t, max_slots> retired{};
+	/** The values at the last reset, subtracted from the current ones. */
+	std::array<std::uint64_t, max_slots> baseline{};
+};
+
+auto registry() -> Registry& {
+	// Never destroyed, as threads may still exit during static destruction
+	static auto* const reg = new Registry{};  // NOLINT(cppcoreguidelines-owning-memory)
+	return *reg;
+}
+
+auto to_real(std::uint64_t bits) noexcept -> double {
+	auto real = double{};
+	std::memcpy(&real, &bits, sizeof(real));
+	return real;
+}
+
+auto to_bits(double real) noexcept -> std::uint64_t {
+	auto bits = std::uint64_t{};
+	std::memcpy(&bits, &real, sizeof(bits));
+	return bits;
+}
+
+/** Sum of the values of a slot, including exited threads, with the registry locked. */
+auto raw_total(Registry const& reg, std::size_t slot) -> std::uint64_t {
+	if (reg.is_real[slot]) {
+		auto total = to_real(reg.retired[slot]);
+		for (auto const* shard : reg.shards) {
+			total += to_real(shard->slots[slot].load(std::memory_order_relaxed));
+		}
+		return to_bits(total);
+	}
+	auto total = reg.retired[slot];
+	for (auto const* shard : reg.shards) {
+		total += shard->slots[slot].load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
+/** Value of a slot since the last reset, with the registry locked. */
+auto total(Registry const& reg, std::size_t slot) -> std::uint64_t {
+	return raw_total(reg, slot) - reg.baseline[slot];
+}
+
+auto total_real(Registry const& reg, std::size_t slot) -> double {
+	return to_real(raw_total(reg, slot)) - to_real(reg.baseline[slot]);
+}
+
+/** Registers its shard while the thread lives, and folds its values in the retired ones when the thread exits. */
+class ThreadShard {
+public:
+	ThreadShard() {
+		auto& reg = registry();
+		auto const lock = std::lock_guard{reg.mutex};
+		reg.shards.push_back(&shard);
+	}
+	ThreadShard(ThreadShard const&) = delete;
+	ThreadShard(ThreadShard&&) = delete;
+	~ThreadShard() {
+		auto& reg = registry();
+		auto const lock = std::lock_guard{reg.mutex};
+		for (std::size_t slot = 0; slot < reg.n_slots; ++slot) {
+			auto const value = shard.slots[slot].load(std::memory_order_relaxed);
+			if (reg.is_real[slot]) {
+				reg.retired[slot] = to_bits(to_real(reg.retired[slot]) + to_real(value));
+			} else {
+				reg.retired[slot] += value;
+			}
+		}
+		reg.shards.erase(std::find(reg.shards.begin(), reg.shards.end(), &shard));
+	}
+	auto operator=(ThreadShard const&) -> ThreadShard& = delete;
+	auto operator=(ThreadShard&&) -> ThreadShard& = delete;
+
+	Shard shard;
+};
+
+auto thread_shard() -> Shard& {
+	thread_local auto local = ThreadShard{};
+	return local.shard;
+}
+
+// Slots are only written by their thread, so a load and store is enough to add atomically
+auto add(std::atomic<std::uint64_t>& slot, std::uint64_t amount) noexcept -> void {
+	slot.store(slot.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+auto add_real(std::atomic<std::uint64_t>& slot, double amount) noexcept -> void {
+	slot.store(to_bits(to_real(slot.load(std::memory_order_relaxed)) + amount), std::memory_order_relaxed);
+}
+
+auto now_ns() noexcept -> std::int64_t {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+/****************************
+ *  Registration of series  *
+ ****************************/
+
+auto is_valid_name(std::string_view name, bool allow_colon) -> bool {
+	auto const is_valid_char = [allow_colon](char c, bool first) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (allow_colon && c == ':') ||
+					 (!first && c >= '0' && c <= '9');
+	};
+	if (name.empty() || !is_valid_char(name.front(), true)) {
+		return false;
+	}
+	return std::all_of(name.begin() + 1, name.end(), [&](char c) { return is_valid_char(c, false); });
+}
+
+auto escape(std::string_view str, bool quote) -> std::string {
+	auto escaped = std::string{};
+	escaped.reserve(str.size());
+	for (auto const c : str) {
+		if (c == '\\') {
+			escaped += "\\\\";
+		} else if (c == '\n') {
+			escaped += "\\n";
+		} else if (quote && c == '"') {
+			escaped += "\\\"";
+		} else {
+			escaped += c;
+		}
+	}
+	return escaped;
+}
+
+/** Labels in braces, or nothing if there are none. */
+auto in_braces(std::string const& labels) -> std::string {
+	return labels.empty() ? std::string{} : fmt::format("{{{}}}", labels);
+}
+
+/** Labels in the format of a Prometheus series, without braces. */
+auto format_labels(Labels const& labels) -> std::string {
+	auto formatted = std::string{};
+	for (auto const& [name, value] : labels) {
+		if (!is_valid_name(name, false) || name == "le") {
+			throw std::invalid_argument{fmt::format("Invalid metric label name {}.", name)};
+		}
+		if (!formatted.empty()) {
+			formatted += ',';
+		}
+		formatted += fmt::format("{}=\"{}\"", name, escape(value, true));
+	}
+	return formatted;
+}
+
+auto register_series(
+	std::string_view name,
+	std::string_view help,
+	Type type,
+	Labels const& labels,
+	std::vector<double> const& bounds) -> std::size_t {
+	if (!is_valid_name(name, true)) {
+		throw std::invalid_argument{fmt::format("Invalid metric name {}.", name)};
+	}
+	auto const formatted_labels = format_labels(labels);
+
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	auto family_iter = reg.families.find(name);
+	if (family_iter == reg.families.end()) {
+		family_iter = reg.families.emplace(std::string{name}, Family{std::string{help}, type, {}}).first;
+	} else if ((family_iter->second.type != type) || (family_iter->second.help != help)) {
+		throw std::invalid_argument{fmt::format("Metric {} is already registered with another type or help.", name)};
+	}
+
+	auto& family = family_iter->second;
+	if (auto const series_iter = family.series.find(formatted_labels); series_iter != family.series.end()) {
+		if (series_iter->second.bounds != bounds) {
+			throw std::invalid_argument{fmt::format("Histogram {} is already registered with other bounds.", name)};
+		}
+		return series_iter->second.slot;
+	}
+
+	auto const n_slots = (type == Type::counter) ? 1 : bounds.size() + 2;
+	if (reg.n_slots + n_slots > max_slots) {
+		throw std::length_error{fmt::format("Cannot register metric {}, all {} values are used.", name, max_slots)};
+	}
+	auto const slot = reg.n_slots;
+	reg.n_slots += n_slots;
+	if (type == Type::histogram) {
+		reg.is_real[slot + bounds.size() + 1] = true;
+	}
+	family.series.emplace(formatted_labels, Series{slot, bounds});
+	return slot;
+}
+
+auto check_bounds(std::vector<double> const& bounds) -> std::vector<double> const& {
+	auto const is_finite = [](double bound) { return std::isfinite(bound); };
+	if (!std::all_of(bounds.begin(), bounds.end(), is_finite) ||
+			std::adjacent_find(bounds.begin(), bounds.end(), std::greater_equal<>{}) != bounds.end()) {
+		throw std::invalid_argument{"Histogram bounds must be finite and strictly increasing."};
+	}
+	return bounds;
+}
+
+/*******************************
+ *  Unix domain socket server  *
+ *******************************/
+
+class FileDescriptor {
+public:
+	explicit FileDescriptor(int fd_) noexcept : fd{fd_} {}
+	FileDescriptor(FileDescriptor const&) = delete;
+	FileDescriptor(FileDescriptor&&) = delete;
+	~FileDescriptor() {
+		if (fd >= 0) {
+			::close(fd);
+		}
+	}
+	auto operator=(FileDescriptor const&) -> FileDescriptor& = delete;
+	auto operator=(FileDescriptor&&) -> FileDescriptor& = delete;
+
+	[[nodiscard]] auto get() const noexcept -> int { return fd; }
+
+private:
+	int fd;
+};
+
+auto check_syscall(int result, char const* message) -> int {
+	if (result < 0) {
+		throw std::system_error{{errno, std::generic_category()}, message};
+	}
+	return result;
+}
+
+/** Close the file descriptor in child processes, as SOCK_CLOEXEC, O_CLOEXEC, and accept4 are not portable. */
+auto set_cloexec(int fd) -> int {
+	if (fd >= 0) {
+		::fcntl(fd, F_SETFD, FD_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+	}
+	return fd;
+}
+
+/** Report a closed connection as an error rather than a SIGPIPE, with SO_NOSIGPIPE where MSG_NOSIGNAL is missing. */
+#ifdef MSG_NOSIGNAL
+constexpr int send_flags = MSG_NOSIGNAL;
+auto disable_sigpipe(int /*fd*/) -> void {}
+#else
+constexpr int send_flags = 0;
+auto disable_sigpipe(int fd) -> void {
+	auto const enable = int{1};
+	::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+}
+#endif
+
+/** Time waited for the request of a client, after which the metrics are sent as plain text. */
+constexpr int request_timeout_ms = 100;
+constexpr std::size_t max_request_size = 8192;
+
+/** Read the beginning of an HTTP request, if the client sends one. */
+auto read_request(int client) -> std::string {
+	auto request = std::string{};
+	auto buffer = std::array<char, 1024>{};  // NOLINT(readability-magic-numbers)
+	while (request.size() < max_request_size && request.find("\r\n\r\n") == std::string::npos) {
+		auto client_poll = pollfd{client, POLLIN, 0};
+		if (::poll(&client_poll, 1, request_timeout_ms) <= 0) {
+			break;
+		}
+		auto const n_read = ::recv(client, buffer.data(), buffer.size(), 0);
+		if (n_read <= 0) {
+			break;
+		}
+		request.append(buffer.data(), static_cast<std::size_t>(n_read));
+	}
+	return request;
+}
+
+auto send_all(int client, std::string_view data) -> void {
+	while (!data.empty()) {
+		auto const sent = ::send(client, data.data(), data.size(), send_flags);
+		if (sent < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return;  // The client went away
+		}
+		data.remove_prefix(static_cast<std::size_t>(sent));
+	}
+}
+
+auto respond(int client) -> void {
+	disable_sigpipe(client);
+	auto const request = read_request(client);
+	auto const body = to_prometheus();
+	auto const is_http = (request.rfind("GET ", 0) == 0) || (request.rfind("HEAD ", 0) == 0);
+	if (is_http) {
+		send_all(
+			client,
+			fmt::format(
+				"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: {}\r\nConnection: close\r\n\r\n",
+				body.size()));
+		if (request.rfind("HEAD ", 0) == 0) {
+			return;
+		}
+	}
+	send_all(client, body);
+}
+
+}  // namespace
+
+/*****************************
+ *  Definition of functions  *
+ *****************************/
+
+auto enable() -> void {
+	enabled.store(true, std::memory_order_release);
+}
+
+auto disable() -> void {
+	enabled.store(false, std::memory_order_release);
+}
+
+auto is_enabled() noexcept -> bool {
+	return enabled.load(std::memory_order_relaxed);
+}
+
+auto reset() -> void {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	for (std::size_t slot = 0; slot < reg.n_slots; ++slot) {
+		reg.baseline[slot] = raw_total(reg, slot);
+	}
+}
+
+auto to_prometheus() -> std::string {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	auto text = std::string{};
+	for (auto const& [name, family] : reg.families) {
+		auto const is_counter = family.type == Type::counter;
+		text += fmt::format("# HELP {} {}\n", name, escape(family.help, false));
+		text += fmt::format("# TYPE {} {}\n", name, is_counter ? "counter" : "histogram");
+		for (auto const& [labels, series] : family.series) {
+			if (is_counter) {
+				text += fmt::format("{}{} {}\n", name, in_braces(labels), total(reg, series.slot));
+				continue;
+			}
+			auto const separator = labels.empty() ? "" : ",";
+			// Buckets are stored separately and reported cumulatively
+			auto cumulative = std::uint64_t{0};
+			for (std::size_t i = 0; i <= series.bounds.size(); ++i) {
+				cumulative += total(reg, series.slot + i);
+				auto const bound = (i < series.bounds.size()) ? fmt::format("{}", series.bounds[i]) : std::string{"+Inf"};
+				text += fmt::format("{}_bucket{{{}{}le=\"{}\"}} {}\n", name, labels, separator, bound, cumulative);
+			}
+			auto const sum = total_real(reg, series.slot + series.bounds.size() + 1);
+			text += fmt::format("{}_sum{} {}\n", name, in_braces(labels), sum);
+			text += fmt::format("{}_count{} {}\n", name, in_braces(labels), cumulative);
+		}
+	}
+	return text;
+}
+
+auto write_prometheus(std::filesystem::path const& filename) -> void {
+	auto temporary = filename;
+	temporary += ".tmp";
+	{
+		auto file = std::ofstream{temporary};
+		if (!file) {
+			throw std::runtime_error{fmt::format("Cannot open metrics file {}.", temporary.string())};
+		}
+		file << to_prometheus();
+		if (!file.flush()) {
+			throw std::runtime_error{fmt::format("Cannot write metrics file {}.", temporary.string())};
+		}
+	}
+	// Readers, such as the textfile collector of the Prometheus node exporter, never see a partial file
+	std::filesystem::rename(temporary, filename);
+}
+
+auto default_latency_bounds() -> std::vector<double> {
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	return {1e-5, 2.5e-5, 5e-5, 1e-4, 2.5e-4, 5e-4, 1e-3, 2.5e-3, 5e-3, 1e-2, 2.5e-2, 5e-2, 0.1, 0.25, 0.5, 1., 2.5, 5.,
+					10.};
+}
+
+/***************************
+ *  Definition of Counter  *
+ ***************************/
+
+Counter::Counter(std::string_view name, std::string_view help, Labels const& labels) :
+	slot{register_series(name, help, Type::counter, labels, {})} {}
+
+auto Counter::increment(std::uint64_t amount) const noexcept -> void {
+	if (is_enabled()) {
+		add(thread_shard().slots[slot], amount);
+	}
+}
+
+auto Counter::value() const -> std::uint64_t {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	return total(reg, slot);
+}
+
+/*****************************
+ *  Definition of Histogram  *
+ *****************************/
+
+Histogram::Histogram(std::string_view name, std::string_view help, std::vector<double> bounds, Labels const& labels) :
+	slot{register_series(name, help, Type::histogram, labels, check_bounds(bounds))}, upper_bounds{std::move(bounds)} {}
+
+auto Histogram::observe(double value) const noexcept -> void {
+	if (!is_enabled()) {
+		return;
+	}
+	// Values are in the first bucket whose bound is greater or equal, NaN in the last one
+	auto& shard = thread_shard();
+	if (std::isnan(value)) {
+		// Not added to the sum, which would stay NaN forever
+		add(shard.slots[slot + upper_bounds.size()], 1);
+		return;
+	}
+	auto const bound_iter = std::lower_bound(upper_bounds.begin(), upper_bounds.end(), value);
+	add(shard.slots[slot + static_cast<std::size_t>(bound_iter - upper_bounds.begin())], 1);
+	add_real(shard.slots[slot + upper_bounds.size() + 1], value);
+}
+
+auto Histogram::count() const -> std::uint64_t {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	auto count = std::uint64_t{0};
+	for (std::size_t i = 0; i <= upper_bounds.size(); ++i) {
+		count += total(reg, slot + i);
+	}
+	return count;
+}
+
+auto Histogram::sum() const -> double {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	return total_real(reg, slot + upper_bounds.size() + 1);
+}
+
+/*************************
+ *  Definition of Timer  *
+ *************************/
+
+Timer::Timer(Histogram const& histogram_) noexcept : histogram{&histogram_} {
+	if (is_enabled()) {
+		start_ns = now_ns();
+	}
+}
+
+Timer::~Timer() {
+	if (start_ns >= 0) {
+		histogram->observe(static_cast<double>(now_ns() - start_ns) / 1e9);
+	}
+}
+
+/**********************************
+ *  Definition of SocketExporter  *
+ **********************************/
+
+class SocketExporter::Server {
+public:
+	Server(std::filesystem::path const& path) :
+		listener{set_cloexec(check_syscall(::socket(AF_UNIX, SOCK_STREAM, 0), "Could not create metrics socket"))},
+		stop_pipe{make_pipe()},
+		stop_read{stop_pipe[0]},
+		stop_write{stop_pipe[1]} {
+		auto address = sockaddr_un{};
+		address.sun_family = AF_UNIX;
+		auto const& native_path = path.native();
+		if (native_path.size() >= sizeof(address.sun_path)) {
+			throw std::invalid_argument{fmt::format("Metrics socket path {} is too long.", native_path)};
+		}
+		std::copy(native_path.begin(), native_path.end(), static_cast<char*>(address.sun_path));
+		check_syscall(
+			::bind(listener.get(), reinterpret_cast<sockaddr const*>(&address), sizeof(address)),  // NOLINT
+			"Could not bind metrics socket");
+		check_syscall(::listen(listener.get(), SOMAXCONN), "Could not listen on metrics socket");
+		thread = std::thread{[this] { serve(); }};
+	}
+
+	Server(Server const&) = delete;
+	Server(Server&&) = delete;
+	~Server() {
+		auto const stop = char{0};
+		while ((::write(stop_write.get(), &stop, 1) < 0) && (errno == EINTR)) {
+		}
+		thread.join();
+	}
+	auto operator=(Server const&) -> Server& = delete;
+	auto operator=(Server&&) -> Server& = delete;
+
+private:
+	FileDescriptor listener;
+	std::array<int, 2> stop_pipe;
+	FileDescriptor stop_read;
+	FileDescriptor stop_write;
+	std::thread thread;
+
+	static auto make_pipe() -> std::array<int, 2> {
+		auto fds = std::array<int, 2>{};
+		check_syscall(::pipe(fds.data()), "Could not create metrics socket pipe");
+		set_cloexec(fds[0]);
+		set_cloexec(fds[1]);
+		return fds;
+	}
+
+	auto serve() noexcept -> void {
+		while (true) {
+			auto fds = std::array<pollfd, 2>{{{listener.get(), POLLIN, 0}, {stop_read.get(), POLLIN, 0}}};
+			if (::poll(fds.data(), fds.size(), -1) < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				return;
+			}
+			if (fds[1].revents != 0) {
+				return;
+			}
+			if ((fds[0].revents & POLLIN) != 0) {
+				auto const client = FileDescriptor{set_cloexec(::accept(listener.get(), nullptr, nullptr))};
+				if (client.get() >= 0) {
+					try {
+						respond(client.get());
+					} catch (...) {
+						// The server keeps serving other clients
+					}
+				}
+			}
+		}
+	}
+};
+
+SocketExporter::SocketExporter(std::filesystem::path path) : the_path{std::move(path)} {
+	// Replace a socket left by a previous process, but never another kind of file
+	if (std::filesystem::is_socket(the_path)) {
+		std::filesystem::remove(the_path);
+	} else if (std::filesystem::exists(the_path)) {
+		throw std::invalid_argument{fmt::format("Metrics socket path {} exists and is not a socket.", the_path.string())};
+	}
+	server = std::make_unique<Server>(the_path);
+}
+
+SocketExporter::~SocketExporter() {
+	close();
+}
+
+auto SocketExporter::close() -> void {
+	if (server != nullptr) {
+		server.reset();
+		auto error = std::error_code{};
+		std::filesystem::remove(the_path, error);
+	}
+}
+
+}  // namespace ecole::utility::metrics
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "ecole/utility/shared-ring.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+constexpr std::size_t cache_line = 64;
+constexpr std::uint64_t ring_magic = 0x65636f6c6572696e;  // "ecolerin"
+
+/** States of a slot, changed in turn by the producer and the consumer. */
+enum SlotState : std::uint32_t { free_slot = 0, written_slot = 1, reading_slot = 2 };
+
+constexpr auto round_up(std::size_t size) noexcept -> std::size_t {
+	return (size + cache_line - 1) / cache_line * cache_line;
+}
+
+/** POSIX names of shared memory objects start with a single slash. */
+auto posix_name(std::string const& name) -> std::string {
+	if (!name.empty() && name.front() == '/') {
+		return name;
+	}
+	return "/" + name;
+}
+
+[[noreturn]] auto throw_system_error(std::string const& what) -> void {
+	throw std::system_error{{errno, std::generic_category()}, what};
+}
+
+/** Wait until the predicate holds, spinning then sleeping with an exponential backoff. */
+template <typename Predicate> auto wait_until(Predicate&& predicate, SharedRing::Timeout timeout) -> bool {
+	constexpr auto n_spins = 128;
+	constexpr auto max_sleep = std::chrono::microseconds{500};
+	for (auto i = 0; i < n_spins; ++i) {
+		if (predicate()) {
+			return true;
+		}
+	}
+	auto deadline = std::optional<std::chrono::steady_clock::time_point>{};
+	if (timeout.has_value()) {
+		deadline = std::chrono::steady_clock::now() + timeout.value();
+	}
+	auto sleep = std::chrono::microseconds{1};
+	while (!predicate()) {
+		if (deadline.has_value() && std::chrono::steady_clock::now() >= deadline.value()) {
+			return false;
+		}
+		std::this_thread::sleep_for(sleep);
+		sleep = std::min(2 * sleep, max_sleep);
+	}
+	return true;
+}
+
+/** Layout of the beginning of the shared memory. */
+struct RingHeader {
+	std::uint64_t magic;
+	std::uint64_t n_slots;
+	std::uint64_t slot_capacity;
+	// Producer and consumer counters on their own cache lines to avoid false sharing
+	alignas(cache_line) std::atomic<std::uint64_t> n_written;
+	alignas(cache_line) std::atomic<std::uint64_t> n_read;
+};
+
+/** Layout of the beginning of every slot, followed by the message data. */
+struct alignas(cache_line) SlotHeader {
+	std::atomic<std::uint32_t> state;
+	std::uint64_t size;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Atomics in shared memory must be lock free");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Atomics in shared memory must be lock free");
+
+constexpr auto header_size = round_up(sizeof(RingHeader));
+constexpr auto slot_header_size = round_up(sizeof(SlotHeader));
+
+constexpr auto slot_stride(std::size_t slot_capacity) noexcept -> std::size_t {
+	return slot_header_size + round_up(slot_capacity);
+}
+
+auto header_of(void* memory) noexcept -> RingHeader& {
+	return *static_cast<RingHeader*>(memory);
+}
+
+auto slot_header_of(void* memory, std::size_t slot) noexcept -> SlotHeader& {
+	auto* const base = static_cast<std::byte*>(memory);
+	auto const stride = slot_stride(header_of(memory).slot_capacity);
+	return *reinterpret_cast<SlotHeader*>(base + header_size + slot * stride);
+}
+
+auto slot_data_of(void* memory, std::size_t slot) noexcept -> std::byte* {
+	return reinterpret_cast<std::byte*>(&slot_header_of(memory, slot)) + slot_header_size;
+}
+
+}  // namespace
+
+/*******************************
+ *  Definition of SharedRing  *
+ *******************************/
+
+auto SharedRing::create(std::string name, std::size_t n_slots, std::size_t slot_capacity) -> SharedRing {
+	if ((n_slots == 0) || (slot_capacity == 0)) {
+		throw std::invalid_argument{
+			fmt::format("Number of slots ({}) and slot capacity ({}) must be positive.", n_slots, slot_capacity)};
+	}
+	auto const size = header_size + n_slots * slot_stride(slot_capacity);
+	auto const shm_name = posix_name(name);
+
+	auto const fd = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+	if (fd < 0) {
+		throw_system_error(fmt::format("Could not create shared memory {}", shm_name));
+	}
+	if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+		auto const error = errno;
+		close(fd);
+		shm_unlink(shm_name.c_str());
+		errno = error;
+		throw_system_error(fmt::format("Could not allocate {} bytes of shared memory", size));
+	}
+	auto* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (memory == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) macro defined by POSIX
+		shm_unlink(shm_name.c_str());
+		throw_system_error(fmt::format("Could not map shared memory {}", shm_name));
+	}
+
+	auto ring = SharedRing{std::move(name), memory, size, true};
+	// Memory is zero initialized by ftruncate, atomics are created in place
+	auto* const ring_header = new (memory) RingHeader{0, n_slots, slot_capacity, {0}, {0}};
+	for (std::size_t slot = 0; slot < n_slots; ++slot) {
+		new (&slot_header_of(memory, slot)) SlotHeader{{free_slot}, 0};
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	ring_header->magic = ring_magic;
+	return ring;
+}
+
+auto SharedRing::open(std::string name) -> SharedRing {
+	auto const shm_name = posix_name(name);
+	auto const fd = shm_open(shm_name.c_str(), O_RDWR, 0);
+	if (fd < 0) {
+		throw_system_error(fmt::format("Could not open shared memory {}", shm_name));
+	}
+	struct stat status = {};
+	if (fstat(fd, &status) != 0) {
+		auto const error = errno;
+		close(fd);
+		errno = error;
+		throw_system_error(fmt::format("Could not query the size of shared memory {}", shm_name));
+	}
+	auto const size = static_cast<std::size_t>(status.st_size);
+	if (size < header_size) {
+		close(fd);
+		throw std::invalid_argument{fmt::format("Shared memory {} is not an initialized SharedRing.", shm_name)};
+	}
+	auto* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (memory == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) macro defined by POSIX
+		throw_system_error(fmt::format("Could not map shared memory {}", shm_name));
+	}
+
+	auto ring = SharedRing{std::move(name), memory, size, false};
+	auto const& ring_header = header_of(memory);
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (
+		(ring_header.magic != ring_magic) || (ring_header.n_slots == 0) ||
+		(size < header_size + ring_header.n_slots * slot_stride(ring_header.slot_capacity))) {
+		throw std::invalid_argument{fmt::format("Shared memory {} is not an initialized SharedRing.", shm_name)};
+	}
+	return ring;
+}
+
+SharedRing::SharedRing(std::string name, void* memory_, std::size_t memory_size_, bool owner_) noexcept :
+	the_name{std::move(name)}, memory{memory_}, memory_size{memory_size_}, owner{owner_} {}
+
+SharedRing::SharedRing(SharedRing&& other) noexcept :
+	the_name{std::move(other.the_name)},
+	memory{std::exchange(other.memory, nullptr)},
+	memory_size{std::exchange(other.memory_size, 0)},
+	owner{std::exchange(other.owner, false)},
+	writing{std::exchange(other.writing, false)} {}
+
+SharedRing::~SharedRing() {
+	if (memory != nullptr) {
+		munmap(memory, memory_size);
+		if (owner) {
+			shm_unlink(posix_name(the_name).c_str());
+		}
+	}
+}
+
+auto SharedRing::operator=(SharedRing&& other) noexcept -> SharedRing& {
+	if (this != &other) {
+		auto tmp = SharedRing{std::move(other)};
+		std::swap(the_name, tmp.the_name);
+		std::swap(memory, tmp.memory);
+		std::swap(memory_size, tmp.memory_size);
+		std::swap(owner, tmp.owner);
+		std::swap(writing, tmp.writing);
+	}
+	return *this;
+}
+
+auto SharedRing::begin_write(Timeout timeout) -> std::optional<nonstd::span<std::byte>> {
+	auto const slot = header_of(memory).n_written.load(std::memory_order_relaxed) % n_slots();
+	auto& state = slot_header_of(memory, slot).state;
+	if (!wait_until([&state] { return state.load(std::memory_order_acquire) == free_slot; }, timeout)) {
+		return {};
+	}
+	writing = true;
+	return nonstd::span{slot_data_of(memory, slot), slot_capacity()};
+}
+
+auto SharedRing::commit_write(std::size_t size) -> void {
+	if (!writing) {
+		throw std::logic_error{"No message being written, begin_write must be called first."};
+	}
+	if (size > slot_capacity()) {
+		throw std::invalid_argument{fmt::format("Message of {} bytes exceeds slot capacity {}.", size, slot_capacity())};
+	}
+	auto const slot = header_of(memory).n_written.load(std::memory_order_relaxed) % n_slots();
+	auto& slot_head = slot_header_of(memory, slot);
+	slot_head.size = size;
+	slot_head.state.store(written_slot, std::memory_order_release);
+	header_of(memory).n_written.fetch_add(1, std::memory_order_release);
+	writing = false;
+}
+
+auto SharedRing::read(Timeout timeout) -> std::optional<Message> {
+	auto const slot = header_of(memory).n_read.load(std::memory_order_relaxed) % n_slots();
+	auto& slot_head = slot_header_of(memory, slot);
+	if (!wait_until([&slot_head] { return slot_head.state.load(std::memory_order_acquire) == written_slot; }, timeout)) {
+		return {};
+	}
+	slot_head.state.store(reading_slot, std::memory_order_relaxed);
+	header_of(memory).n_read.fetch_add(1, std::memory_order_release);
+	return Message{slot, {slot_data_of(memory, slot), slot_head.size}};
+}
+
+auto SharedRing::release(std::size_t slot) -> void {
+	if (slot >= n_slots()) {
+		throw std::invalid_argument{fmt::format("Slot {} does not exist in a ring of {} slots.", slot, n_slots())};
+	}
+	auto expected = std::uint32_t{reading_slot};
+	if (!slot_header_of(memory, slot).state.compare_exchange_strong(expected, free_slot, std::memory_order_release)) {
+		throw std::invalid_argument{fmt::format("Slot {} is not being read.", slot)};
+	}
+}
+
+auto SharedRing::n_slots() const noexcept -> std::size_t {
+	return header_of(memory).n_slots;
+}
+
+auto SharedRing::slot_capacity() const noexcept -> std::size_t {
+	return header_of(memory).slot_capacity;
+}
+
+auto SharedRing::n_written() const noexcept -> std::uint64_t {
+	return header_of(memory).n_written.load(std::memory_order_acquire);
+}
+
+auto SharedRing::n_read() const noexcept -> std::uint64_t {
+	return header_of(memory).n_read.load(std::memory_order_acquire);
+}
+
+}  // namespace ecole::utility
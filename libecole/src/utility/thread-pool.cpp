@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+thread_local bool is_worker_thread = false;
+
+}  // namespace
+
+ThreadPool::ThreadPool(std::size_t n_threads) {
+	if (n_threads == 0) {
+		n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	workers.reserve(n_threads);
+	for (std::size_t i = 0; i < n_threads; ++i) {
+		workers.emplace_back([this] { work(); });
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		auto const lock = std::lock_guard{tasks_mutex};
+		stopping = true;
+	}
+	tasks_available.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+auto ThreadPool::shared() -> ThreadPool& {
+	static auto pool = ThreadPool{};
+	return pool;
+}
+
+auto ThreadPool::in_worker_thread() noexcept -> bool {
+	return is_worker_thread;
+}
+
+auto ThreadPool::push(std::function<void()> task) -> void {
+	{
+		auto const lock = std::lock_guard{tasks_mutex};
+		tasks.push(std::move(task));
+	}
+	tasks_available.notify_one();
+}
+
+auto ThreadPool::work() -> void {
+	is_worker_thread = true;
+	while (true) {
+		auto task = std::function<void()>{};
+		{
+			auto lock = std::unique_lock{tasks_mutex};
+			tasks_available.wait(lock, [this] { return stopping || !tasks.empty(); });
+			// Remaining tasks are still executed when stopping
+			if (tasks.empty()) {
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+		task();
+	}
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include "ecole/utility/tracing.hpp"
+
+namespace ecole::utility::tracing {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/** Fixed size buffer of the events of a single thread, overwriting the oldest events when full. */
+class ThreadBuffer {
+public:
+	ThreadBuffer(std::uint32_t thread_id_, std::size_t capacity_) : thread_id{thread_id_}, capacity{capacity_} {}
+
+	[[nodiscard]] auto id() const noexcept { return thread_id; }
+
+	auto push(Event const& event) -> void {
+		auto const lock = std::lock_guard{mutex};
+		if (capacity == 0) {
+			return;
+		}
+		if (events.size() < capacity) {
+			events.push_back(event);
+		} else {
+			events[next] = event;
+			next = (next + 1) % capacity;
+		}
+	}
+
+	/** Append the events to the output, oldest first. */
+	auto copy_to(std::vector<Event>& out) -> void {
+		auto const lock = std::lock_guard{mutex};
+		out.insert(out.end(), events.begin() + static_cast<std::ptrdiff_t>(next), events.end());
+		out.insert(out.end(), events.begin(), events.begin() + static_cast<std::ptrdiff_t>(next));
+	}
+
+	auto reset(std::size_t new_capacity) -> void {
+		auto const lock = std::lock_guard{mutex};
+		events.clear();
+		events.shrink_to_fit();
+		next = 0;
+		capacity = new_capacity;
+	}
+
+private:
+	std::mutex mutex;
+	std::vector<Event> events;
+	std::uint32_t thread_id;
+	std::size_t capacity;
+	std::size_t next = 0;
+};
+
+std::atomic<bool> enabled{false};
+
+/** Buffers of the live threads, and the events folded from the buffers of threads that exited. */
+struct Registry {
+	std::mutex mutex;
+	std::vector<ThreadBuffer*> buffers;
+	std::size_t capacity = default_capacity;
+	ThreadBuffer retired{0, default_capacity};
+	std::uint32_t next_id = 0;
+	std::unordered_set<std::string> interned;
+};
+
+auto registry() -> Registry& {
+	// Never destroyed, as threads may still record events during static destruction
+	static auto* const reg = new Registry{};  // NOLINT(cppcoreguidelines-owning-memory)
+	return *reg;
+}
+
+/** Buffer of the current thread, registered for its lifetime and folded into the retired events on exit. */
+class RegisteredBuffer {
+public:
+	RegisteredBuffer() {
+		auto& reg = registry();
+		auto const lock = std::lock_guard{reg.mutex};
+		buffer = std::make_unique<ThreadBuffer>(reg.next_id++, reg.capacity);
+		reg.buffers.push_back(buffer.get());
+	}
+
+	RegisteredBuffer(RegisteredBuffer const&) = delete;
+	RegisteredBuffer(RegisteredBuffer&&) = delete;
+	auto operator=(RegisteredBuffer const&) -> RegisteredBuffer& = delete;
+	auto operator=(RegisteredBuffer&&) -> RegisteredBuffer& = delete;
+
+	~RegisteredBuffer() {
+		auto& reg = registry();
+		auto const lock = std::lock_guard{reg.mutex};
+		auto pending = std::vector<Event>{};
+		buffer->copy_to(pending);
+		for (auto const& event : pending) {
+			reg.retired.push(event);
+		}
+		reg.buffers.erase(std::find(reg.buffers.begin(), reg.buffers.end(), buffer.get()));
+	}
+
+	[[nodiscard]] auto get() const noexcept -> ThreadBuffer& { return *buffer; }
+
+private:
+	std::unique_ptr<ThreadBuffer> buffer;
+};
+
+auto thread_buffer() -> ThreadBuffer& {
+	thread_local auto const buffer = RegisteredBuffer{};
+	return buffer.get();
+}
+
+auto now_ns() noexcept -> std::int64_t {
+	static auto const epoch = Clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count();
+}
+
+auto json_escape(std::string_view str) -> std::string {
+	auto escaped = std::string{};
+	escaped.reserve(str.size());
+	for (auto const c : str) {
+		switch (c) {
+		case '"':
+			escaped += "\\\"";
+			break;
+		case '\\':
+			escaped += "\\\\";
+			break;
+		case '\n':
+			escaped += "\\n";
+			break;
+		case '\t':
+			escaped += "\\t";
+			break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20U) {
+				escaped += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+			} else {
+				escaped += c;
+			}
+		}
+	}
+	return escaped;
+}
+
+}  // namespace
+
+auto enable(std::size_t capacity_per_thread) -> void {
+	auto& reg = registry();
+	{
+		auto const lock = std::lock_guard{reg.mutex};
+		reg.capacity = capacity_per_thread;
+		reg.retired.reset(capacity_per_thread);
+		for (auto* buffer : reg.buffers) {
+			buffer->reset(capacity_per_thread);
+		}
+	}
+	now_ns();  // Start the clock
+	enabled.store(true, std::memory_order_release);
+}
+
+auto disable() -> void {
+	enabled.store(false, std::memory_order_release);
+}
+
+auto is_enabled() noexcept -> bool {
+	return enabled.load(std::memory_order_relaxed);
+}
+
+auto clear() -> void {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	reg.retired.reset(reg.capacity);
+	for (auto* buffer : reg.buffers) {
+		buffer->reset(reg.capacity);
+	}
+}
+
+auto collect() -> std::vector<Event> {
+	auto& reg = registry();
+	auto events = std::vector<Event>{};
+	{
+		auto const lock = std::lock_guard{reg.mutex};
+		reg.retired.copy_to(events);
+		for (auto* buffer : reg.buffers) {
+			buffer->copy_to(events);
+		}
+	}
+	std::stable_sort(events.begin(), events.end(), [](auto const& a, auto const& b) { return a.start_ns < b.start_ns; });
+	return events;
+}
+
+auto intern(std::string_view str) -> char const* {
+	auto& reg = registry();
+	auto const lock = std::lock_guard{reg.mutex};
+	// Elements of node based containers are never moved
+	return reg.interned.emplace(str).first->c_str();
+}
+
+auto to_chrome_json() -> std::string {
+	auto const pid = static_cast<long>(::getpid());
+	auto json = std::string{"{\"traceEvents\":["};
+	auto first = true;
+	for (auto const& event : collect()) {
+		if (!first) {
+			json += ',';
+		}
+		first = false;
+		// Complete events, with times in microseconds
+		json += fmt::format(
+			"\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{}}}",
+			json_escape(event.name),
+			json_escape(event.category),
+			static_cast<double>(event.start_ns) / 1e3,
+			static_cast<double>(event.duration_ns) / 1e3,
+			pid,
+			event.thread_id);
+	}
+	json += "\n],\"displayTimeUnit\":\"ns\"}\n";
+	return json;
+}
+
+auto write_chrome_json(std::string const& filename) -> void {
+	auto file = std::ofstream{filename};
+	if (!file) {
+		throw std::runtime_error{fmt::format("Cannot open trace file {}.", filename)};
+	}
+	file << to_chrome_json();
+}
+
+/************************
+ *  Definition of Span  *
+ ************************/
+
+Span::Span(char const* name_, char const* category_) noexcept : name{name_}, category{category_} {
+	if (is_enabled()) {
+		start_ns = now_ns();
+	}
+}
+
+Span::~Span() {
+	if (start_ns >= 0) {
+		auto& buffer = thread_buffer();
+		buffer.push({name, category, start_ns, now_ns() - start_ns, buffer.id()});
+	}
+}
+
+}  // namespace ecole::utility::tracing
@@ -0,0 +1,63 @@
+#include <memory>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/data/memoized.hpp"
+
+#include "conftest.hpp"
+#include "data/unit-tests.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Count the number of extractions. */
+struct CountingFunction {
+	int n_extract = 0;
+
+	auto before_reset(scip::Model const& /*model*/) -> void { n_extract = 0; }
+	auto extract(scip::Model const& /*model*/, bool /*done*/) -> int { return ++n_extract; }
+};
+
+}  // namespace
+
+TEST_CASE("Data MemoizedFunction unit tests", "[unit][data]") {
+	data::unit_tests(data::MemoizedFunction<CountingFunction>{});
+}
+
+TEST_CASE("MemoizedFunction reuses data on the same node", "[data]") {
+	auto data_func = data::MemoizedFunction<CountingFunction>{};
+	auto model = get_model();
+	data_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+
+	auto const data1 = data_func.extract(model, false);
+	STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(data1)>, std::shared_ptr<int const>>);
+	auto const data2 = data_func.extract(model, false);
+	REQUIRE(data1 == data2);
+	REQUIRE(*data2 == 1);
+	REQUIRE(data_func.hits() == 1);
+	REQUIRE(data_func.misses() == 1);
+
+	SECTION("Copies share the cache") {
+		auto copy = data_func;
+		REQUIRE(copy.extract(model, false) == data1);
+		REQUIRE(copy.hits() == 2);
+	}
+
+	SECTION("Extract again when done changes") {
+		REQUIRE(*data_func.extract(model, true) == 2);
+	}
+
+	SECTION("Extract again on a different node") {
+		model.solve_iter_continue(SCIP_DIDNOTRUN);
+		REQUIRE(*data_func.extract(model, false) == 2);
+	}
+
+	SECTION("Clear cache on reset") {
+		data_func.before_reset(model);
+		REQUIRE(*data_func.extract(model, false) == 1);
+		REQUIRE(data_func.misses() == 2);
+	}
+}
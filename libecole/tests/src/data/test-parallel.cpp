@@ -0,0 +1,147 @@
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <xtensor/xmath.hpp>
+#include <xtensor/xoperation.hpp>
+
+#include "ecole/data/parallel.hpp"
+#include "ecole/data/tuple.hpp"
+#include "ecole/observation/focusnode.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/observation/strong-branching-scores.hpp"
+
+#include "conftest.hpp"
+#include "data/mock-function.hpp"
+#include "data/unit-tests.hpp"
+
+using namespace ecole;
+using namespace ecole::data;
+
+namespace {
+
+/** Whether two tensors have the same shape and values, NaNs included. */
+template <typename Tensor> auto same_values(Tensor const& a, Tensor const& b) -> bool {
+	return (a.shape() == b.shape()) && xt::all(xt::equal(a, b) || (xt::isnan(a) && xt::isnan(b)));
+}
+
+}  // namespace
+
+TEST_CASE("Data ParallelTupleFunction unit tests", "[unit][data]") {
+	data::unit_tests(ParallelTupleFunction{IntDataFunc{}, DoubleDataFunc{}});
+}
+
+TEST_CASE("Data ParallelVectorFunction unit tests", "[unit][data]") {
+	data::unit_tests(ParallelVectorFunction<IntDataFunc>{{{}, {}}});
+}
+
+TEST_CASE("Data ParallelMapFunction unit tests", "[unit][data]") {
+	data::unit_tests(ParallelMapFunction<std::string, IntDataFunc>{{{"a", {}}, {"b", {}}}});
+}
+
+TEST_CASE("Parallel data functions extract the same data as sequential ones", "[data]") {
+	auto model = get_model();
+
+	SECTION("Tuple") {
+		auto data_func = ParallelTupleFunction{IntDataFunc{0}, DoubleDataFunc{1}};
+		data_func.before_reset(model);
+		advance_to_stage(model, SCIP_STAGE_SOLVING);
+		auto const data = data_func.extract(model, false);
+		STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(data)>, std::tuple<int, double>>);
+		REQUIRE(std::get<0>(data) == 1);
+		REQUIRE(std::get<1>(data) == 2.0);  // NOLINT(readability-magic-numbers)
+		REQUIRE(data_func.last_latency().count() > 0);
+	}
+
+	SECTION("Vector") {
+		auto data_func = ParallelVectorFunction<IntDataFunc>{{{1}, {2}, {3}}};
+		data_func.before_reset(model);
+		REQUIRE(data_func.extract(model, false) == std::vector{2, 3, 4});
+	}
+
+	SECTION("Map") {
+		auto data_func = ParallelMapFunction<std::string, IntDataFunc>{{{"a", {1}}, {"b", {2}}}};
+		data_func.before_reset(model);
+		REQUIRE(data_func.extract(model, false) == std::map<std::string, int>{{"a", 2}, {"b", 3}});
+	}
+
+	SECTION("Nested") {
+		using Inner = ParallelTupleFunction<IntDataFunc, IntDataFunc>;
+		auto data_func = ParallelVectorFunction<Inner>{{Inner{{1}, {2}}, Inner{{3}, {4}}}};
+		data_func.before_reset(model);
+		auto const data = data_func.extract(model, false);
+		REQUIRE(std::get<1>(data[1]) == 5);
+	}
+}
+
+TEST_CASE("Exclusive data functions are detected", "[data]") {
+	STATIC_REQUIRE(trait::is_exclusive_function_v<observation::StrongBranchingScores>);
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<observation::NodeBipartite>);
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<observation::Khalil2016>);
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<observation::Pseudocosts>);
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<IntDataFunc>);
+	STATIC_REQUIRE(trait::is_exclusive_function_v<TupleFunction<IntDataFunc, observation::StrongBranchingScores>>);
+	STATIC_REQUIRE(trait::is_exclusive_function_v<MapFunction<int, observation::StrongBranchingScores>>);
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<ParallelVectorFunction<IntDataFunc>>);
+
+	SECTION("Strong branching scores are extracted alongside other functions") {
+		auto data_func = ParallelTupleFunction{IntDataFunc{0}, observation::StrongBranchingScores{}};
+		auto model = get_model();
+		data_func.before_reset(model);
+		advance_to_stage(model, SCIP_STAGE_SOLVING);
+		auto const [value, scores] = data_func.extract(model, false);
+		REQUIRE(value == 1);
+		REQUIRE(scores.has_value());
+	}
+}
+
+TEST_CASE("Parallel observation functions extract the same observations as sequential ones", "[data]") {
+	using Parallel = ParallelTupleFunction<
+		observation::NodeBipartite,
+		observation::Khalil2016,
+		observation::Pseudocosts,
+		observation::FocusNode>;
+	using Sequential = TupleFunction<
+		observation::NodeBipartite,
+		observation::Khalil2016,
+		observation::Pseudocosts,
+		observation::FocusNode>;
+	STATIC_REQUIRE_FALSE(trait::is_exclusive_function_v<Parallel>);
+
+	auto model = get_model();
+	auto parallel_func = Parallel{};
+	auto sequential_func = Sequential{};
+	parallel_func.before_reset(model);
+	sequential_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+
+	// Parallel extraction first, when the lazy caches of SCIP are still empty
+	auto const [node_par, khalil_par, pseudo_par, focus_par] = parallel_func.extract(model, false);
+	auto const [node_seq, khalil_seq, pseudo_seq, focus_seq] = sequential_func.extract(model, false);
+
+	REQUIRE(node_par.has_value());
+	REQUIRE(node_seq.has_value());
+	REQUIRE(same_values(node_par->variable_features, node_seq->variable_features));
+	REQUIRE(same_values(node_par->row_features, node_seq->row_features));
+	REQUIRE(node_par->edge_features == node_seq->edge_features);
+
+	REQUIRE(khalil_par.has_value());
+	REQUIRE(khalil_seq.has_value());
+	REQUIRE(same_values(khalil_par->features, khalil_seq->features));
+
+	REQUIRE(pseudo_par.has_value());
+	REQUIRE(pseudo_seq.has_value());
+	REQUIRE(same_values(pseudo_par.value(), pseudo_seq.value()));
+
+	REQUIRE(focus_par.has_value());
+	REQUIRE(focus_seq.has_value());
+	REQUIRE(focus_par->number == focus_seq->number);
+	REQUIRE(focus_par->nlpcands == focus_seq->nlpcands);
+	REQUIRE(focus_par->npseudocands == focus_seq->npseudocands);
+	REQUIRE(focus_par->lowerbound == focus_seq->lowerbound);
+}
@@ -0,0 +1,202 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/dataset/reader.hpp"
+#include "ecole/dataset/recorder.hpp"
+#include "ecole/dataset/writer.hpp"
+#include "ecole/environment/branching.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+
+#include "conftest.hpp"
+#include "test-utility/tmp-folder.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** A sample with a matrix of a variable number of rows filled with its index, and its index as a scalar. */
+struct TestSample {
+	xt::xtensor<double, 2> matrix;
+	std::uint64_t index;
+
+	explicit TestSample(std::size_t idx) :
+		matrix{xt::xtensor<double, 2>::from_shape({idx % 4, 3})}, index{static_cast<std::uint64_t>(idx)} {
+		matrix.fill(static_cast<double>(idx));
+	}
+
+	[[nodiscard]] auto columns() const -> dataset::Sample {
+		auto sample = dataset::Sample{};
+		dataset::add_columns(sample, "matrix", matrix);
+		dataset::add_columns(sample, "index", index);
+		return sample;
+	}
+};
+
+template <typename T> auto first_value(dataset::Column const& column) -> T {
+	auto value = T{};
+	std::memcpy(&value, column.data.data(), sizeof(T));
+	return value;
+}
+
+}  // namespace
+
+TEST_CASE("Dataset samples are read as written", "[dataset]") {
+	auto const compression = GENERATE(dataset::Compression::none, dataset::Compression::zlib);
+	if (!dataset::supports(compression)) {
+		return;
+	}
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const dir = tmp_dir.make_subpath();
+	auto constexpr n_samples = std::size_t{100};
+	{
+		auto writer = dataset::DatasetWriter{dir, {7, 40, compression, 1, 2}};
+		for (std::size_t i = 0; i < n_samples; ++i) {
+			writer.append(TestSample{i}.columns());
+		}
+		writer.close();
+		REQUIRE(writer.n_samples() == n_samples);
+	}
+
+	auto const reader = dataset::DatasetReader{dir};
+	REQUIRE(reader.size() == n_samples);
+	REQUIRE(reader.schema().size() == 2);
+	REQUIRE(reader.schema()[0].name == "matrix");
+	REQUIRE(reader.schema()[0].dtype == dataset::dtype_of<double>());
+	REQUIRE(reader.schema()[0].ndim == 2);
+
+	for (auto const idx : {std::size_t{0}, std::size_t{5}, std::size_t{39}, std::size_t{40}, n_samples - 1}) {
+		auto const sample = reader.get(idx);
+		auto const& matrix = sample.columns[0];
+		REQUIRE(matrix.shape == std::vector<std::size_t>{idx % 4, 3});
+		REQUIRE(matrix.data.size() == (idx % 4) * 3 * sizeof(double));
+		if (idx % 4 > 0) {
+			REQUIRE(first_value<double>(matrix) == static_cast<double>(idx));
+		}
+		REQUIRE(sample.columns[1].shape.empty());
+		REQUIRE(first_value<std::uint64_t>(sample.columns[1]) == idx);
+	}
+	REQUIRE_THROWS_AS(reader.get(n_samples), std::out_of_range);
+
+	SECTION("Shards can be read individually") {
+		REQUIRE(dataset::DatasetReader{dir / "shard-00000.ecds"}.size() == 40);
+	}
+}
+
+TEST_CASE("Dataset writers can be shared by threads", "[dataset]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const dir = tmp_dir.make_subpath();
+	auto constexpr n_threads = std::size_t{4};
+	auto constexpr n_samples = std::size_t{100};
+	{
+		auto writer = dataset::DatasetWriter{dir, {7, 40, dataset::Compression::none, 1, 2}};
+		auto threads = std::vector<std::thread>{};
+		for (std::size_t t = 0; t < n_threads; ++t) {
+			threads.emplace_back([&writer, t] {
+				for (std::size_t i = 0; i < n_samples; ++i) {
+					writer.append(TestSample{t * n_samples + i}.columns());
+					if (i % 25 == 0) {  // NOLINT(readability-magic-numbers)
+						writer.flush();
+					}
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		writer.close();
+		REQUIRE(writer.n_samples() == n_threads * n_samples);
+	}
+	REQUIRE(dataset::DatasetReader{dir}.size() == n_threads * n_samples);
+}
+
+TEST_CASE("Dataset ignore incomplete chunks", "[dataset]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const dir = tmp_dir.make_subpath();
+	{
+		auto writer = dataset::DatasetWriter{dir, {10, 100, dataset::Compression::none, 1, 1}};
+		for (std::size_t i = 0; i < 20; ++i) {
+			writer.append(TestSample{i}.columns());
+		}
+	}
+	auto const shard = dir / "shard-00000.ecds";
+	// Remove more than the padding of the last chunk
+	std::filesystem::resize_file(shard, std::filesystem::file_size(shard) - 64);
+	REQUIRE(dataset::DatasetReader{dir}.size() == 10);
+}
+
+TEST_CASE("Dataset samples must have the same columns", "[dataset]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto writer = dataset::DatasetWriter{tmp_dir.make_subpath()};
+	writer.append(TestSample{0}.columns());
+
+	auto const other = TestSample{1};
+	auto sample = other.columns();
+	sample.pop_back();
+	REQUIRE_THROWS_AS(writer.append(sample), std::invalid_argument);
+	sample = other.columns();
+	sample[0].shape = {4, 3};
+	REQUIRE_THROWS_AS(writer.append(sample), std::invalid_argument);
+	REQUIRE_THROWS_AS(writer.append({}), std::invalid_argument);
+}
+
+TEST_CASE("Dataset samples of empty optional values have the same columns", "[dataset]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const dir = tmp_dir.make_subpath();
+	{
+		auto writer = dataset::DatasetWriter{dir};
+		auto const present = std::optional{TestSample{3}.matrix};
+		auto const absent = std::optional<xt::xtensor<double, 2>>{};
+		for (auto const* value : {&absent, &present, &absent}) {
+			auto sample = dataset::Sample{};
+			dataset::add_columns(sample, "matrix", *value);
+			writer.append(sample);
+		}
+	}
+
+	auto const reader = dataset::DatasetReader{dir};
+	REQUIRE(reader.size() == 3);
+	REQUIRE(reader.schema().size() == 2);
+	REQUIRE(reader.schema()[0].name == "matrix.has_value");
+	REQUIRE(reader.schema()[1].name == "matrix");
+	REQUIRE_FALSE(first_value<bool>(reader.get(0).columns[0]));
+	REQUIRE(first_value<bool>(reader.get(1).columns[0]));
+	REQUIRE(reader.get(1).columns[1].shape == std::vector<std::size_t>{3, 3});
+	REQUIRE_FALSE(first_value<bool>(reader.get(2).columns[0]));
+}
+
+TEST_CASE("Recording environments write their transitions", "[dataset]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const dir = tmp_dir.make_subpath();
+	auto n_transitions = std::size_t{0};
+	{
+		auto writer = std::make_shared<dataset::DatasetWriter>(dir);
+		auto env = dataset::RecordingEnvironment<environment::Branching<>>{writer};
+		auto [obs, action_set, reward, done, info] = env.reset(problem_file);
+		for (; !done && n_transitions < 5; ++n_transitions) {
+			std::tie(obs, action_set, reward, done, info) = env.step(action_set.value()[0]);
+		}
+	}
+
+	auto const reader = dataset::DatasetReader{dir};
+	REQUIRE(reader.size() == n_transitions);
+	auto const& schema = reader.schema();
+	REQUIRE(schema[0].name == "observation.has_value");
+	REQUIRE(schema[1].name == "observation.variable_features");
+	REQUIRE(schema[schema.size() - 2].name == "action_set");
+	REQUIRE(schema.back().name == "action");
+	auto const first = reader.get(0);
+	auto const& first_action_set = first.columns[schema.size() - 2];
+	REQUIRE(first_value<bool>(first.columns[0]));
+	REQUIRE(first.columns[1].shape.size() == 2);
+	REQUIRE(first_value<std::size_t>(first.columns.back()) == first_value<std::size_t>(first_action_set));
+}
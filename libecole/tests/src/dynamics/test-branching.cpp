@@ -1,12 +1,16 @@
+#include <functional>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <xtensor/xmath.hpp>
 #include <xtensor/xsort.hpp>
 
+#include "ecole/dynamics/branching-policy.hpp"
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/exception.hpp"
+#include "ecole/observation/nothing.hpp"
 
 #include "conftest.hpp"
 #include "dynamics/unit-tests.hpp"
@@ -86,3 +90,56 @@ TEST_CASE("BranchingDynamics handles limits", "[dynamics]") {
 		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
 	}
 }
+
+TEST_CASE("BranchingDynamics solve with a native policy", "[dynamics]") {
+	bool const pseudo_candidates = GENERATE(true, false);
+	auto dyn = dynamics::BranchingDynamics{pseudo_candidates};
+	auto model = get_model();
+
+	SECTION("Solve instance without giving back control") {
+		auto const stats = dyn.solve_with_policy(
+			model, [](auto& /*model*/, auto const& action_set) -> dynamics::BranchingDynamics::Action {
+				return action_set[0];
+			});
+		REQUIRE(model.is_solved());
+		REQUIRE(stats.n_decisions > 0);
+		REQUIRE(stats.total_time >= stats.max_time);
+		REQUIRE(stats.mean_time() <= stats.max_time);
+	}
+
+	SECTION("Take the same decisions as iterative branching") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		auto n_steps = std::size_t{0};
+		while (!done) {
+			std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+			n_steps++;
+		}
+		auto native_model = get_model();
+		auto const stats = dyn.solve_with_policy(
+			native_model, [](auto& /*model*/, auto const& action_set) -> dynamics::BranchingDynamics::Action {
+				return action_set[0];
+			});
+		REQUIRE(stats.n_decisions == n_steps);
+		REQUIRE(SCIPgetNNodes(native_model.get_scip_ptr()) == SCIPgetNNodes(model.get_scip_ptr()));
+	}
+
+	SECTION("Use a stateful scoring policy") {
+		auto const last_candidate = [](auto const& /*obs*/, auto const& action_set) {
+			auto scores = std::vector<double>(action_set.size(), 0.);
+			scores.back() = 1.;
+			return scores;
+		};
+		auto policy = dynamics::ScoringPolicy{observation::Nothing{}, last_candidate};
+		policy.before_reset(model);
+		auto const stats = dyn.solve_with_policy(model, std::ref(policy));
+		REQUIRE(model.is_solved());
+		REQUIRE(stats.n_decisions > 0);
+	}
+
+	SECTION("Rethrow policy errors") {
+		auto const bad_policy = [](auto& m, auto const& /*action_set*/) -> dynamics::BranchingDynamics::Action {
+			return m.variables().size() + 1;
+		};
+		REQUIRE_THROWS_AS(dyn.solve_with_policy(model, bad_policy), std::invalid_argument);
+	}
+}
@@ -1,5 +1,8 @@
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -51,3 +54,40 @@ TEST_CASE("ConfiguringDynamics functional tests", "[dynamics]") {
 		}
 	}
 }
+
+TEST_CASE("ConfiguringDynamics race configurations", "[dynamics][slow]") {
+	dynamics::ConfiguringDynamics dyn{};
+	auto model = get_model();
+	auto const configurations = std::vector<dynamics::ParamDict>{
+		{{"branching/scorefunc", 's'}},
+		{{"branching/scorefunc", 'p'}},
+		{{"branching/scorefunc", 'q'}},
+	};
+
+	SECTION("Return metrics for all configurations") {
+		auto const n_threads = GENERATE(std::size_t{0}, std::size_t{1});
+		auto const result = dyn.race(model, configurations, n_threads);
+		REQUIRE(result.metrics.size() == configurations.size());
+		REQUIRE(result.winner < configurations.size());
+		REQUIRE(result.metrics[result.winner].is_solved);
+		REQUIRE_FALSE(result.metrics[result.winner].interrupted);
+		for (auto const& metrics : result.metrics) {
+			REQUIRE_FALSE(metrics.is_solved && metrics.interrupted);
+		}
+	}
+
+	SECTION("Leave the model untouched") {
+		dyn.race(model, configurations);
+		REQUIRE(model.stage() == SCIP_STAGE_PROBLEM);
+	}
+
+	SECTION("Pick the smallest gap when limits are hit") {
+		model.set_param("limits/totalnodes", 1);
+		auto const result = dyn.race(model, configurations);
+		REQUIRE(result.winner < configurations.size());
+	}
+
+	SECTION("Throw on empty configurations") {
+		REQUIRE_THROWS_AS(dyn.race(model, {}), std::invalid_argument);
+	}
+}
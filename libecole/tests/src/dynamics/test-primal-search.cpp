@@ -1,5 +1,7 @@
+#include <cmath>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <xtensor/xmath.hpp>
@@ -92,6 +94,49 @@ TEST_CASE("PrimalSearchDynamics functional tests", "[dynamics]") {
 	}
 }
 
+TEST_CASE("PrimalSearchDynamics batch evaluation", "[dynamics]") {
+	auto dyn = dynamics::PrimalSearchDynamics{2};
+	auto model = get_model();
+	using Action = dynamics::PrimalSearchDynamics::Action;
+
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	REQUIRE_FALSE(done);
+	REQUIRE(action_set.has_value());
+	auto var_ids = action_set.value();
+	auto const zeros = std::vector<SCIP_Real>(var_ids.size(), 0.);
+	auto const ones = std::vector<SCIP_Real>(var_ids.size(), 1.);
+	auto const ids = nonstd::span<std::size_t const>{var_ids.data(), var_ids.size()};
+
+	SECTION("Return one trial per candidate") {
+		auto const actions = std::vector<Action>{
+			{ids, {zeros.data(), zeros.size()}},
+			{{}, {}},
+			{ids, {ones.data(), ones.size()}},
+		};
+		auto [batch_done, batch_action_set, trials] = dyn.step_batch_dynamics(model, actions);
+		REQUIRE(trials.size() == actions.size());
+		REQUIRE_FALSE(trials[1].lp_solved);
+		REQUIRE_FALSE(trials[1].solution_kept);
+		for (auto const& trial : trials) {
+			REQUIRE((trial.lp_solved || std::isnan(trial.objective)));
+			REQUIRE((trial.lp_solved || !trial.solution_kept));
+		}
+		// The batch counts as a single trial
+		REQUIRE_FALSE(batch_done);
+		std::tie(done, action_set) = dyn.step_dynamics(model, {{}, {}});
+	}
+
+	SECTION("Throw on invalid candidate before probing") {
+		auto const bad_ids = std::vector<std::size_t>{model.variables().size()};
+		auto const actions = std::vector<Action>{
+			{ids, {zeros.data(), zeros.size()}},
+			{{bad_ids.data(), bad_ids.size()}, {zeros.data(), 1}},
+		};
+		REQUIRE_THROWS_AS(dyn.step_batch_dynamics(model, actions), std::invalid_argument);
+		REQUIRE_FALSE(SCIPinProbing(model.get_scip_ptr()));
+	}
+}
+
 TEST_CASE("PrimalSearchDynamics handles limits", "[dynamics]") {
 	auto dyn = dynamics::PrimalSearchDynamics{1};
 	auto model = get_model();
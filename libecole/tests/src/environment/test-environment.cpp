@@ -3,8 +3,10 @@
 
 #include <catch2/catch.hpp>
 
+#include "ecole/data/dynamic.hpp"
 #include "ecole/environment/environment.hpp"
 #include "ecole/exception.hpp"
+#include "ecole/information/memory.hpp"
 #include "ecole/information/nothing.hpp"
 #include "ecole/none.hpp"
 #include "ecole/observation/nothing.hpp"
@@ -51,9 +53,30 @@ struct TestDynamics {
 
 }  // namespace dynamics
 
+namespace observation {
+
+/**
+ * Dummy observation function reporting a cache of fixed size.
+ */
+struct CachingObservation {
+	static std::size_t constexpr cache_bytes = 1024;
+
+	auto before_reset(scip::Model& /*model*/) -> void {}
+	auto extract(scip::Model& /*model*/, bool /*done*/) -> NoneType { return None; }
+	[[nodiscard]] auto memory_usage() const noexcept -> std::size_t { return cache_bytes; }
+};
+
+}  // namespace observation
+
 namespace environment {
 
 using TestEnv = Environment<dynamics::TestDynamics, observation::Nothing, reward::Constant, information::Nothing>;
+using MemoryEnv = Environment<dynamics::TestDynamics, observation::Nothing, reward::Constant, information::MemoryUsage>;
+using DynamicMemoryEnv = Environment<
+	dynamics::TestDynamics,
+	observation::CachingObservation,
+	reward::Constant,
+	data::DynamicFunction<information::InformationMap<std::size_t>>>;
 
 }  // namespace environment
 }  // namespace ecole
@@ -111,3 +134,36 @@ TEST_CASE("Environments have MDP API", "[env]") {
 		REQUIRE_THROWS_AS(env.step(some_action), MarkovError);
 	}
 }
+
+TEST_CASE("Environments can be given a random generator", "[env]") {
+	constexpr auto user_seed = Seed{3};
+	ecole::seed(user_seed);
+	auto const rng = make_random_generator(user_seed, 42);  // NOLINT(readability-magic-numbers)
+	auto env = environment::TestEnv{rng, {}, {}, {}, {}};
+	REQUIRE(env.rng() == rng);
+	// Ecole's global source of randomness is not advanced
+	REQUIRE(spawn_random_generator() == make_random_generator(user_seed, 1));
+}
+
+TEST_CASE("Environments report and limit memory", "[env]") {
+	auto env = environment::MemoryEnv{};
+
+	SECTION("Memory usage is reported as information") {
+		auto [obs, action_set, reward, done, info] = env.reset(problem_file);
+		REQUIRE(info.at("scip_total") > 0);
+		REQUIRE(info.at("total") == env.memory_usage().total());
+	}
+
+	SECTION("Memory limit is given to SCIP in megabytes") {
+		env.memory_limit() = 1UL << 30U;
+		env.reset(problem_file);
+		REQUIRE(env.model().get_param<double>("limits/memory") == 1024.);
+	}
+
+	SECTION("Memory of data functions is reported through wrapped information functions") {
+		auto wrapped_env = environment::DynamicMemoryEnv{
+			{}, {}, data::DynamicFunction<information::InformationMap<std::size_t>>{information::MemoryUsage{}}};
+		auto [obs, action_set, reward, done, info] = wrapped_env.reset(problem_file);
+		REQUIRE(info.at("data_functions") == observation::CachingObservation::cache_bytes);
+	}
+}
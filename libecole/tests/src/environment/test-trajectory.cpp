@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/environment/trajectory.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/random.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Trajectories are replayed deterministically", "[env]") {
+	auto constexpr max_steps = std::size_t{20};
+	auto env = environment::TrajectoryRecordingEnvironment<environment::Branching<>>{};
+	env.rng() = RandomGenerator{42};  // NOLINT(readability-magic-numbers)
+	env.scip_params() = {{"randomization/permutevars", true}};
+	env.memory_limit() = std::size_t{1} << 32U;  // NOLINT(readability-magic-numbers)
+
+	auto action_sets = std::vector<xt::xtensor<std::size_t, 1>>{};
+	auto [obs, action_set, reward, done, info] = env.reset(problem_file);
+	for (std::size_t i = 0; !done && (i < max_steps); ++i) {
+		action_sets.push_back(action_set.value());
+		std::tie(obs, action_set, reward, done, info) = env.step(action_set.value()[0]);
+	}
+	auto const& trajectory = env.trajectory();
+	REQUIRE(trajectory.instance == problem_file);
+	REQUIRE(trajectory.actions.size() == action_sets.size());
+
+	SECTION("Trajectories are read as written") {
+		auto stream = std::stringstream{};
+		environment::write_trajectory(stream, trajectory);
+		auto const read = environment::read_trajectory<environment::Branching<>::Action>(stream);
+		REQUIRE(read.instance == trajectory.instance);
+		REQUIRE(read.fingerprint == trajectory.fingerprint);
+		REQUIRE(read.random_state == trajectory.random_state);
+		REQUIRE(read.scip_params.size() == trajectory.scip_params.size());
+		REQUIRE(read.memory_limit == trajectory.memory_limit);
+		REQUIRE(read.actions == trajectory.actions);
+	}
+
+	SECTION("Replay with a different observation function") {
+		auto replay_env = environment::Branching<observation::Nothing>{};
+		auto replayed_action_sets = std::vector<xt::xtensor<std::size_t, 1>>{};
+		auto replayed_done = false;
+		environment::replay(replay_env, trajectory, [&](auto&& transition) {
+			auto const& replayed_action_set = std::get<1>(transition);
+			replayed_done = std::get<3>(transition);
+			if (!replayed_done) {
+				replayed_action_sets.push_back(replayed_action_set.value());
+			}
+		});
+		REQUIRE(replayed_done == done);
+		replayed_action_sets.resize(std::min(replayed_action_sets.size(), action_sets.size()));
+		REQUIRE(replayed_action_sets == action_sets);
+	}
+
+	SECTION("Failed transitions are not recorded") {
+		auto const n_actions = trajectory.actions.size();
+		REQUIRE_THROWS(env.step(std::numeric_limits<std::size_t>::max()));
+		REQUIRE(env.trajectory().actions.size() == n_actions);
+	}
+
+	SECTION("Fingerprints identify the problem, not its name") {
+		auto model = scip::Model::from_file(problem_file);
+		model.set_name("renamed");
+		REQUIRE(environment::fingerprint(model) == trajectory.fingerprint);
+		auto const other = scip::Model::from_file(TEST_DATA_DIR "/enlight8.mps");
+		REQUIRE(environment::fingerprint(other) != trajectory.fingerprint);
+	}
+
+	SECTION("Reject replay on another instance") {
+		auto replay_env = environment::Branching<observation::Nothing>{};
+		auto const other = scip::Model::from_file(TEST_DATA_DIR "/enlight8.mps");
+		auto const no_op = [](auto&& /*transition*/) {};
+		REQUIRE_THROWS_AS(environment::replay(replay_env, trajectory, other, no_op), std::invalid_argument);
+	}
+
+	SECTION("Reject invalid data") {
+		auto stream = std::stringstream{"NOTATRAJECTORY"};
+		REQUIRE_THROWS_AS(environment::read_trajectory<environment::Branching<>::Action>(stream), std::runtime_error);
+	}
+}
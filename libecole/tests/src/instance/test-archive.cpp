@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/exception.hpp"
+#include "ecole/instance/archive.hpp"
+
+#include "conftest.hpp"
+#include "test-utility/tmp-folder.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Write an archive of copies of the test problem with different names. */
+auto write_archive(std::filesystem::path const& path, bool compress, std::size_t n_instances) {
+	auto writer = instance::ArchiveWriter{path, {compress}};
+	auto model = get_model();
+	auto names = std::vector<std::string>{};
+	for (std::size_t i = 0; i < n_instances; ++i) {
+		names.push_back("model-" + std::to_string(i));
+		model.set_name(names.back());
+		writer.add(model);
+	}
+	writer.close();
+	return names;
+}
+
+}  // namespace
+
+TEST_CASE("ArchiveGenerator iterates over the instances of an archive", "[instance]") {
+	using SamplingMode = instance::ArchiveGenerator::Parameters::SamplingMode;
+	auto const compress = GENERATE(true, false);
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const path = tmp_dir.make_subpath(".ecar");
+	auto const names = write_archive(path, compress, 3);
+
+	SECTION("Read every instance once when removing") {
+		auto generator = instance::ArchiveGenerator{{path, SamplingMode::remove}};
+		REQUIRE(generator.size() == names.size());
+		auto names_seen = std::vector<std::string>{};
+		while (!generator.done()) {
+			auto model = generator.next();
+			REQUIRE(model.stage() == SCIP_STAGE_PROBLEM);
+			names_seen.push_back(model.name());
+		}
+		std::sort(names_seen.begin(), names_seen.end());
+		REQUIRE(names_seen == names);
+		REQUIRE_THROWS_AS(generator.next(), IteratorExhausted);
+	}
+
+	SECTION("Shards are disjoint") {
+		auto generator0 = instance::ArchiveGenerator{{path, SamplingMode::remove, 0, 2}};
+		auto generator1 = instance::ArchiveGenerator{{path, SamplingMode::remove, 1, 2}};
+		REQUIRE(generator0.size() + generator1.size() == names.size());
+	}
+
+	SECTION("Same seed give reproducible results") {
+		auto generator = instance::ArchiveGenerator{{path, SamplingMode::replace}};
+		generator.seed(0);
+		auto const name1 = generator.next().name();
+		generator.seed(0);
+		REQUIRE(generator.next().name() == name1);
+	}
+}
+
+TEST_CASE("ArchiveWriter adds problem files", "[instance]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const problem = tmp_dir.make_subpath(".lp");
+	get_model().write_problem(problem);
+	auto const path = tmp_dir.make_subpath(".ecar");
+	{
+		auto writer = instance::ArchiveWriter{path};
+		writer.add_file(problem);
+		REQUIRE(writer.size() == 1);
+	}
+	auto generator = instance::ArchiveGenerator{{path}};
+	REQUIRE(generator.next().name() == problem.stem().string());
+}
+
+TEST_CASE("ArchiveGenerator rejects files that are not archives", "[instance]") {
+	auto const tmp_dir = TmpFolderRAII{};
+	auto const problem = tmp_dir.make_subpath(".lp");
+	get_model().write_problem(problem);
+	REQUIRE_THROWS_AS(instance::ArchiveGenerator{{problem}}, std::runtime_error);
+}
@@ -1,5 +1,8 @@
 #include <algorithm>
 #include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -96,3 +99,51 @@ TEST_CASE("FileGenerator properly iterate over files", "[instance]") {
 		}
 	}
 }
+
+TEST_CASE("FileGenerator shards are disjoint and cover all files", "[instance]") {
+	using SamplingMode = instance::FileGenerator::Parameters::SamplingMode;
+	auto const instances_raii = InstanceDatasetRAII{};
+	auto constexpr num_shards = std::size_t{3};
+	auto names_seen = std::vector<std::string>{};
+	for (std::size_t shard_index = 0; shard_index < num_shards; ++shard_index) {
+		auto generator =
+			instance::FileGenerator{{instances_raii.dir(), true, SamplingMode::remove, shard_index, num_shards}};
+		while (!generator.done()) {
+			names_seen.push_back(generator.next().name());
+		}
+	}
+	REQUIRE(names_seen.size() == InstanceDatasetRAII::names.size());
+	REQUIRE(is_same_set(names_seen, InstanceDatasetRAII::names));
+
+	REQUIRE_THROWS_AS(
+		(instance::FileGenerator{{instances_raii.dir(), true, SamplingMode::remove, num_shards, num_shards}}),
+		std::invalid_argument);
+}
+
+TEST_CASE("FileGenerator prefetching does not change the files generated", "[instance]") {
+	using SamplingMode = instance::FileGenerator::Parameters::SamplingMode;
+	auto const sampling_mode = GENERATE(SamplingMode::replace, SamplingMode::remove, SamplingMode::remove_and_repeat);
+	auto const prefetch = GENERATE(std::size_t{1}, std::size_t{3});
+	auto const instances_raii = InstanceDatasetRAII{};
+	auto generator = instance::FileGenerator{{instances_raii.dir(), true, sampling_mode}};
+	auto prefetching_generator = instance::FileGenerator{{instances_raii.dir(), true, sampling_mode, 0, 1, prefetch}};
+
+	for (auto const seed : {0, 1}) {
+		generator.seed(seed);
+		prefetching_generator.seed(seed);
+		for (std::size_t i = 0; i < InstanceDatasetRAII::names.size(); ++i) {
+			REQUIRE(prefetching_generator.next().name() == generator.next().name());
+		}
+		REQUIRE(prefetching_generator.done() == generator.done());
+	}
+}
+
+TEST_CASE("FileGenerator reads compressed files", "[instance]") {
+	using SamplingMode = instance::FileGenerator::Parameters::SamplingMode;
+	auto const tmp_dir = TmpFolderRAII{};
+	auto model = get_model();
+	model.set_name("compressed");
+	model.write_problem(tmp_dir.make_subpath(".mps.gz"));
+	auto generator = instance::FileGenerator{{tmp_dir.dir(), true, SamplingMode::remove, 0, 1, 1}};
+	REQUIRE(generator.next().name() == "compressed");
+}
@@ -53,3 +53,20 @@ TEST_CASE("NodeBipartite return correct observation", "[obs]") {
 		REQUIRE_FALSE(xt::all(xt::isnan(obs.row_features)));
 	}
 }
+
+TEST_CASE("NodeBipartite report and evict the memory of its cache", "[obs]") {
+	auto obs_func = observation::NodeBipartite{true};
+	auto model = get_model();
+	model.disable_cuts();
+	obs_func.before_reset(model);
+	REQUIRE(obs_func.memory_usage() == 0);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const obs_before = obs_func.extract(model, false);
+	REQUIRE(obs_func.memory_usage() > 0);
+
+	obs_func.evict();
+	REQUIRE(obs_func.memory_usage() == 0);
+	auto const obs_after = obs_func.extract(model, false);
+	REQUIRE(obs_after.has_value());
+	REQUIRE(obs_after.value().variable_features == obs_before.value().variable_features);
+}
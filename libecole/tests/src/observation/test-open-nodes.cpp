@@ -0,0 +1,53 @@
+#include <cstddef>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+#include <xtensor/xmath.hpp>
+#include <xtensor/xview.hpp>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/observation/open-nodes.hpp"
+
+#include "conftest.hpp"
+#include "observation/unit-tests.hpp"
+
+using namespace ecole;
+
+TEST_CASE("OpenNodes unit tests", "[unit][obs]") {
+	observation::unit_tests(observation::OpenNodes{});
+}
+
+TEST_CASE("OpenNodes return the search frontier", "[obs]") {
+	using Features = observation::OpenNodesObs::Features;
+	using NodeType = observation::OpenNodesObs::NodeType;
+
+	auto obs_func = observation::OpenNodes{};
+	auto dyn = dynamics::BranchingDynamics{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	// Branch a few times to have open nodes
+	for (auto i = 0; (i < 2) && !done; ++i) {
+		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+	}
+	REQUIRE_FALSE(done);
+
+	auto const optional_obs = obs_func.extract(model, false);
+	REQUIRE(optional_obs.has_value());
+	auto const& features = optional_obs.value().features;
+	auto col = [&features](auto feat) { return xt::col(features, static_cast<std::ptrdiff_t>(feat)); };
+
+	SECTION("Observation has correct shape") {
+		auto const n_open_nodes = static_cast<std::size_t>(SCIPgetNNodesLeft(model.get_scip_ptr()));
+		REQUIRE(features.shape(0) == n_open_nodes);
+		REQUIRE(features.shape(1) == observation::OpenNodesObs::n_features);
+	}
+
+	SECTION("Observation has correct values") {
+		REQUIRE(xt::all(col(Features::depth) > 0));
+		REQUIRE(xt::all(col(Features::number) > col(Features::parent_number)));
+		REQUIRE(xt::all(col(Features::node_type) >= static_cast<double>(NodeType::child)));
+		REQUIRE(xt::all(col(Features::node_type) <= static_cast<double>(NodeType::leaf)));
+	}
+}
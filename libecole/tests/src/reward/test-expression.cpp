@@ -0,0 +1,87 @@
+#include <cmath>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/reward/expression.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/reward/n-nodes.hpp"
+
+#include "conftest.hpp"
+#include "reward/unit-tests.hpp"
+
+using namespace ecole;
+using Op = reward::RewardExpression::Op;
+using reward::RewardExpression;
+
+TEST_CASE("RewardExpression unit tests", "[unit][reward]") {
+	reward::unit_tests(RewardExpression::binary(
+		Op::add, RewardExpression::leaf(Op::lp_iterations), RewardExpression::unary(Op::neg, RewardExpression{2.})));
+}
+
+TEST_CASE("RewardExpression matches the reward functions it combines", "[reward]") {
+	auto model = get_model();
+	auto lp_iterations = reward::LpIterations{};
+	auto n_nodes = reward::NNodes{};
+	auto expr = RewardExpression::binary(
+		Op::sub,
+		RewardExpression::binary(Op::pow, RewardExpression::leaf(Op::lp_iterations), RewardExpression{2.}),
+		RewardExpression::leaf(Op::n_nodes));
+	REQUIRE(expr.fields() == (reward::SolverStatistics::lp_iterations | reward::SolverStatistics::n_nodes));
+
+	expr.before_reset(model);
+	lp_iterations.before_reset(model);
+	n_nodes.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const expected = std::pow(lp_iterations.extract(model), 2.) - n_nodes.extract(model);
+	REQUIRE(expr.extract(model) == expected);
+	// Differences are taken since the previous extraction
+	REQUIRE(expr.extract(model) == 0.);
+}
+
+TEST_CASE("RewardExpression cumulates and forwards to functions", "[reward]") {
+	auto model = get_model();
+	auto calls = 0;
+	auto expr = RewardExpression::unary(
+		Op::cumsum,
+		RewardExpression::binary(
+			Op::add,
+			RewardExpression::leaf(Op::is_done),
+			RewardExpression::function({
+				[&calls](scip::Model& /*model*/) { calls = 0; },
+				[&calls](scip::Model& /*model*/, bool /*done*/) { return static_cast<reward::Reward>(++calls); },
+			})));
+
+	expr.before_reset(model);
+	REQUIRE(expr.extract(model) == 1.);
+	REQUIRE(expr.extract(model, true) == 1. + 3.);
+	expr.before_reset(model);
+	REQUIRE(expr.extract(model) == 1.);
+}
+
+TEST_CASE("RewardExpression follows Python float semantics", "[reward]") {
+	auto model = get_model();
+	auto const eval = [&model](Op op, reward::Reward x, reward::Reward y) {
+		auto expr = RewardExpression::binary(op, RewardExpression{x}, RewardExpression{y});
+		return expr.extract(model);
+	};
+
+	SECTION("Floor division and modulo round towards negative infinity") {
+		REQUIRE(eval(Op::floordiv, -7., 2.) == -4.);
+		REQUIRE(eval(Op::mod, -7., 3.) == 2.);
+		REQUIRE(eval(Op::mod, 7., -3.) == -2.);
+	}
+
+	SECTION("Division by zero throws") {
+		auto const op = GENERATE(Op::truediv, Op::floordiv, Op::mod);
+		REQUIRE_THROWS_AS(eval(op, 1., 0.), reward::ZeroDivisionError);
+		REQUIRE_THROWS_AS(eval(Op::pow, 0., -1.), reward::ZeroDivisionError);
+	}
+
+	SECTION("Math domain errors throw") {
+		auto expr = RewardExpression::unary(Op::log, RewardExpression{0.});
+		REQUIRE_THROWS_AS(expr.extract(model), std::domain_error);
+		expr = RewardExpression::unary(Op::exp, RewardExpression{1e6});
+		REQUIRE_THROWS_AS(expr.extract(model), std::overflow_error);
+	}
+}
@@ -63,6 +63,33 @@ TEST_CASE("Model solving", "[scip][slow]") {
 	}
 }
 
+TEST_CASE("Copy the local problem while solving", "[scip][slow]") {
+	auto model = get_model();
+	auto fcall = model.solve_iter(scip::callback::BranchruleConstructor{});
+	REQUIRE(fcall.has_value());
+	// Branch once to get to a node with local bounds
+	auto const cands = model.lp_branch_cands();
+	scip::call(SCIPbranchVar, model.get_scip_ptr(), cands[0], nullptr, nullptr, nullptr);
+	fcall = model.solve_iter_continue(SCIP_BRANCHED);
+	REQUIRE(fcall.has_value());
+
+	auto local = model.copy_local();
+	REQUIRE(local.stage() == SCIP_STAGE_PROBLEM);
+	REQUIRE(local.variables().size() == static_cast<std::size_t>(SCIPgetNVars(model.get_scip_ptr())));
+
+	SECTION("Copy can be solved independently") {
+		local.solve();
+		REQUIRE(local.is_solved());
+	}
+
+	SECTION("Original can continue solving") {
+		while (fcall.has_value()) {
+			fcall = model.solve_iter_continue(SCIP_DIDNOTRUN);
+		}
+		REQUIRE(model.is_solved());
+	}
+}
+
 TEST_CASE("Explicit parameter management", "[scip]") {
 	using Catch::Contains;
 	using scip::ParamType;
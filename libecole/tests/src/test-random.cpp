@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
 #include <catch2/catch.hpp>
 
 #include "ecole/random.hpp"
@@ -32,3 +37,61 @@ TEST_CASE("Random generator serialization", "[random]") {
 	auto const rng_copy = deserialize(data);
 	REQUIRE(rng == rng_copy);
 }
+
+TEST_CASE("Random generators of a stream match spawned generators", "[random]") {
+	ecole::seed(3);
+	auto const rng_1 = ecole::spawn_random_generator();
+	auto const rng_2 = ecole::spawn_random_generator();
+	REQUIRE(rng_1 == ecole::make_random_generator(3, 1));
+	REQUIRE(rng_2 == ecole::make_random_generator(3, 2));
+	REQUIRE(ecole::make_random_generator(3, 1ULL << 40U) != ecole::make_random_generator(3, 0));
+}
+
+TEST_CASE("Random generators spawned concurrently are all different", "[random]") {
+	ecole::seed(0);
+	auto constexpr n_threads = 4;
+	auto constexpr n_spawns = 100;
+	auto rngs = std::vector<std::vector<RandomGenerator>>(n_threads);
+	auto threads = std::vector<std::thread>{};
+	for (auto& thread_rngs : rngs) {
+		threads.emplace_back([&thread_rngs] {
+			for (auto i = 0; i < n_spawns; ++i) {
+				thread_rngs.push_back(ecole::spawn_random_generator());
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	auto all_rngs = std::vector<RandomGenerator>{};
+	for (auto const& thread_rngs : rngs) {
+		all_rngs.insert(all_rngs.end(), thread_rngs.begin(), thread_rngs.end());
+	}
+	// Generators are spawned from streams 1 to n_threads * n_spawns, in any order
+	for (std::uint64_t stream = 1; stream <= n_threads * n_spawns; ++stream) {
+		REQUIRE(std::count(all_rngs.begin(), all_rngs.end(), ecole::make_random_generator(0, stream)) == 1);
+	}
+}
+
+TEST_CASE("Random generators spawned while seeding use a stream of the new seed", "[random]") {
+	ecole::seed(0);
+	auto constexpr n_spawns = 200;
+	auto rngs = std::vector<RandomGenerator>{};
+	auto spawner = std::thread{[&rngs] {
+		for (auto i = 0; i < n_spawns; ++i) {
+			rngs.push_back(ecole::spawn_random_generator());
+		}
+	}};
+	for (auto i = 0; i < n_spawns; ++i) {
+		ecole::seed(static_cast<Seed>(i % 2));
+	}
+	spawner.join();
+	// Every generator comes from a stream counted from the seeding of its seed
+	for (auto const& rng : rngs) {
+		auto from_seed = false;
+		for (std::uint64_t stream = 1; stream <= n_spawns && !from_seed; ++stream) {
+			from_seed = (rng == ecole::make_random_generator(0, stream)) || (rng == ecole::make_random_generator(1, stream));
+		}
+		REQUIRE(from_seed);
+	}
+}
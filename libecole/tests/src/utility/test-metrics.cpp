@@ -0,0 +1,148 @@
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ecole/utility/metrics.hpp"
+
+#include "test-utility/tmp-folder.hpp"
+
+using namespace ecole::utility;
+
+namespace {
+
+auto contains(std::string const& text, std::string const& line) {
+	return text.find(line) != std::string::npos;
+}
+
+/** Connect to a Unix socket, send a request, and read the response until the server closes the connection. */
+auto query(std::filesystem::path const& path, std::string const& request) {
+	auto const fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	auto address = sockaddr_un{};
+	address.sun_family = AF_UNIX;
+	std::strncpy(static_cast<char*>(address.sun_path), path.c_str(), sizeof(address.sun_path) - 1);
+	REQUIRE(::connect(fd, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) == 0);  // NOLINT
+	::send(fd, request.data(), request.size(), 0);
+	auto response = std::string{};
+	auto buffer = std::array<char, 1024>{};  // NOLINT(readability-magic-numbers)
+	for (auto n_read = ::recv(fd, buffer.data(), buffer.size(), 0); n_read > 0;
+			 n_read = ::recv(fd, buffer.data(), buffer.size(), 0)) {
+		response.append(buffer.data(), static_cast<std::size_t>(n_read));
+	}
+	::close(fd);
+	return response;
+}
+
+}  // namespace
+
+TEST_CASE("Metrics count and observe values", "[utility]") {
+	metrics::enable();
+	metrics::reset();
+	auto const counter = metrics::Counter{"test_events_total", "Test events.", {{"kind", "a"}}};
+	auto const histogram = metrics::Histogram{"test_durations_seconds", "Test durations.", {1., 2.}};
+	auto const tmp_dir = ecole::TmpFolderRAII{};
+
+	SECTION("Counters with the same name and labels share their value") {
+		counter.increment();
+		metrics::Counter{"test_events_total", "Test events.", {{"kind", "a"}}}.increment(2);
+		metrics::Counter{"test_events_total", "Test events.", {{"kind", "b"}}}.increment();
+		REQUIRE(counter.value() == 3);
+	}
+
+	SECTION("Do not record when disabled") {
+		metrics::disable();
+		counter.increment();
+		histogram.observe(1.);
+		REQUIRE(counter.value() == 0);
+		REQUIRE(histogram.count() == 0);
+	}
+
+	SECTION("Values of all threads are summed, including exited ones") {
+		auto thread = std::thread{[&] {
+			counter.increment();
+			histogram.observe(1.5);
+		}};
+		thread.join();
+		counter.increment();
+		histogram.observe(0.5);
+		REQUIRE(counter.value() == 2);
+		REQUIRE(histogram.count() == 2);
+		REQUIRE(histogram.sum() == 2.);
+	}
+
+	SECTION("Reset values to zero") {
+		counter.increment();
+		histogram.observe(3.);
+		metrics::reset();
+		REQUIRE(counter.value() == 0);
+		REQUIRE(histogram.count() == 0);
+	}
+
+	SECTION("NaN values are counted but not summed") {
+		histogram.observe(1.5);
+		histogram.observe(std::nan(""));
+		REQUIRE(histogram.count() == 2);
+		REQUIRE(histogram.sum() == 1.5);
+	}
+
+	SECTION("Timers observe durations") {
+		{ auto const timer = metrics::Timer{histogram}; }
+		REQUIRE(histogram.count() == 1);
+		REQUIRE(histogram.sum() >= 0.);
+	}
+
+	SECTION("Reject inconsistent metrics") {
+		REQUIRE_THROWS_AS(metrics::Counter("test_durations_seconds", "Test durations."), std::invalid_argument);
+		REQUIRE_THROWS_AS(metrics::Counter("test_events_total", "Other help."), std::invalid_argument);
+		REQUIRE_THROWS_AS(metrics::Histogram("test_durations_seconds", "Test durations.", {1.}), std::invalid_argument);
+		REQUIRE_THROWS_AS(metrics::Histogram("test_unsorted", "Unsorted.", {2., 1.}), std::invalid_argument);
+		REQUIRE_THROWS_AS(metrics::Counter("invalid-name", "Invalid."), std::invalid_argument);
+	}
+
+	SECTION("Export in Prometheus text format") {
+		counter.increment();
+		histogram.observe(1.5);
+		auto const text = metrics::to_prometheus();
+		REQUIRE(contains(text, "# TYPE test_events_total counter\n"));
+		REQUIRE(contains(text, "test_events_total{kind=\"a\"} 1\n"));
+		REQUIRE(contains(text, "# TYPE test_durations_seconds histogram\n"));
+		REQUIRE(contains(text, "test_durations_seconds_bucket{le=\"1\"} 0\n"));
+		REQUIRE(contains(text, "test_durations_seconds_bucket{le=\"2\"} 1\n"));
+		REQUIRE(contains(text, "test_durations_seconds_bucket{le=\"+Inf\"} 1\n"));
+		REQUIRE(contains(text, "test_durations_seconds_sum 1.5\n"));
+		REQUIRE(contains(text, "test_durations_seconds_count 1\n"));
+
+		auto const file = tmp_dir.make_subpath(".prom");
+		metrics::write_prometheus(file);
+		auto stream = std::ifstream{file};
+		auto const written = std::string{std::istreambuf_iterator<char>{stream}, {}};
+		REQUIRE(written == metrics::to_prometheus());
+	}
+
+	SECTION("Serve metrics on a Unix socket") {
+		counter.increment();
+		auto const path = tmp_dir.make_subpath(".sock");
+		{
+			auto const exporter = metrics::SocketExporter{path};
+			auto const http = query(path, "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+			REQUIRE(http.rfind("HTTP/1.0 200 OK\r\n", 0) == 0);
+			REQUIRE(contains(http, "test_events_total{kind=\"a\"} 1\n"));
+			auto const plain = query(path, "");
+			REQUIRE(plain == metrics::to_prometheus());
+		}
+		REQUIRE_FALSE(std::filesystem::exists(path));
+	}
+
+	metrics::disable();
+	metrics::reset();
+}
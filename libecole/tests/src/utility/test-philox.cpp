@@ -0,0 +1,90 @@
+#include <array>
+#include <cstdint>
+#include <random>
+#include <sstream>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/philox.hpp"
+
+using namespace ecole::utility;
+
+TEST_CASE("Philox match known answers", "[utility]") {
+	// Test vectors from the Random123 library
+	REQUIRE(
+		Philox4x32::block({0, 0, 0, 0}, {0, 0}) ==
+		std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+	REQUIRE(
+		Philox4x32::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+		std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+	REQUIRE(
+		Philox4x32::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+		std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Philox random engine interface", "[utility]") {
+	auto rng = Philox4x32{42};  // NOLINT(cert-msc32-c, cert-msc51-cpp) We want reproducible in tests
+	auto const rng_copy = rng;
+
+	SECTION("Same seed give same values") {
+		auto other = Philox4x32{42};  // NOLINT(cert-msc32-c, cert-msc51-cpp) We want reproducible in tests
+		for (auto i = 0; i < 10; ++i) {
+			REQUIRE(rng() == other());
+		}
+		REQUIRE(rng == other);
+	}
+
+	SECTION("Discard is the same as drawing values") {
+		auto other = rng;
+		auto const n = GENERATE(1ULL, 3ULL, 4ULL, 7ULL, 1000ULL);
+		for (auto i = 0ULL; i < n; ++i) {
+			rng();
+		}
+		other.discard(n);
+		REQUIRE(rng == other);
+		REQUIRE(rng() == other());
+	}
+
+	SECTION("Seed from a seed sequence") {
+		auto seeds = std::seed_seq{1, 2, 3};
+		auto other = Philox4x32{seeds};
+		REQUIRE(other != rng);
+		rng.seed(seeds);
+		REQUIRE(other == rng);
+	}
+
+	SECTION("Streams are independent") {
+		auto stream_0 = Philox4x32{42, 0};
+		auto stream_1 = Philox4x32{42, 1};
+		REQUIRE(stream_0 == rng);
+		REQUIRE(stream_0 != stream_1);
+		REQUIRE(stream_0() != stream_1());
+	}
+
+	SECTION("Binary serialization") {
+		rng.discard(5);
+		auto other = Philox4x32::from_bytes(rng.to_bytes());
+		REQUIRE(other == rng);
+		REQUIRE(other() == rng());
+		REQUIRE(rng_copy != rng);
+	}
+
+	SECTION("Text serialization") {
+		rng.discard(2);
+		auto stream = std::stringstream{};
+		stream << rng;
+		auto other = Philox4x32{};
+		stream >> other;
+		REQUIRE(other == rng);
+		REQUIRE(other() == rng());
+	}
+
+	SECTION("Use in distributions") {
+		auto dist = std::uniform_int_distribution<int>{0, 9};
+		for (auto i = 0; i < 100; ++i) {
+			auto const val = dist(rng);
+			REQUIRE(val >= 0);
+			REQUIRE(val <= 9);
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <unistd.h>
+
+#include "ecole/utility/shared-ring.hpp"
+
+using namespace ecole;
+
+namespace {
+
+auto unique_name() -> std::string {
+	static auto count = 0;
+	return "ecole-test-ring-" + std::to_string(getpid()) + "-" + std::to_string(count++);
+}
+
+auto write_value(utility::SharedRing& ring, std::uint64_t value) -> void {
+	// Not using Catch2 assertions since this is also called from other threads
+	auto const memory = ring.begin_write().value();
+	std::memcpy(memory.data(), &value, sizeof(value));
+	ring.commit_write(sizeof(value));
+}
+
+auto read_value(utility::SharedRing::Message const& message) -> std::uint64_t {
+	REQUIRE(message.data.size() == sizeof(std::uint64_t));
+	auto value = std::uint64_t{0};
+	std::memcpy(&value, message.data.data(), sizeof(value));
+	return value;
+}
+
+constexpr auto short_timeout = std::chrono::milliseconds{10};
+
+}  // namespace
+
+TEST_CASE("SharedRing transfer messages", "[utility]") {
+	auto writer = utility::SharedRing::create(unique_name(), 2, 100);
+	auto reader = utility::SharedRing::open(writer.name());
+	REQUIRE(reader.n_slots() == 2);
+	REQUIRE(reader.slot_capacity() == 100);
+
+	SECTION("Read messages in order") {
+		write_value(writer, 1);
+		write_value(writer, 2);
+		auto const first = reader.read();
+		auto const second = reader.read();
+		REQUIRE(read_value(first.value()) == 1);
+		REQUIRE(read_value(second.value()) == 2);
+		REQUIRE(reader.n_read() == 2);
+		REQUIRE(writer.n_written() == 2);
+	}
+
+	SECTION("Time out reading an empty ring") {
+		REQUIRE_FALSE(reader.read(short_timeout).has_value());
+	}
+
+	SECTION("Apply backpressure until slots are released") {
+		write_value(writer, 1);
+		write_value(writer, 2);
+		REQUIRE_FALSE(writer.begin_write(short_timeout).has_value());
+
+		auto const first = reader.read().value();
+		auto const second = reader.read().value();
+		reader.release(second.slot);
+		REQUIRE_FALSE(writer.begin_write(short_timeout).has_value());
+		reader.release(first.slot);
+		REQUIRE(writer.begin_write(short_timeout).has_value());
+	}
+
+	SECTION("Refuse invalid releases") {
+		write_value(writer, 1);
+		auto const message = reader.read().value();
+		reader.release(message.slot);
+		REQUIRE_THROWS_AS(reader.release(message.slot), std::invalid_argument);
+		REQUIRE_THROWS_AS(reader.release(2), std::invalid_argument);
+	}
+
+	SECTION("Refuse messages larger than the slots") {
+		REQUIRE(writer.begin_write().has_value());
+		REQUIRE_THROWS_AS(writer.commit_write(101), std::invalid_argument);
+	}
+
+	SECTION("Transfer messages between threads") {
+		constexpr auto n_messages = std::uint64_t{10000};
+		auto producer = std::thread{[&writer] {
+			for (std::uint64_t i = 0; i < n_messages; ++i) {
+				write_value(writer, i);
+			}
+		}};
+		auto in_order = true;
+		for (std::uint64_t i = 0; i < n_messages; ++i) {
+			auto const message = reader.read().value();
+			in_order = in_order && (read_value(message) == i);
+			reader.release(message.slot);
+		}
+		producer.join();
+		REQUIRE(in_order);
+	}
+}
+
+TEST_CASE("SharedRing names are owned by their creator", "[utility]") {
+	auto const name = unique_name();
+	{
+		auto writer = utility::SharedRing::create(name, 1, 8);
+		REQUIRE_THROWS_AS(utility::SharedRing::create(name, 1, 8), std::system_error);
+	}
+	REQUIRE_THROWS_AS(utility::SharedRing::open(name), std::system_error);
+	REQUIRE_THROWS_AS(utility::SharedRing::create(unique_name(), 0, 8), std::invalid_argument);
+}
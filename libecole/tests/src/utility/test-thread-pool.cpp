@@ -0,0 +1,53 @@
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/thread-pool.hpp"
+
+using namespace ecole;
+
+TEST_CASE("ThreadPool execute tasks", "[utility]") {
+	auto const n_threads = GENERATE(std::size_t{0}, std::size_t{1}, std::size_t{4});
+	auto pool = utility::ThreadPool{n_threads};
+	REQUIRE(pool.size() > 0);
+
+	SECTION("Return tasks results") {
+		auto futures = std::vector<std::future<std::size_t>>{};
+		for (std::size_t i = 0; i < 100; ++i) {
+			futures.push_back(pool.submit([i] { return i * i; }));
+		}
+		for (std::size_t i = 0; i < futures.size(); ++i) {
+			REQUIRE(futures[i].get() == i * i);
+		}
+	}
+
+	SECTION("Identify worker threads") {
+		REQUIRE_FALSE(utility::ThreadPool::in_worker_thread());
+		REQUIRE(pool.submit([] { return utility::ThreadPool::in_worker_thread(); }).get());
+	}
+
+	SECTION("Forward tasks exceptions") {
+		auto fut = pool.submit([]() -> int { throw std::runtime_error{"Task error"}; });
+		REQUIRE_THROWS_AS(fut.get(), std::runtime_error);
+	}
+}
+
+TEST_CASE("ThreadPool finish tasks on destruction", "[utility]") {
+	auto count = std::atomic<std::size_t>{0};
+	{
+		auto pool = utility::ThreadPool{2};
+		for (std::size_t i = 0; i < 20; ++i) {
+			pool.submit([&count] { ++count; });
+		}
+	}
+	REQUIRE(count == 20);
+}
+
+TEST_CASE("Shared ThreadPool is unique", "[utility]") {
+	REQUIRE(&utility::ThreadPool::shared() == &utility::ThreadPool::shared());
+	REQUIRE(utility::ThreadPool::shared().submit([] { return 3; }).get() == 3);
+}
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/tracing.hpp"
+
+using namespace ecole::utility;
+
+namespace {
+
+auto count_events(std::string_view name) {
+	auto const events = tracing::collect();
+	return std::count_if(events.begin(), events.end(), [name](auto const& e) { return e.name == name; });
+}
+
+}  // namespace
+
+TEST_CASE("Tracing record spans", "[utility]") {
+	tracing::enable();
+
+	SECTION("Record nested spans") {
+		{
+			auto const outer = tracing::Span{"outer", "test"};
+			auto const inner = tracing::Span{"inner", "test"};
+		}
+		auto const events = tracing::collect();
+		REQUIRE(events.size() == 2);
+		REQUIRE(std::string_view{events[0].name} == "outer");
+		REQUIRE(std::string_view{events[1].name} == "inner");
+		REQUIRE(events[0].duration_ns >= events[1].duration_ns);
+		REQUIRE(events[0].thread_id == events[1].thread_id);
+	}
+
+	SECTION("Do not record when disabled") {
+		tracing::disable();
+		{ auto const span = tracing::Span{"disabled"}; }
+		REQUIRE(count_events("disabled") == 0);
+	}
+
+	SECTION("Overwrite oldest events") {
+		tracing::enable(2);
+		for (auto const* name : {"a", "b", "c"}) {
+			auto const span = tracing::Span{name};
+		}
+		auto const events = tracing::collect();
+		REQUIRE(events.size() == 2);
+		REQUIRE(std::string_view{events[0].name} == "b");
+		REQUIRE(std::string_view{events[1].name} == "c");
+	}
+
+	SECTION("Record events from multiple threads") {
+		auto thread = std::thread{[] { auto const span = tracing::Span{"thread"}; }};
+		thread.join();
+		{ auto const span = tracing::Span{"thread"}; }
+		auto const events = tracing::collect();
+		REQUIRE(events.size() == 2);
+		REQUIRE(events[0].thread_id != events[1].thread_id);
+	}
+
+	SECTION("Keep events of exited threads") {
+		for (auto i = 0; i < 4; ++i) {
+			std::thread{[] { auto const span = tracing::Span{"exited"}; }}.join();
+		}
+		auto thread_ids = std::set<std::uint32_t>{};
+		for (auto const& event : tracing::collect()) {
+			thread_ids.insert(event.thread_id);
+		}
+		REQUIRE(count_events("exited") == 4);
+		REQUIRE(thread_ids.size() == 4);
+	}
+
+	SECTION("Export in Chrome trace format") {
+		{ auto const span = tracing::Span{tracing::intern("quoted \"name\"")}; }
+		auto const json = tracing::to_chrome_json();
+		REQUIRE(json.find(R"("traceEvents":[)") != std::string::npos);
+		REQUIRE(json.find(R"("name":"quoted \"name\"")") != std::string::npos);
+		REQUIRE(json.find(R"("ph":"X")") != std::string::npos);
+	}
+
+	tracing::disable();
+	tracing::clear();
+}
@@ -1,8 +1,17 @@
 import sys
 
-from ecole.core import RandomGenerator, seed, spawn_random_generator, MarkovError, Default
+from ecole.core import (
+    RandomGenerator,
+    seed,
+    spawn_random_generator,
+    make_random_generator,
+    MarkovError,
+    Default,
+)
 
 import ecole.version
+import ecole.tracing
+import ecole.metrics
 import ecole.data
 import ecole.observation
 import ecole.reward
@@ -11,5 +20,7 @@ import ecole.scip
 import ecole.instance
 import ecole.dynamics
 import ecole.environment
+import ecole.transport
+import ecole.dataset
 
 __version__ = "{v.major}.{v.minor}.{v.patch}".format(v=ecole.version.get_ecole_lib_version())
@@ -60,7 +60,7 @@ PYBIND11_MODULE(core, m) {
 			[](const RandomGenerator& self, py::dict const& /* memo */) { return std::make_unique<RandomGenerator>(self); },
 			py::arg("memo"))
 		.def(py::pickle(
-			[](RandomGenerator const& self) { return serialize(self); },
+			[](RandomGenerator const& self) { return py::bytes(serialize(self)); },
 			[](std::string const& data) { return std::make_unique<RandomGenerator>(deserialize(data)); }));
 
 	m.def("seed", &ecole::seed, py::arg("val"), "Seed the global source of randomness in Ecole.");
@@ -69,6 +69,12 @@ PYBIND11_MODULE(core, m) {
 
 		The global source of randomness is advance so two random engien created successively have different states.
 	)");
+	m.def("make_random_generator", &ecole::make_random_generator, py::arg("seed"), py::arg("stream"), R"(
+		Create the random generator of a given stream.
+
+		Same as the stream-th call to spawn_random_generator after seeding with the given seed, but without reading
+		or modifying the global source of randomness.
+	)");
 
 	py::class_<ecole::DefaultType>(m, "DefaultType")
 		.def(py::self == py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
@@ -92,4 +98,9 @@ PYBIND11_MODULE(core, m) {
 	reward::bind_submodule(m.def_submodule("reward"));
 	information::bind_submodule(m.def_submodule("information"));
 	dynamics::bind_submodule(m.def_submodule("dynamics"));
+	tracing::bind_submodule(m.def_submodule("tracing"));
+	metrics::bind_submodule(m.def_submodule("metrics"));
+	environment::bind_submodule(m.def_submodule("environment"));
+	transport::bind_submodule(m.def_submodule("transport"));
+	dataset::bind_submodule(m.def_submodule("dataset"));
 }
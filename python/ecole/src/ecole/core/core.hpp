@@ -1,11 +1,24 @@
 #pragma once
 
+#include <optional>
+
 #include <pybind11/pybind11.h>
 
+#include "ecole/reward/expression.hpp"
+
 #include "caster.hpp"
 
 namespace ecole {
 
+/**
+ * Whether a Python object is an instance of a bound C++ class, excluding Python subclasses.
+ *
+ * Python subclasses may override methods, and must be called through Python.
+ */
+template <typename T> auto is_exactly(pybind11::handle obj) -> bool {
+	return pybind11::type::of(obj).is(pybind11::type::of<T>());
+}
+
 namespace version {
 void bind_submodule(pybind11::module_ m);
 }
@@ -28,6 +41,9 @@ void bind_submodule(pybind11::module_ const& m);
 
 namespace reward {
 void bind_submodule(pybind11::module_ const& m);
+
+/** Convert a Python reward function to a RewardExpression, if it only uses Ecole reward functions. */
+auto lower_reward_function(pybind11::handle func) -> std::optional<RewardExpression>;
 }
 
 namespace information {
@@ -38,4 +54,24 @@ namespace dynamics {
 void bind_submodule(pybind11::module_ const& m);
 }
 
+namespace tracing {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace metrics {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace environment {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace transport {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace dataset {
+void bind_submodule(pybind11::module_ const& m);
+}
+
 }  // namespace ecole
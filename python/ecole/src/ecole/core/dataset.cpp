@@ -0,0 +1,173 @@
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include "ecole/dataset/reader.hpp"
+#include "ecole/dataset/writer.hpp"
+
+#include "core.hpp"
+
+namespace ecole::dataset {
+
+namespace py = pybind11;
+
+namespace {
+
+auto to_dtype(py::dtype const& dtype) -> DType {
+	auto const kind = dtype.kind();
+	if (((kind != 'b') && (kind != 'i') && (kind != 'u') && (kind != 'f')) || (dtype.byteorder() == '>')) {
+		throw std::invalid_argument{
+			fmt::format("Unsupported dtype {}.", py::str(static_cast<py::handle>(dtype)).cast<std::string>())};
+	}
+	return {kind, static_cast<std::uint8_t>(dtype.itemsize())};
+}
+
+auto to_numpy_dtype(DType dtype) -> py::dtype {
+	return py::dtype{fmt::format("{}{}", dtype.kind, dtype.itemsize)};
+}
+
+/** Append a dictionary of arrays, copied without holding the GIL. */
+auto append(DatasetWriter& writer, py::dict const& arrays) -> void {
+	auto contiguous_arrays = std::vector<py::array>{};
+	auto sample = Sample{};
+	for (auto const& [key, value] : arrays) {
+		auto array = py::array::ensure(value, py::array::c_style);
+		if (!array) {
+			throw std::invalid_argument{"Values must be convertible to Numpy arrays."};
+		}
+		auto const* const data = static_cast<std::byte const*>(array.data());
+		sample.push_back(
+			{key.cast<std::string>(),
+			 to_dtype(array.dtype()),
+			 {array.shape(), array.shape() + array.ndim()},
+			 {data, static_cast<std::size_t>(array.nbytes())}});
+		contiguous_arrays.push_back(std::move(array));
+	}
+	auto const release = py::gil_scoped_release{};
+	writer.append(sample);
+}
+
+/** Read a sample as a dictionary of read only arrays, without copy. */
+auto get(DatasetReader const& reader, std::size_t index) -> py::dict {
+	auto sample = [&] {
+		auto const release = py::gil_scoped_release{};
+		return reader.get(index);
+	}();
+	// The owner is kept alive by the arrays
+	auto* const owner = new std::shared_ptr<void const>{std::move(sample.owner)};
+	auto const base = py::capsule{owner, [](void* ptr) { delete static_cast<std::shared_ptr<void const>*>(ptr); }};
+
+	auto arrays = py::dict{};
+	for (auto const& column : sample.columns) {
+		auto array = py::array{to_numpy_dtype(column.dtype), column.shape, column.data.data(), base};
+		py::detail::array_proxy(array.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+		arrays[py::str(column.name)] = std::move(array);
+	}
+	return arrays;
+}
+
+}  // namespace
+
+/**
+ * Dataset module bindings definitions.
+ */
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Chunked, columnar, datasets of samples written in the background.";
+
+	py::enum_<Compression>(m, "Compression")  //
+		.value("none", Compression::none)
+		.value("zlib", Compression::zlib);
+
+	m.def("supports", &supports, py::arg("compression"), "Whether Ecole was compiled with the given compression.");
+
+	py::class_<DatasetWriter, std::shared_ptr<DatasetWriter>>(m, "DatasetWriter", R"(
+		Append samples to a dataset of shard files, in a directory.
+
+		Samples are dictionaries of arrays, which must have the same keys, types, and number of dimensions as the
+		first sample.
+		Samples are grouped in chunks, in which each array of all the samples is stored contiguously.
+		Full chunks are compressed and written by a background thread.
+	)")
+		.def(
+			py::init([](std::filesystem::path const& directory,
+		              std::size_t samples_per_chunk,
+		              std::size_t samples_per_shard,
+		              Compression compression,
+		              int compression_level,
+		              std::size_t max_pending_chunks) {
+				return std::make_shared<DatasetWriter>(
+					directory,
+					DatasetWriter::Parameters{
+						samples_per_chunk, samples_per_shard, compression, compression_level, max_pending_chunks});
+			}),
+			py::arg("directory"),
+			py::arg("samples_per_chunk") = DatasetWriter::Parameters{}.samples_per_chunk,
+			py::arg("samples_per_shard") = DatasetWriter::Parameters{}.samples_per_shard,
+			py::arg("compression") = DatasetWriter::Parameters{}.compression,
+			py::arg("compression_level") = DatasetWriter::Parameters{}.compression_level,
+			py::arg("max_pending_chunks") = DatasetWriter::Parameters{}.max_pending_chunks,
+			R"(
+			Create a writer of new shards in a directory, created if needed.
+
+			Parameters
+			----------
+			directory:
+				The directory in which to write shards, which must not already contain a dataset.
+			samples_per_chunk:
+				Number of samples grouped, and compressed, together.
+			samples_per_shard:
+				Number of samples after which a new shard file is started.
+			compression:
+				Compression of the chunks.
+			compression_level:
+				Level of the compression, from 1 (fastest) to 9 (smallest).
+			max_pending_chunks:
+				Number of chunks waiting to be written after which appending samples blocks.
+		)")
+		.def("append", &append, py::arg("sample"), "Copy a dictionary of arrays in the current chunk.")
+		.def(
+			"flush",
+			&DatasetWriter::flush,
+			py::call_guard<py::gil_scoped_release>(),
+			"Write the current chunk, and wait for all chunks to be written.")
+		.def(
+			"close",
+			&DatasetWriter::close,
+			py::call_guard<py::gil_scoped_release>(),
+			"Write all chunks and stop the background thread.")
+		.def("__enter__", [](py::object const& self) { return self; })
+		.def(
+			"__exit__",
+			[](DatasetWriter& self, py::args const& /* exception */) { self.close(); },
+			py::call_guard<py::gil_scoped_release>())
+		.def_property_readonly("directory", &DatasetWriter::directory)
+		.def_property_readonly("n_samples", &DatasetWriter::n_samples);
+
+	py::class_<DatasetReader>(m, "DatasetReader", R"(
+		Random access to the samples of a dataset.
+
+		Shard files are memory mapped, and samples are returned as dictionaries of read only arrays pointing in the
+		mapped files, or in decompressed chunks.
+	)")
+		.def(py::init<std::filesystem::path const&>(), py::arg("path"), "Open a dataset directory, or a shard file.")
+		.def("__len__", &DatasetReader::size)
+		.def("__getitem__", &get, py::arg("index"))
+		.def_property_readonly("columns", [](DatasetReader const& self) {
+			auto names = std::vector<std::string>{};
+			for (auto const& column : self.schema()) {
+				names.push_back(column.name);
+			}
+			return names;
+		});
+}
+
+}  // namespace ecole::dataset
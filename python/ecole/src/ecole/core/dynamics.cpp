@@ -1,4 +1,5 @@
 #include <utility>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -7,6 +8,7 @@
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/dynamics/configuring.hpp"
 #include "ecole/dynamics/primal-search.hpp"
+#include "ecole/python/auto-class.hpp"
 #include "ecole/scip/model.hpp"
 
 #include "core.hpp"
@@ -142,6 +144,21 @@ void bind_submodule(pybind11::module_ const& m) {
 			)");
 	}
 
+	python::auto_data_class<RaceMetrics>(m, "RaceMetrics", "Metrics of a configuration solved during a race.")
+		.def_auto_members(
+			python::Member{"is_solved", &RaceMetrics::is_solved},
+			python::Member{"interrupted", &RaceMetrics::interrupted},
+			python::Member{"solving_time", &RaceMetrics::solving_time},
+			python::Member{"primal_bound", &RaceMetrics::primal_bound},
+			python::Member{"dual_bound", &RaceMetrics::dual_bound},
+			python::Member{"gap", &RaceMetrics::gap},
+			python::Member{"n_nodes", &RaceMetrics::n_nodes},
+			python::Member{"n_lp_iterations", &RaceMetrics::n_lp_iterations});
+
+	python::auto_data_class<RaceResult>(m, "RaceResult", "Outcome of a race between configurations.")
+		.def_auto_members(
+			python::Member{"winner", &RaceResult::winner}, python::Member{"metrics", &RaceResult::metrics});
+
 	{
 		dynamics_class<ConfiguringDynamics>{m, "ConfiguringDynamics", R"(
 			Setting solving parameters Dynamics.
@@ -195,9 +212,49 @@ void bind_submodule(pybind11::module_ const& m) {
 					rng:
 						The source of randomness. Passed by the environment.
 			)")
+			.def(
+				"race",
+				&ConfiguringDynamics::race,
+				py::arg("model"),
+				py::arg("configurations"),
+				py::arg("n_threads") = 0,
+				py::call_guard<py::gil_scoped_release>(),
+				R"(
+				Solve the problem concurrently with multiple configurations.
+
+				Every configuration solves its own copy of the original problem, starting from the parameters of
+				the given model, on the shared thread pool.
+				After every node, configurations publish their primal and dual bounds.
+				A configuration that solved at least 100 nodes is dominated, and interrupted, when another has
+				both bounds at least as tight and a gap less than half of its own.
+				Once a configuration has solved the instance, the others are interrupted at their next node.
+				The given model is left unchanged.
+
+				Parameters
+				----------
+					model:
+						The problem to solve, in problem stage.
+					configurations:
+						A list of mappings of parameter names and values.
+					n_threads:
+						Number of configurations solved simultaneously, or the size of the shared thread pool if zero.
+
+				Returns
+				-------
+					result:
+						The index of the winning configuration, that is the first one to solve the instance, or
+						the one with the smallest gap if none did; and the metrics of every configuration.
+			)")
 			.def(py::init<>());
 	}
 
+	python::auto_data_class<PrimalSearchTrial>(
+		m, "PrimalSearchTrial", "Outcome of a partial solution evaluated by the primal search.")
+		.def_auto_members(
+			python::Member{"lp_solved", &PrimalSearchTrial::lp_solved},
+			python::Member{"solution_kept", &PrimalSearchTrial::solution_kept},
+			python::Member{"objective", &PrimalSearchTrial::objective});
+
 	{
 		using idx_t = typename PrimalSearchDynamics::Action::first_type::value_type;
 		using val_t = typename PrimalSearchDynamics::Action::second_type::value_type;
@@ -281,6 +338,46 @@ void bind_submodule(pybind11::module_ const& m) {
 					action_set:
 						List of non-fixed discrete variables (``SCIPgetPseudoBranchCands``).
 			)")
+			.def(
+				"step_batch_dynamics",
+				[](PrimalSearchDynamics& self,
+				   scip::Model& model,
+				   std::vector<std::pair<Numpy<idx_t>, Numpy<val_t>>> const& actions) {
+					auto spans = std::vector<PrimalSearchDynamics::Action>{};
+					spans.reserve(actions.size());
+					for (auto const& [indices, values] : actions) {
+						spans.emplace_back(
+							nonstd::span{indices.data(), static_cast<std::size_t>(indices.size())},
+							nonstd::span{values.data(), static_cast<std::size_t>(values.size())});
+					}
+					auto const release = py::gil_scoped_release{};
+					return self.step_batch_dynamics(model, spans);
+				},
+				py::arg("model"),
+				py::arg("actions"),
+				R"(
+				Try to obtain feasible primal solutions from many (partial) primal solutions at once.
+
+				All partial solutions are evaluated as in :py:meth:`step_dynamics`, but in a single probing
+				session, reusing the LP warm start between candidates.
+				The whole batch counts as a single search trial.
+
+				Parameters
+				----------
+					model:
+						The state of the Markov Decision Process. Passed by the environment.
+					actions:
+						A list of partial solutions, each given as in :py:meth:`step_dynamics`.
+
+				Returns
+				-------
+					done:
+						Whether the instance is solved.
+					action_set:
+						List of non-fixed discrete variables (``SCIPgetPseudoBranchCands``).
+					trials:
+						The outcome of every partial solution, in the same order.
+			)")
 			.def(
 				py::init<int, int, int, int>(),
 				py::arg("trials_per_node") = 1,
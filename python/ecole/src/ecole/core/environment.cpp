@@ -0,0 +1,476 @@
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+#include <xtensor-python/pytensor.hpp>
+
+#include "ecole/data/dynamic.hpp"
+#include "ecole/data/memory.hpp"
+#include "ecole/dataset/recorder.hpp"
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/dynamics/configuring.hpp"
+#include "ecole/dynamics/primal-search.hpp"
+#include "ecole/environment/environment.hpp"
+#include "ecole/environment/trajectory.hpp"
+#include "ecole/information/memory.hpp"
+#include "ecole/information/nothing.hpp"
+#include "ecole/none.hpp"
+#include "ecole/observation/capacity.hpp"
+#include "ecole/observation/focusnode.hpp"
+#include "ecole/observation/hutter-2011.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+#include "ecole/observation/milp-bipartite.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/observation/open-nodes.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/observation/strong-branching-scores.hpp"
+#include "ecole/observation/weight.hpp"
+#include "ecole/random.hpp"
+#include "ecole/reward/expression.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/traits.hpp"
+
+#include "core.hpp"
+
+namespace ecole::environment {
+
+namespace py = pybind11;
+
+namespace {
+
+template <typename T> using Numpy = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/** The observations of all Ecole observation functions. */
+using Observation = std::variant<
+	NoneType,
+	observation::NodeBipartiteObs,
+	observation::MilpBipartiteObs,
+	observation::Khalil2016Obs,
+	observation::Hutter2011Obs,
+	observation::FocusNodeObs,
+	observation::OpenNodesObs,
+	xt::xtensor<double, 1>>;
+
+/**
+ * Dynamics owned by a Python object.
+ *
+ * The Python object must outlive this wrapper.
+ */
+template <typename Dynamics> class BorrowedDynamics {
+public:
+	using Action = trait::action_of_t<Dynamics>;
+	using ActionSet = trait::action_set_of_t<Dynamics>;
+
+	explicit BorrowedDynamics(Dynamics* dynamics_) noexcept : dynamics{dynamics_} {}
+
+	auto reset_dynamics(scip::Model& model) -> std::tuple<bool, ActionSet> { return dynamics->reset_dynamics(model); }
+
+	auto step_dynamics(scip::Model& model, Action const& action) -> std::tuple<bool, ActionSet> {
+		return dynamics->step_dynamics(model, action);
+	}
+
+	auto set_dynamics_random_state(scip::Model& model, RandomGenerator& rng) -> void {
+		dynamics->set_dynamics_random_state(model, rng);
+	}
+
+private:
+	Dynamics* dynamics;
+};
+
+/**
+ * Observation function owned by a Python object, extracting the common Observation type.
+ *
+ * The Python object must outlive this wrapper.
+ */
+template <typename ObservationFunction> class BorrowedObservationFunction {
+public:
+	explicit BorrowedObservationFunction(ObservationFunction* function_) noexcept : function{function_} {}
+
+	auto before_reset(scip::Model& model) -> void { function->before_reset(model); }
+
+	auto extract(scip::Model& model, bool done) -> Observation {
+		auto obs = function->extract(model, done);
+		if constexpr (is_optional_v<decltype(obs)>) {
+			if (!obs.has_value()) {
+				return None;
+			}
+			return std::move(obs).value();
+		} else {
+			return obs;
+		}
+	}
+
+	[[nodiscard]] auto memory_usage() const -> std::size_t { return data::memory_usage(*function); }
+
+	auto evict() -> void { data::evict(*function); }
+
+private:
+	ObservationFunction* function;
+};
+
+/** Borrow the observation function if it is exactly one of the given types. */
+template <typename... ObservationFunctions>
+auto borrow_observation_function(py::handle func) -> std::optional<data::DynamicFunction<Observation>> {
+	auto borrowed = std::optional<data::DynamicFunction<Observation>>{};
+	((is_exactly<ObservationFunctions>(func) &&
+	  (borrowed.emplace(BorrowedObservationFunction<ObservationFunctions>{&func.cast<ObservationFunctions&>()}), true)) ||
+	 ...);
+	return borrowed;
+}
+
+/**
+ * An Environment running built-in dynamics and data functions without calling back into Python.
+ *
+ * The components are owned by the Python environment, and are kept alive by this class.
+ * Reset and step only hold the GIL to convert their arguments and return values.
+ */
+template <typename Dynamics> class NativeEnvironment {
+public:
+	using Env = Environment<
+		BorrowedDynamics<Dynamics>,
+		data::DynamicFunction<Observation>,
+		reward::RewardExpression,
+		information::Nothing>;
+	using Action = typename Env::Action;
+
+	/** Whether the transitions of the dynamics can be written to a dataset. */
+	static constexpr bool is_recordable =
+		dataset::is_recordable_v<Action> && dataset::is_recordable_v<typename Env::ActionSet>;
+
+	NativeEnvironment(
+		py::object dynamics,
+		py::object observation_function,
+		py::object reward_function,
+		data::DynamicFunction<Observation> native_observation_function,
+		reward::RewardExpression native_reward_function) :
+		py_dynamics{std::move(dynamics)},
+		py_observation_function{std::move(observation_function)},
+		py_reward_function{std::move(reward_function)},
+		env{
+			RandomGenerator{},
+			std::move(native_observation_function),
+			std::move(native_reward_function),
+			{},
+			{},
+			&py_dynamics.cast<Dynamics&>()} {}
+
+	auto reset(py::handle instance, RandomGenerator& rng, std::map<std::string, scip::Param> scip_params) -> py::tuple {
+		env.rng() = rng;
+		env.scip_params() = std::move(scip_params);
+		auto transition = [&] {
+			if (py::isinstance<scip::Model>(instance)) {
+				auto const& model = instance.cast<scip::Model const&>();
+				auto const release = py::gil_scoped_release{};
+				if (trajectory_recorder.has_value()) {
+					trajectory_recorder->reset(model, "", env.rng(), env.scip_params(), env.memory_limit());
+				}
+				return observe(env.reset(model));
+			}
+			auto const filename = instance.cast<std::filesystem::path>();
+			auto const release = py::gil_scoped_release{};
+			auto model = scip::Model::from_file(filename);
+			if (trajectory_recorder.has_value()) {
+				trajectory_recorder->reset(
+					model, filename.string(), env.rng(), env.scip_params(), env.memory_limit());
+			}
+			return observe(env.reset(std::move(model)));
+		}();
+		// The Python environment keeps the state of its random generator
+		rng = env.rng();
+		return to_python(std::move(transition));
+	}
+
+	auto step(Action const& action) -> py::tuple {
+		auto transition = [&] {
+			auto const release = py::gil_scoped_release{};
+			auto transition = env.step(action);
+			// Only successful transitions are recorded
+			if constexpr (is_recordable) {
+				if (recorder.has_value()) {
+					recorder->act(action);
+				}
+			}
+			if (trajectory_recorder.has_value()) {
+				trajectory_recorder->act(action);
+			}
+			return observe(std::move(transition));
+		}();
+		return to_python(std::move(transition));
+	}
+
+	/** Write the transitions of the following episodes to a dataset, or stop recording if null. */
+	auto record(std::shared_ptr<dataset::DatasetWriter> writer) -> void {
+		if (writer == nullptr) {
+			recorder.reset();
+			return;
+		}
+		if constexpr (!is_recordable) {
+			throw std::invalid_argument{"The actions of this environment cannot be recorded."};
+		}
+		if ((!recorder.has_value()) || (recorder->get_writer() != writer)) {
+			recorder.emplace(std::move(writer));
+		}
+	}
+
+	/** Keep the trajectories of the following episodes, or stop if false. */
+	auto record_trajectory(bool enable) -> void {
+		if (!enable) {
+			trajectory_recorder.reset();
+		} else if (!trajectory_recorder.has_value()) {
+			trajectory_recorder.emplace();
+		}
+	}
+
+	/** The trajectory of the current episode in the binary format of write_trajectory, or None if not recording. */
+	auto trajectory() const -> py::object {
+		if (!trajectory_recorder.has_value()) {
+			return py::none();
+		}
+		auto stream = std::ostringstream{};
+		write_trajectory(stream, trajectory_recorder->trajectory());
+		return py::bytes(stream.str());
+	}
+
+	/** Replay a trajectory, on the given instance or on the file it was recorded from, and return all transitions. */
+	auto replay(py::bytes const& data, py::handle instance) -> py::list {
+		auto stream = std::istringstream{static_cast<std::string>(data)};
+		auto const trajectory = read_trajectory<Action>(stream);
+		using Transition = std::tuple<
+			typename Env::OptionalObservation,
+			typename Env::ActionSet,
+			typename Env::Reward,
+			bool,
+			typename Env::InformationMap>;
+		auto transitions = std::vector<Transition>{};
+		auto const collect = [&transitions](auto&& transition) { transitions.push_back(std::move(transition)); };
+		if (instance.is_none()) {
+			auto const release = py::gil_scoped_release{};
+			environment::replay(env, trajectory, collect);
+		} else if (py::isinstance<scip::Model>(instance)) {
+			auto const& model = instance.cast<scip::Model const&>();
+			auto const release = py::gil_scoped_release{};
+			environment::replay(env, trajectory, model, collect);
+		} else {
+			auto const filename = instance.cast<std::filesystem::path>();
+			auto const release = py::gil_scoped_release{};
+			environment::replay(env, trajectory, scip::Model::from_file(filename), collect);
+		}
+		auto py_transitions = py::list{};
+		for (auto& transition : transitions) {
+			py_transitions.append(to_python(std::move(transition)));
+		}
+		return py_transitions;
+	}
+
+	auto model() -> scip::Model& { return env.model(); }
+
+	auto memory_limit() -> std::optional<std::size_t>& { return env.memory_limit(); }
+
+	auto memory_usage() -> information::MemoryReport { return env.memory_usage(); }
+
+private:
+	py::object py_dynamics;
+	py::object py_observation_function;
+	py::object py_reward_function;
+	Env env;
+	std::optional<dataset::Recorder> recorder;
+	std::optional<TrajectoryRecorder<Action>> trajectory_recorder;
+
+	/** Keep the state of the transition in the recorder, if recording. */
+	template <typename Transition> auto observe(Transition&& transition) -> Transition&& {
+		if constexpr (is_recordable) {
+			if (recorder.has_value()) {
+				auto const& observation = std::get<0>(transition);
+				auto const& action_set = std::get<1>(transition);
+				auto const done = std::get<3>(transition);
+				if (!observation.has_value()) {
+					recorder->observe(None, action_set, done);
+				} else {
+					std::visit(
+						[&](auto const& obs) {
+							if constexpr (dataset::is_recordable_v<std::decay_t<decltype(obs)>>) {
+								recorder->observe(obs, action_set, done);
+							} else {
+								throw std::invalid_argument{"The observations of this environment cannot be recorded."};
+							}
+						},
+						observation.value());
+				}
+			}
+		}
+		return std::forward<Transition>(transition);
+	}
+
+	template <typename Transition> static auto to_python(Transition&& transition) -> py::tuple {
+		auto&& [observation, action_set, reward, done, information] = std::forward<Transition>(transition);
+		auto py_observation = py::object{py::none()};
+		if (observation.has_value()) {
+			py_observation = std::visit(
+				[](auto&& obs) { return py::cast(std::forward<decltype(obs)>(obs)); }, std::move(observation).value());
+		}
+		return py::make_tuple(
+			std::move(py_observation), py::cast(std::move(action_set)), reward, done, py::cast(std::move(information)));
+	}
+};
+
+/** Bind the NativeEnvironment methods that do not depend on the action type. */
+template <typename Dynamics> auto bind_native_environment(py::module_ const& m, char const* name) {
+	using Native = NativeEnvironment<Dynamics>;
+	return py::class_<Native>(m, name, "An environment running built-in components without calling into Python.")
+		.def(
+			"reset",
+			&Native::reset,
+			py::arg("instance"),
+			py::arg("rng"),
+			py::arg("scip_params"),
+			"Start a new episode, seeding the dynamics with the given random generator.")
+		.def(
+			"record",
+			&Native::record,
+			py::arg("writer"),
+			"Write the transitions of the following episodes to a DatasetWriter, or stop recording if None.")
+		.def(
+			"record_trajectory",
+			&Native::record_trajectory,
+			py::arg("enable"),
+			"Keep the actions of the following episodes to replay them, or stop if False.")
+		.def("trajectory", &Native::trajectory, "The trajectory of the current episode as bytes, or None.")
+		.def(
+			"replay",
+			&Native::replay,
+			py::arg("trajectory"),
+			py::arg("instance") = py::none(),
+			"Replay a trajectory without calling back into Python, and return the list of all transitions.")
+		.def_property_readonly(
+			"model", &Native::model, py::return_value_policy::reference_internal, "The Model of the current episode.")
+		.def_property(
+			"memory_limit",
+			[](Native& self) { return self.memory_limit(); },
+			[](Native& self, std::optional<std::size_t> limit) { self.memory_limit() = limit; },
+			"Soft limit on the memory of the Model and data functions, in bytes.")
+		.def(
+			"memory_usage",
+			[](Native& self) { return information::to_information_map(self.memory_usage()); },
+			"Memory held by the current Model and by the caches of the data functions, in bytes.");
+}
+
+/** Create the NativeEnvironment of the given dynamics if all components are built into Ecole. */
+template <typename Dynamics>
+auto make_native_environment(
+	py::handle py_dynamics,
+	py::handle observation_function,
+	py::handle reward_function,
+	py::handle information_function) -> py::object {
+	if (!is_exactly<information::Nothing>(information_function)) {
+		return py::none();
+	}
+	auto native_observation_function = borrow_observation_function<
+		observation::Nothing,
+		observation::NodeBipartite,
+		observation::MilpBipartite,
+		observation::StrongBranchingScores,
+		observation::Pseudocosts,
+		observation::Khalil2016,
+		observation::Hutter2011,
+		observation::FocusNode,
+		observation::OpenNodes,
+		observation::Capacity,
+		observation::Weight>(observation_function);
+	if (!native_observation_function.has_value()) {
+		return py::none();
+	}
+	auto native_reward_function = reward::lower_reward_function(reward_function);
+	if (!native_reward_function.has_value()) {
+		return py::none();
+	}
+	return py::cast(std::make_unique<NativeEnvironment<Dynamics>>(
+		py::reinterpret_borrow<py::object>(py_dynamics),
+		py::reinterpret_borrow<py::object>(observation_function),
+		py::reinterpret_borrow<py::object>(reward_function),
+		std::move(native_observation_function).value(),
+		std::move(native_reward_function).value()));
+}
+
+}  // namespace
+
+/**
+ * Environment module bindings definitions.
+ */
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Native environments for Ecole.";
+
+	bind_native_environment<dynamics::BranchingDynamics>(m, "NativeBranchingEnvironment")
+		.def(
+			"step",
+			&NativeEnvironment<dynamics::BranchingDynamics>::step,
+			py::arg("action"),
+			"Transition to the next state.");
+
+	bind_native_environment<dynamics::ConfiguringDynamics>(m, "NativeConfiguringEnvironment")
+		.def(
+			"step",
+			&NativeEnvironment<dynamics::ConfiguringDynamics>::step,
+			py::arg("action"),
+			"Transition to the next state.");
+
+	using idx_t = typename dynamics::PrimalSearchDynamics::Action::first_type::value_type;
+	using val_t = typename dynamics::PrimalSearchDynamics::Action::second_type::value_type;
+	bind_native_environment<dynamics::PrimalSearchDynamics>(m, "NativePrimalSearchEnvironment")
+		.def(
+			"step",
+			[](NativeEnvironment<dynamics::PrimalSearchDynamics>& self,
+			   std::pair<Numpy<idx_t>, Numpy<val_t>> const& action) {
+				auto const indices = nonstd::span{action.first.data(), static_cast<std::size_t>(action.first.size())};
+				auto const values = nonstd::span{action.second.data(), static_cast<std::size_t>(action.second.size())};
+				return self.step({indices, values});
+			},
+			py::arg("action"),
+			"Transition to the next state.");
+
+	m.def(
+		"make_native_environment",
+		[](py::handle py_dynamics,
+		   py::handle observation_function,
+		   py::handle reward_function,
+		   py::handle information_function) -> py::object {
+			if (is_exactly<dynamics::BranchingDynamics>(py_dynamics)) {
+				return make_native_environment<dynamics::BranchingDynamics>(
+					py_dynamics, observation_function, reward_function, information_function);
+			}
+			if (is_exactly<dynamics::ConfiguringDynamics>(py_dynamics)) {
+				return make_native_environment<dynamics::ConfiguringDynamics>(
+					py_dynamics, observation_function, reward_function, information_function);
+			}
+			if (is_exactly<dynamics::PrimalSearchDynamics>(py_dynamics)) {
+				return make_native_environment<dynamics::PrimalSearchDynamics>(
+					py_dynamics, observation_function, reward_function, information_function);
+			}
+			return py::none();
+		},
+		py::arg("dynamics"),
+		py::arg("observation_function"),
+		py::arg("reward_function"),
+		py::arg("information_function"),
+		R"(
+		Create an environment running the given components without calling back into Python.
+
+		Return None if any component is not an Ecole class, including Python subclasses of Ecole classes,
+		or if the reward function cannot be converted to native code.
+		The components are borrowed: their state is shared with the returned environment.
+	)");
+}
+
+}  // namespace ecole::environment
@@ -1,6 +1,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "ecole/information/memory.hpp"
 #include "ecole/information/nothing.hpp"
 #include "ecole/scip/model.hpp"
 
@@ -20,6 +21,24 @@ void bind_submodule(py::module_ const& m) {
 		.def(py::init<>())
 		.def("before_reset", &Nothing::before_reset, py::arg("model"), "Do nothing.")
 		.def("extract", &Nothing::extract, py::arg("model"), py::arg("done"), "Return an empty dictionnary.");
+
+	py::class_<MemoryUsage>(m, "MemoryUsage", R"(
+		Memory used by the Model and data functions, in bytes.
+
+		The dictionnary has the memory used and allocated by SCIP (``scip_used``, ``scip_total``), the estimated memory
+		allocated outside of SCIP, for instance by the LP solver (``scip_extern_estimate``), the memory held by the
+		caches of data functions (``data_functions``), and the total allocated memory (``total``).
+		The memory of data functions is only measured by environments running in C++.
+	)")
+		.def(py::init<>())
+		.def("before_reset", &MemoryUsage::before_reset, py::arg("model"), "Do nothing.")
+		.def(
+			"extract",
+			&MemoryUsage::extract,
+			py::arg("model"),
+			py::arg("done"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Return the memory used by the Model.");
 }
 
 }  // namespace ecole::information
@@ -1,8 +1,11 @@
+#include <filesystem>
 #include <memory>
 #include <tuple>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl/filesystem.h>
 
+#include "ecole/instance/archive.hpp"
 #include "ecole/instance/capacitated-facility-location.hpp"
 #include "ecole/instance/combinatorial-auction.hpp"
 #include "ecole/instance/files.hpp"
@@ -61,6 +64,9 @@ void bind_submodule(py::module const& m) {
 		Member{"directory", &FileGenerator::Parameters::directory},
 		Member{"recursive", &FileGenerator::Parameters::recursive},
 		Member{"sampling_mode", &FileGenerator::Parameters::sampling_mode},
+		Member{"shard_index", &FileGenerator::Parameters::shard_index},
+		Member{"num_shards", &FileGenerator::Parameters::num_shards},
+		Member{"prefetch", &FileGenerator::Parameters::prefetch},
 	};
 	// Bind FileGenerator and remove intermediate Parameter class
 	auto file_gen = py::class_<FileGenerator>{m, "FileGenerator"};
@@ -91,11 +97,84 @@ void bind_submodule(py::module const& m) {
 					iteration when all files are sampled once;
 				- "remove_and_repeat": Remove every file from the sampling pool right after it is sampled
 					but repeat the procedure (with different order) after all files have been sampled.
+		shard_index:
+			The index of the subset of files used by this generator, in ``[0, num_shards)``.
+		num_shards:
+			The number of disjoint subsets in which files are partitioned, in sorted order.
+			Workers using different shard indices of the same directory never load the same file.
+		prefetch:
+			The number of files selected in advance and read in the page cache.
+			If positive, the next file is also parsed (and decompressed) in a background thread while the
+			current instance is used.
 	)");
 	def_attributes(file_gen, file_params);
 	def_iterator(file_gen);
 	file_gen.def("seed", &FileGenerator::seed, py::arg(" seed"));
 
+	// The archive parameters used in constructor and attributes.
+	auto constexpr archive_params = std::tuple{
+		Member{"archive", &ArchiveGenerator::Parameters::archive},
+		Member{"sampling_mode", &ArchiveGenerator::Parameters::sampling_mode},
+		Member{"shard_index", &ArchiveGenerator::Parameters::shard_index},
+		Member{"num_shards", &ArchiveGenerator::Parameters::num_shards},
+	};
+	// Bind ArchiveGenerator and remove intermediate Parameter class
+	auto archive_gen = py::class_<ArchiveGenerator>{m, "ArchiveGenerator"};
+	archive_gen.attr("SamplingMode") = file_gen.attr("SamplingMode");
+	def_init(archive_gen, archive_params, R"(
+		Create a generator to iterate over the instances of an archive written by an :py:class:`ArchiveWriter`.
+
+		Only the index of the archive is read on construction, and every instance is read from the memory mapped
+		archive, and named as in the archive.
+
+		Parameters
+		--------
+		archive:
+			The path of the archive file.
+		sampling_mode:
+			Method to iterate over instances, as in :py:class:`FileGenerator`.
+		shard_index:
+			The index of the subset of instances used by this generator, in ``[0, num_shards)``.
+		num_shards:
+			The number of disjoint subsets in which instances are partitioned.
+	)");
+	def_attributes(archive_gen, archive_params);
+	def_iterator(archive_gen);
+	archive_gen.def("seed", &ArchiveGenerator::seed, py::arg(" seed"));
+	archive_gen.def("__len__", &ArchiveGenerator::size);
+
+	py::class_<ArchiveWriter>{m, "ArchiveWriter", R"(
+		Write problem instances in a single archive file, read by the :py:class:`ArchiveGenerator`.
+
+		Instances are stored one after the other, compressed if Ecole is compiled with zlib, and followed by an
+		index written when closing the archive.
+	)"}
+		.def(
+			py::init([](std::filesystem::path const& path, bool compress, int compression_level) {
+				return std::make_unique<ArchiveWriter>(path, ArchiveWriter::Parameters{compress, compression_level});
+			}),
+			py::arg("path"),
+			py::arg("compress") = ArchiveWriter::Parameters{}.compress,
+			py::arg("compression_level") = ArchiveWriter::Parameters{}.compression_level)
+		.def(
+			"add_file",
+			&ArchiveWriter::add_file,
+			py::arg("problem_file"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Add the content of a problem file, whose format is given by its extension, possibly followed by .gz, "
+			"named after the file name without its extensions.")
+		.def(
+			"add",
+			&ArchiveWriter::add,
+			py::arg("model"),
+			py::arg("extension") = "mps",
+			py::call_guard<py::gil_scoped_release>(),
+			"Add a problem, written in the format of the given extension, and named after the model.")
+		.def("close", &ArchiveWriter::close, "Write the index of the instances, after which no instance can be added.")
+		.def("__len__", &ArchiveWriter::size)
+		.def("__enter__", [](py::object const& self) { return self; })
+		.def("__exit__", [](ArchiveWriter& self, py::args const& /* exception */) { self.close(); });
+
 	// The Set Cover parameters used in constructor, generate_instance, and attributes
 	auto constexpr set_cover_params = std::tuple{
 		Member{"n_rows", &SetCoverGenerator::Parameters::n_rows},
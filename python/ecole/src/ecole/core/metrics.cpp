@@ -0,0 +1,133 @@
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include "ecole/utility/metrics.hpp"
+
+#include "core.hpp"
+
+namespace ecole::metrics {
+
+namespace py = pybind11;
+using namespace ecole::utility::metrics;
+
+namespace {
+
+auto to_labels(std::map<std::string, std::string> const& labels) -> Labels {
+	return {labels.begin(), labels.end()};
+}
+
+/** A timer usable as a Python context manager, observing the time between __enter__ and __exit__. */
+class PyTimer {
+public:
+	PyTimer(Histogram histogram_) : histogram{std::move(histogram_)} {}
+
+	auto enter() -> PyTimer& {
+		timer.emplace(histogram);
+		return *this;
+	}
+
+	auto exit() -> void { timer.reset(); }
+
+private:
+	Histogram histogram;
+	std::optional<Timer> timer;
+};
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Counters and histograms of Ecole internals, exported in the Prometheus text format.";
+
+	m.attr("max_slots") = max_slots;
+
+	m.def("enable", &enable, R"(
+		Start recording metrics.
+
+		Each thread adds to its own copy of the metrics, without synchronization, which are summed when read.
+	)");
+	m.def("disable", &disable, "Stop recording metrics, keeping their values.");
+	m.def("is_enabled", &is_enabled, "Whether metrics are currently recorded.");
+	m.def("reset", &reset, "Set all metrics back to zero.");
+	m.def("to_prometheus", &to_prometheus, "Format all metrics in the Prometheus text exposition format.");
+	m.def(
+		"write_prometheus",
+		&write_prometheus,
+		py::arg("filename"),
+		py::call_guard<py::gil_scoped_release>(),
+		"Write all metrics to a file in the Prometheus text format, replacing it atomically.");
+	m.def("default_latency_bounds", &default_latency_bounds, "Bucket bounds for durations in seconds, from 10us to 10s.");
+
+	py::class_<Counter>(m, "Counter", R"(
+		A monotonic count of events.
+
+		Counters with the same name and labels share their value.
+	)")
+		.def(
+			py::init([](std::string const& name, std::string const& help, std::map<std::string, std::string> const& labels) {
+				return Counter{name, help, to_labels(labels)};
+			}),
+			py::arg("name"),
+			py::arg("help"),
+			py::arg("labels") = std::map<std::string, std::string>{})
+		.def("increment", &Counter::increment, py::arg("amount") = 1, "Add to the count, if metrics are enabled.")
+		.def_property_readonly("value", &Counter::value, "Count summed over all threads.");
+
+	py::class_<Histogram>(m, "Histogram", R"(
+		A distribution of values, counted in buckets of given upper bounds.
+
+		Histograms with the same name and labels share their values, and must have the same bounds.
+	)")
+		.def(
+			py::init([](std::string const& name,
+		              std::string const& help,
+		              std::vector<double> bounds,
+		              std::map<std::string, std::string> const& labels) {
+				return Histogram{name, help, std::move(bounds), to_labels(labels)};
+			}),
+			py::arg("name"),
+			py::arg("help"),
+			py::arg("bounds") = default_latency_bounds(),
+			py::arg("labels") = std::map<std::string, std::string>{})
+		.def("observe", &Histogram::observe, py::arg("value"), "Add a value to the distribution, if metrics are enabled.")
+		.def(
+			"time",
+			[](Histogram const& self) { return PyTimer{self}; },
+			"Context manager observing the duration of a block of code in seconds.")
+		.def_property_readonly("count", &Histogram::count, "Number of values observed by all threads.")
+		.def_property_readonly("sum", &Histogram::sum, "Sum of the values observed by all threads.")
+		.def_property_readonly("bounds", &Histogram::bounds);
+
+	py::class_<PyTimer>(m, "Timer", "Context manager observing the duration of a block of code in a histogram.")
+		.def("__enter__", &PyTimer::enter, py::return_value_policy::reference_internal)
+		.def("__exit__", [](PyTimer& self, py::args const& /* exception */) { self.exit(); });
+
+	py::class_<SocketExporter>(m, "SocketExporter", R"(
+		Serve the metrics on a Unix domain socket.
+
+		A background thread answers every connection with the metrics in the Prometheus text format, as an HTTP
+		response if the client sends an HTTP request (such as ``curl --unix-socket``), and as plain text otherwise.
+		The socket file is removed when the exporter is closed.
+	)")
+		.def(py::init<std::filesystem::path>(), py::arg("path"))
+		.def(
+			"close",
+			&SocketExporter::close,
+			py::call_guard<py::gil_scoped_release>(),
+			"Stop serving and remove the socket file.")
+		.def("__enter__", [](py::object const& self) { return self; })
+		.def(
+			"__exit__",
+			[](SocketExporter& self, py::args const& /* exception */) { self.close(); },
+			py::call_guard<py::gil_scoped_release>())
+		.def_property_readonly("path", &SocketExporter::path);
+}
+
+}  // namespace ecole::metrics
@@ -12,6 +12,7 @@
 #include "ecole/observation/milp-bipartite.hpp"
 #include "ecole/observation/node-bipartite.hpp"
 #include "ecole/observation/nothing.hpp"
+#include "ecole/observation/open-nodes.hpp"
 #include "ecole/observation/pseudocosts.hpp"
 #include "ecole/observation/strong-branching-scores.hpp"
 
@@ -158,6 +159,9 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	def_before_reset(node_bipartite, "Cache some feature not expected to change during an episode.");
 	def_extract(node_bipartite, "Extract a new :py:class:`NodeBipartiteObs`.");
+	node_bipartite.def("memory_usage", &NodeBipartite::memory_usage, "Bytes held by the cached static features.");
+	node_bipartite.def(
+		"evict", &NodeBipartite::evict, "Drop the cached features, extracting all features until the next root node.");
 
 	// MILP bipartite observation
 	auto milp_bipartite_obs =
@@ -483,6 +487,47 @@ void bind_submodule(py::module_ const& m) {
 	def_before_reset(focus_node, R"(Do nothing.)");
 	def_extract(focus_node, "Extract a new :py:class:`FocusNodeObs`.");
 
+	// Open nodes observation
+	auto open_nodes_obs = ecole::python::auto_class<OpenNodesObs>(m, "OpenNodesObs", R"(
+		Features of the open nodes of the branch-and-bound tree.
+
+		The observation is a matrix where rows represent open nodes and columns represent features related
+		to these nodes.
+	)");
+	open_nodes_obs.def_auto_copy()
+		.def_auto_pickle("features")
+		.def_readwrite_xtensor("features", &OpenNodesObs::features, R"rst(
+			A matrix where each row represents an open node, and each column a feature of the node.
+
+			Children of the focus node come first, then its siblings, then the remaining leaves.
+			The position of each node in the frontier is given by the ``node_type`` feature.
+		)rst")
+		.def_readonly_static("n_features", &OpenNodesObs::n_features);
+
+	py::enum_<OpenNodesObs::Features>(open_nodes_obs, "Features")
+		.value("number", OpenNodesObs::Features::number)
+		.value("depth", OpenNodesObs::Features::depth)
+		.value("lowerbound", OpenNodesObs::Features::lowerbound)
+		.value("estimate", OpenNodesObs::Features::estimate)
+		.value("node_type", OpenNodesObs::Features::node_type)
+		.value("parent_number", OpenNodesObs::Features::parent_number);
+
+	py::enum_<OpenNodesObs::NodeType>(open_nodes_obs, "NodeType")
+		.value("child", OpenNodesObs::NodeType::child)
+		.value("sibling", OpenNodesObs::NodeType::sibling)
+		.value("leaf", OpenNodesObs::NodeType::leaf);
+
+	auto open_nodes = py::class_<OpenNodes>(m, "OpenNodes", R"(
+		Features of all open nodes of the branch-and-bound tree.
+
+		The search frontier is made of the children and siblings of the focus node, and of the other
+		leaves of the tree (``SCIPgetOpenNodesData``).
+		All open nodes are returned together so that they can be evaluated by a policy in a single batch.
+	)");
+	open_nodes.def(py::init<>());
+	def_before_reset(open_nodes, R"(Do nothing.)");
+	def_extract(open_nodes, "Extract a new :py:class:`OpenNodesObs`.");
+
 	// Capacity observation
 	auto capacity = py::class_<Capacity>(m, "Capacity", R"(
         Returns capacity of knapsacks per variable.
@@ -1,5 +1,11 @@
 #include <functional>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <pybind11/eval.h>
 #include <pybind11/functional.h>
@@ -7,6 +13,7 @@
 
 #include "ecole/reward/bound-integral.hpp"
 #include "ecole/reward/constant.hpp"
+#include "ecole/reward/expression.hpp"
 #include "ecole/reward/is-done.hpp"
 #include "ecole/reward/lp-iterations.hpp"
 #include "ecole/reward/n-nodes.hpp"
@@ -19,31 +26,59 @@ namespace py = pybind11;
 
 namespace ecole::reward {
 
+/**
+ * The RewardExpression operation equivalent to a Python operation.
+ *
+ * Reversed operations take their operands in the opposite order.
+ */
+struct NativeOp {
+	RewardExpression::Op op;
+	bool reversed = false;
+};
+
 /**
  * Proxy class for doing arithmetic on reward functions.
  *
  * This could be a pure Python class, but it needs to be defined in this module to
  * be accessible to reward functions operators.
+ * When the operation and all reward functions are known to Ecole, the whole expression is lowered
+ * to a RewardExpression and evaluated without calling back into Python.
  */
 class Arithmetic {
 public:
-	Arithmetic(py::object operation, py::list const& functions, py::str repr);
+	Arithmetic(py::object operation, py::list const& functions, py::str repr, std::optional<NativeOp> native_op = {});
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
+	[[nodiscard]] bool is_native() const;
+
+	/** Try to convert the expression, and all its sub-expressions, to a RewardExpression. */
+	[[nodiscard]] std::optional<RewardExpression> lower(std::unordered_set<PyObject*>& seen) const;
 
 private:
 	py::object operation;
 	py::list functions;
 	py::str repr;
+	std::optional<NativeOp> native_op;
+	std::optional<RewardExpression> native;
+	bool lowering_tried = false;
 };
 
 class Cumulative {
 public:
-	Cumulative(py::object function, py::object reduce_func, Reward init_cumul_, py::str repr);
+	Cumulative(
+		py::object function,
+		py::object reduce_func,
+		Reward init_cumul_,
+		py::str repr,
+		std::optional<NativeOp> native_op = {});
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
+	[[nodiscard]] bool is_native() const;
+
+	/** Try to convert the cumulation, and its wrapped expression, to a RewardExpression. */
+	[[nodiscard]] std::optional<RewardExpression> lower(std::unordered_set<PyObject*>& seen) const;
 
 private:
 	py::object reduce_func;
@@ -51,6 +86,9 @@ private:
 	Reward init_cumul;
 	Reward cumul;
 	py::str repr;
+	std::optional<NativeOp> native_op;
+	std::optional<RewardExpression> native;
+	bool lowering_tried = false;
 };
 
 /**
@@ -66,6 +104,8 @@ template <typename PyClass> void def_operators(PyClass /*pyclass*/);
 void bind_submodule(py::module_ const& m) {
 	m.doc() = "Reward classes for Ecole.";
 
+	py::register_exception<ZeroDivisionError>(m, "ZeroDivisionError", PyExc_ZeroDivisionError);
+
 	auto constant = py::class_<Constant>(m, "Constant", R"(
 		Constant Reward.
 
@@ -84,7 +124,9 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	arithmetic  //
 		.def(py::init<py::object, py::list, py::str>())
-		.def("__repr__", &Arithmetic::toString);
+		.def("__repr__", &Arithmetic::toString)
+		.def_property_readonly(
+			"is_native", &Arithmetic::is_native, "Whether the expression is evaluated without calling back into Python.");
 	def_operators(arithmetic);
 	def_before_reset(arithmetic, R"(
 		Reset the reward functions of the operator.
@@ -107,7 +149,9 @@ void bind_submodule(py::module_ const& m) {
 	)");
 	cumulative  //
 		.def(py::init<py::object, py::object, Reward, py::str>())
-		.def("__repr__", &Cumulative::toString);
+		.def("__repr__", &Cumulative::toString)
+		.def_property_readonly(
+			"is_native", &Cumulative::is_native, "Whether the cumulation is evaluated without calling back into Python.");
 	def_operators(cumulative);
 	def_before_reset(cumulative, "Reset the wrapped reward function and reset current cumulation.");
 	def_extract(cumulative, "Obtain the cumulative reward of result of wrapped function.");
@@ -271,8 +315,12 @@ void bind_submodule(py::module_ const& m) {
  *  Definition of Arithmetic  *
  ******************************/
 
-Arithmetic::Arithmetic(py::object operation_, py::list const& functions_, py::str repr_) :
-	operation(std::move(operation_)), repr(std::move(repr_)) {
+Arithmetic::Arithmetic(
+	py::object operation_,
+	py::list const& functions_,
+	py::str repr_,
+	std::optional<NativeOp> native_op_) :
+	operation(std::move(operation_)), repr(std::move(repr_)), native_op(native_op_) {
 	auto const Numbers = py::module_::import("numbers").attr("Number");
 	for (auto func : functions_) {
 		if (py::isinstance(func, Numbers)) {
@@ -284,12 +332,28 @@ Arithmetic::Arithmetic(py::object operation_, py::list const& functions_, py::st
 }
 
 void Arithmetic::before_reset(py::object const& model) {
+	if (!lowering_tried) {
+		auto seen = std::unordered_set<PyObject*>{};
+		native = lower(seen);
+		lowering_tried = true;
+	}
+	if (native.has_value() && py::isinstance<scip::Model>(model)) {
+		auto& scip_model = model.cast<scip::Model&>();
+		auto const release = py::gil_scoped_release{};
+		native->before_reset(scip_model);
+		return;
+	}
 	for (auto obs_func : functions) {
 		obs_func.attr("before_reset")(model);
 	}
 }
 
 Reward Arithmetic::extract(py::object const& model, bool done) {
+	if (native.has_value() && py::isinstance<scip::Model>(model)) {
+		auto& scip_model = model.cast<scip::Model&>();
+		auto const release = py::gil_scoped_release{};
+		return native->extract(scip_model, done);
+	}
 	py::list rewards{};
 	for (auto obs_func : functions) {
 		rewards.append(obs_func.attr("extract")(model, done));
@@ -301,23 +365,54 @@ py::str Arithmetic::toString() const {
 	return repr.format(*functions);
 }
 
+bool Arithmetic::is_native() const {
+	if (lowering_tried) {
+		return native.has_value();
+	}
+	auto seen = std::unordered_set<PyObject*>{};
+	return lower(seen).has_value();
+}
+
 /******************************
  *  Definition of Cumulative  *
  ******************************/
 
-Cumulative::Cumulative(py::object function_, py::object reduce_func_, Reward init_cumul_, py::str repr_) :
+Cumulative::Cumulative(
+	py::object function_,
+	py::object reduce_func_,
+	Reward init_cumul_,
+	py::str repr_,
+	std::optional<NativeOp> native_op_) :
 	reduce_func(std::move(reduce_func_)),
 	function(std::move(function_)),
 	init_cumul(init_cumul_),
 	cumul(init_cumul_),
-	repr(std::move(repr_)) {}
+	repr(std::move(repr_)),
+	native_op(native_op_) {}
 
 void Cumulative::before_reset(py::object const& model) {
+	if (!lowering_tried) {
+		auto seen = std::unordered_set<PyObject*>{};
+		native = lower(seen);
+		lowering_tried = true;
+	}
 	cumul = init_cumul;
+	if (native.has_value() && py::isinstance<scip::Model>(model)) {
+		auto& scip_model = model.cast<scip::Model&>();
+		auto const release = py::gil_scoped_release{};
+		native->before_reset(scip_model);
+		return;
+	}
 	function.attr("before_reset")(model);
 }
 
 Reward Cumulative::extract(py::object const& model, bool done) {
+	if (native.has_value() && py::isinstance<scip::Model>(model)) {
+		auto& scip_model = model.cast<scip::Model&>();
+		auto const release = py::gil_scoped_release{};
+		cumul = native->extract(scip_model, done);
+		return cumul;
+	}
 	auto reward = function.attr("extract")(model, done);
 	cumul = reduce_func(py::cast(cumul), reward).cast<Reward>();
 	return cumul;
@@ -327,17 +422,152 @@ py::str Cumulative::toString() const {
 	return repr.format(function);
 }
 
+bool Cumulative::is_native() const {
+	if (lowering_tried) {
+		return native.has_value();
+	}
+	auto seen = std::unordered_set<PyObject*>{};
+	return lower(seen).has_value();
+}
+
+/***********************************
+ *  Definition of reward lowering  *
+ ***********************************/
+
+namespace {
+
+/** Wrap a C++ reward function, kept alive by the Python object, as an opaque leaf. */
+template <typename RewardFunction> auto function_leaf(py::handle func) -> RewardExpression {
+	auto* const reward_function = &func.cast<RewardFunction&>();
+	return RewardExpression::function({
+		[reward_function](scip::Model& model) { reward_function->before_reset(model); },
+		[reward_function](scip::Model& model, bool done) { return reward_function->extract(model, done); },
+	});
+}
+
+/**
+ * Convert a Python reward function to a RewardExpression if it is known to Ecole.
+ *
+ * Stateful reward functions appearing more than once are not lowered, as they would not extract the same
+ * values as when called successively from Python.
+ * Python subclasses of Ecole reward functions are not lowered, as they may override their methods.
+ */
+auto lower(py::handle func, std::unordered_set<PyObject*>& seen) -> std::optional<RewardExpression> {
+	using Op = RewardExpression::Op;
+	if (is_exactly<Constant>(func)) {
+		return RewardExpression::constant(func.cast<Constant const&>().value());
+	}
+	if (is_exactly<IsDone>(func)) {
+		return RewardExpression::leaf(Op::is_done);
+	}
+	if (!seen.insert(func.ptr()).second) {
+		return {};
+	}
+	if (is_exactly<LpIterations>(func)) {
+		return RewardExpression::leaf(Op::lp_iterations);
+	}
+	if (is_exactly<NNodes>(func)) {
+		return RewardExpression::leaf(Op::n_nodes);
+	}
+	if (is_exactly<SolvingTime>(func)) {
+		auto const wall = func.cast<SolvingTime const&>().uses_wall_clock();
+		return RewardExpression::leaf(wall ? Op::wall_time : Op::cpu_time);
+	}
+	if (is_exactly<PrimalIntegral>(func)) {
+		return function_leaf<PrimalIntegral>(func);
+	}
+	if (is_exactly<DualIntegral>(func)) {
+		return function_leaf<DualIntegral>(func);
+	}
+	if (is_exactly<PrimalDualIntegral>(func)) {
+		return function_leaf<PrimalDualIntegral>(func);
+	}
+	if (is_exactly<Arithmetic>(func)) {
+		return func.cast<Arithmetic const&>().lower(seen);
+	}
+	if (is_exactly<Cumulative>(func)) {
+		return func.cast<Cumulative const&>().lower(seen);
+	}
+	return {};
+}
+
+}  // namespace
+
+auto lower_reward_function(py::handle func) -> std::optional<RewardExpression> {
+	auto seen = std::unordered_set<PyObject*>{};
+	return lower(func, seen);
+}
+
+std::optional<RewardExpression> Arithmetic::lower(std::unordered_set<PyObject*>& seen) const {
+	if (!native_op.has_value()) {
+		return {};
+	}
+	auto operands = std::vector<RewardExpression>{};
+	for (auto func : functions) {
+		auto operand = reward::lower(func, seen);
+		if (!operand.has_value()) {
+			return {};
+		}
+		operands.push_back(std::move(operand).value());
+	}
+	if (RewardExpression::is_unary(native_op->op) && operands.size() == 1) {
+		return RewardExpression::unary(native_op->op, std::move(operands[0]));
+	}
+	if (RewardExpression::is_binary(native_op->op) && operands.size() == 2) {
+		if (native_op->reversed) {
+			return RewardExpression::binary(native_op->op, std::move(operands[1]), std::move(operands[0]));
+		}
+		return RewardExpression::binary(native_op->op, std::move(operands[0]), std::move(operands[1]));
+	}
+	return {};
+}
+
+std::optional<RewardExpression> Cumulative::lower(std::unordered_set<PyObject*>& seen) const {
+	if (!native_op.has_value() || (init_cumul != 0.)) {
+		return {};
+	}
+	auto operand = reward::lower(function, seen);
+	if (!operand.has_value()) {
+		return {};
+	}
+	return RewardExpression::unary(native_op->op, std::move(operand).value());
+}
+
 /************************************
  *  Definition of helper functions  *
  ************************************/
 
+/** Whether the class forwards calls to Python objects, hence needs the GIL. */
+template <typename T>
+inline constexpr bool calls_python_v = std::is_same_v<T, Arithmetic> || std::is_same_v<T, Cumulative>;
+
 template <typename PyClass, typename... Args> void def_before_reset(PyClass pyclass, Args&&... args) {
-	pyclass.def("before_reset", &PyClass::type::before_reset, py::arg("model"), std::forward<Args>(args)...);
+	using Class = typename PyClass::type;
+	if constexpr (calls_python_v<Class>) {
+		pyclass.def("before_reset", &Class::before_reset, py::arg("model"), std::forward<Args>(args)...);
+	} else {
+		pyclass.def(
+			"before_reset",
+			&Class::before_reset,
+			py::arg("model"),
+			py::call_guard<py::gil_scoped_release>(),
+			std::forward<Args>(args)...);
+	}
 }
 
 template <typename PyClass, typename... Args> void def_extract(PyClass pyclass, Args&&... args) {
-	pyclass.def(
-		"extract", &PyClass::type::extract, py::arg("model"), py::arg("done") = false, std::forward<Args>(args)...);
+	using Class = typename PyClass::type;
+	if constexpr (calls_python_v<Class>) {
+		pyclass.def("extract", &Class::extract, py::arg("model"), py::arg("done") = false, std::forward<Args>(args)...);
+	} else {
+		pyclass.def(
+			"extract",
+			&Class::extract,
+			py::arg("model"),
+			py::arg("done") = false,
+			py::call_guard<py::gil_scoped_release>(),
+			std::forward<Args>(args)...);
+	}
 }
 
 template <typename PyClass> void def_operators(PyClass pyclass) {
@@ -348,45 +578,46 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 	// Return a function that wraps rewards functions inside an ArithmeticReward.
 	// The Arithmetic reward function is a reward function class that will call the wrapped
 	// reward functions and merge there rewards with the relevant operation (sum, prod, ...)
-	auto const arith_meth = [](auto operation, auto repr) {
-		return [operation, repr](py::args const& args) { return Arithmetic{operation, args, repr}; };
+	auto const arith_meth = [](auto operation, auto repr, std::optional<NativeOp> native_op = {}) {
+		return [operation, repr, native_op](py::args const& args) { return Arithmetic{operation, args, repr, native_op}; };
 	};
+	using Op = RewardExpression::Op;
 
 	pyclass
 		// Binary operators
-		.def("__add__", arith_meth(py::eval("lambda x, y: x + y"), "({} + {})"))
-		.def("__sub__", arith_meth(py::eval("lambda x, y: x - y"), "({} - {})"))
-		.def("__mul__", arith_meth(py::eval("lambda x, y: x * y"), "({} * {})"))
+		.def("__add__", arith_meth(py::eval("lambda x, y: x + y"), "({} + {})", NativeOp{Op::add}))
+		.def("__sub__", arith_meth(py::eval("lambda x, y: x - y"), "({} - {})", NativeOp{Op::sub}))
+		.def("__mul__", arith_meth(py::eval("lambda x, y: x * y"), "({} * {})", NativeOp{Op::mul}))
 		.def("__matmul__", arith_meth(py::eval("lambda x, y: x @ y"), "({} @ {})"))
-		.def("__truediv__", arith_meth(py::eval("lambda x, y: x / y"), "({} / {})"))
-		.def("__floordiv__", arith_meth(py::eval("lambda x, y: x // y"), "({} // {})"))
-		.def("__mod__", arith_meth(py::eval("lambda x, y: x % y"), "({} % {})"))
+		.def("__truediv__", arith_meth(py::eval("lambda x, y: x / y"), "({} / {})", NativeOp{Op::truediv}))
+		.def("__floordiv__", arith_meth(py::eval("lambda x, y: x // y"), "({} // {})", NativeOp{Op::floordiv}))
+		.def("__mod__", arith_meth(py::eval("lambda x, y: x % y"), "({} % {})", NativeOp{Op::mod}))
 		.def("__divmod__", arith_meth(builtins.attr("divmod"), "divmod({}, {})"))
-		.def("__pow__", arith_meth(builtins.attr("pow"), "({} ** {})"))
+		.def("__pow__", arith_meth(builtins.attr("pow"), "({} ** {})", NativeOp{Op::pow}))
 		.def("__lshift__", arith_meth(py::eval("lambda x, y: x << y"), "({} << {})"))
 		.def("__rshift__", arith_meth(py::eval("lambda x, y: x >> y"), "({} >> {})"))
 		.def("__and__", arith_meth(py::eval("lambda x, y: x & y"), "({} & {})"))
 		.def("__xor__", arith_meth(py::eval("lambda x, y: x ^ y"), "({} ^ {})"))
 		.def("__or__", arith_meth(py::eval("lambda x, y: x | y"), "({} | {})"))
 		// Reversed binary operators
-		.def("__radd__", arith_meth(py::eval("lambda x, y: y + x"), "({1} + {0})"))
-		.def("__rsub__", arith_meth(py::eval("lambda x, y: y - x"), "({1} - {0})"))
-		.def("__rmul__", arith_meth(py::eval("lambda x, y: y * x"), "({1} * {0})"))
+		.def("__radd__", arith_meth(py::eval("lambda x, y: y + x"), "({1} + {0})", NativeOp{Op::add, true}))
+		.def("__rsub__", arith_meth(py::eval("lambda x, y: y - x"), "({1} - {0})", NativeOp{Op::sub, true}))
+		.def("__rmul__", arith_meth(py::eval("lambda x, y: y * x"), "({1} * {0})", NativeOp{Op::mul, true}))
 		.def("__rmatmul__", arith_meth(py::eval("lambda x, y: y @ x"), "({1} @ {0})"))
-		.def("__rtruediv__", arith_meth(py::eval("lambda x, y: y / x"), "({1} / {0})"))
-		.def("__rfloordiv__", arith_meth(py::eval("lambda x, y: y // x"), "({1} // {0})"))
-		.def("__rmod__", arith_meth(py::eval("lambda x, y: y % x"), "({1} % {0})"))
+		.def("__rtruediv__", arith_meth(py::eval("lambda x, y: y / x"), "({1} / {0})", NativeOp{Op::truediv, true}))
+		.def("__rfloordiv__", arith_meth(py::eval("lambda x, y: y // x"), "({1} // {0})", NativeOp{Op::floordiv, true}))
+		.def("__rmod__", arith_meth(py::eval("lambda x, y: y % x"), "({1} % {0})", NativeOp{Op::mod, true}))
 		.def("__rdivmod__", arith_meth(py::eval("lambda x, y: divmod(y, x)"), "divmod({1}, {0})"))
-		.def("__rpow__", arith_meth(py::eval("lambda x, y: y ** x"), "({1} ** {0})"))
+		.def("__rpow__", arith_meth(py::eval("lambda x, y: y ** x"), "({1} ** {0})", NativeOp{Op::pow, true}))
 		.def("__rlshift__", arith_meth(py::eval("lambda x, y: y << x"), "({1} << {0})"))
 		.def("__rrshift__", arith_meth(py::eval("lambda x, y: y >> x"), "({1} >> {0})"))
 		.def("__rand__", arith_meth(py::eval("lambda x, y: y & x"), "({1} & {0})"))
 		.def("__rxor__", arith_meth(py::eval("lambda x, y: y ^ x"), "({1} ^ {0})"))
 		.def("__ror__", arith_meth(py::eval("lambda x, y: y | x"), "({1} | {0})"))
 		// Unary operator
-		.def("__neg__", arith_meth(py::eval("lambda x: -x"), "(-{})"))
+		.def("__neg__", arith_meth(py::eval("lambda x: -x"), "(-{})", NativeOp{Op::neg}))
 		.def("__pos__", arith_meth(py::eval("lambda x: +x"), "(+{})"))
-		.def("__abs__", arith_meth(builtins.attr("abs"), "(abs({}))"))
+		.def("__abs__", arith_meth(builtins.attr("abs"), "(abs({}))", NativeOp{Op::abs}))
 		.def("__invert__", arith_meth(py::eval("lambda x: ~x"), "(~{})"))
 		.def("__int__", arith_meth(builtins.attr("int"), "int({})"))
 		.def("__float__", arith_meth(builtins.attr("float"), "float({})"))
@@ -397,11 +628,15 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 		.def("__ceil__", arith_meth(math.attr("ceil"), "math.ceil({})"));
 	// Custom Math methods
 	// clang-format off
-	for (const auto *const name : {
-		"exp", "log", "log2", "log10", "sqrt", "sin", "cos", "tan", "asin", "acos", "atan",
-		"sinh", "cosh", "tanh", "asinh", "acosh", "atanh", "isfinite", "isinf", "isnan"
-	}) {
-		pyclass.def(name, arith_meth(math.attr(name), std::string{"{}."} + name + "()"));
+	auto const math_ops = std::initializer_list<std::pair<char const*, Op>>{
+		{"exp", Op::exp}, {"log", Op::log}, {"log2", Op::log2}, {"log10", Op::log10}, {"sqrt", Op::sqrt},
+		{"sin", Op::sin}, {"cos", Op::cos}, {"tan", Op::tan}, {"asin", Op::asin}, {"acos", Op::acos},
+		{"atan", Op::atan}, {"sinh", Op::sinh}, {"cosh", Op::cosh}, {"tanh", Op::tanh}, {"asinh", Op::asinh},
+		{"acosh", Op::acosh}, {"atanh", Op::atanh}, {"isfinite", Op::isfinite}, {"isinf", Op::isinf},
+		{"isnan", Op::isnan},
+	};
+	for (auto const [name, op] : math_ops) {
+		pyclass.def(name, arith_meth(math.attr(name), std::string{"{}."} + name + "()", NativeOp{op}));
 	}
 	// clang-format on
 	pyclass.def("apply", [](py::object const& self, py::object func) {
@@ -409,7 +644,8 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 	});
 	// Cumulative methods
 	pyclass.def("cumsum", [](py::object self) {
-		return Cumulative{std::move(self), py::eval("lambda x, y: x + y"), 0., "{}.cumsum()"};
+		return Cumulative{
+			std::move(self), py::eval("lambda x, y: x + y"), 0., "{}.cumsum()", NativeOp{RewardExpression::Op::cumsum}};
 	});
 }
 
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <filesystem>
 #include <memory>
 #include <vector>
 
@@ -129,7 +130,8 @@ void bind_submodule(py::module_ m) {
 
 	py::class_<Model>(m, "Model")  //
 		.def_static("from_file", &Model::from_file, py::arg("filepath"), py::call_guard<py::gil_scoped_release>())
-		.def_static("prob_basic", &Model::prob_basic, py::arg("name") = "Model")
+		.def_static(
+			"prob_basic", &Model::prob_basic, py::arg("name") = "Model", py::call_guard<py::gil_scoped_release>())
 		.def_static(
 			"from_pyscipopt",
 			[](py::object const& pyscipopt_model) {
@@ -150,6 +152,14 @@ void bind_submodule(py::module_ m) {
 		.def(py::self != py::self)  // NOLINT(misc-redundant-expression)  pybind specific syntax
 
 		.def("copy_orig", &Model::copy_orig, py::call_guard<py::gil_scoped_release>())
+		.def("copy_local", &Model::copy_local, py::call_guard<py::gil_scoped_release>(), R"(
+			Copy the subproblem of the current node.
+
+			While solving, the transformed problem is copied with the local bounds of the focus node.
+			The copy is an independent problem that can be solved, or branched on, to explore different
+			decisions from the same node.
+			The rest of the branch-and-bound tree is not copied.
+		)")
 		.def(
 			"as_pyscipopt",
 			[](scip::Model& model) {
@@ -165,14 +175,30 @@ void bind_submodule(py::module_ m) {
 
 		.def_property("name", &Model::name, &Model::set_name)
 		.def_property_readonly("stage", &Model::stage)
-
-		.def("get_param", &Model::get_param<Param>, py::arg("name"))
-		.def("set_param", &Model::set_param<Param>, py::arg("name"), py::arg("value"))
-		.def("get_params", &Model::get_params)
-		.def("set_params", &Model::set_params, py::arg("name_values"))
-		.def("disable_cuts", &Model::disable_cuts)
-		.def("disable_presolve", &Model::disable_presolve)
-		.def("write_problem", &Model::write_problem, py::arg("filepath"), py::call_guard<py::gil_scoped_release>())
+		.def_property_readonly("memory_used", &Model::memory_used, "Bytes of block memory used by SCIP.")
+		.def_property_readonly(
+			"memory_total", &Model::memory_total, "Bytes of block memory allocated by SCIP, including unused blocks.")
+		.def_property_readonly(
+			"memory_extern_estimate",
+			&Model::memory_extern_estimate,
+			"Estimate of the bytes allocated outside of block memory, such as by the LP solver.")
+
+		.def("get_param", &Model::get_param<Param>, py::arg("name"), py::call_guard<py::gil_scoped_release>())
+		.def(
+			"set_param",
+			&Model::set_param<Param>,
+			py::arg("name"),
+			py::arg("value"),
+			py::call_guard<py::gil_scoped_release>())
+		.def("get_params", &Model::get_params, py::call_guard<py::gil_scoped_release>())
+		.def("set_params", &Model::set_params, py::arg("name_values"), py::call_guard<py::gil_scoped_release>())
+		.def("disable_cuts", &Model::disable_cuts, py::call_guard<py::gil_scoped_release>())
+		.def("disable_presolve", &Model::disable_presolve, py::call_guard<py::gil_scoped_release>())
+		.def(
+			"write_problem",
+			py::overload_cast<std::filesystem::path const&>(&Model::write_problem, py::const_),
+			py::arg("filepath"),
+			py::call_guard<py::gil_scoped_release>())
 
 		.def("transform_prob", &Model::transform_prob, py::call_guard<py::gil_scoped_release>())
 		.def("presolve", &Model::presolve, py::call_guard<py::gil_scoped_release>())
@@ -193,9 +219,14 @@ void bind_submodule(py::module_ m) {
 					return py_arg.cast<callback::DynamicConstructor>();
 				});
 				// Call the function
+				auto const release = py::gil_scoped_release{};
 				return self.solve_iter(args);
 			})
-		.def("solve_iter_continue", &Model::solve_iter_continue);
+		.def(
+			"solve_iter_continue",
+			&Model::solve_iter_continue,
+			py::arg("result"),
+			py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace ecole::scip
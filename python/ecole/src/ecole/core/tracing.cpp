@@ -0,0 +1,73 @@
+#include <optional>
+#include <string>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "ecole/utility/tracing.hpp"
+
+#include "core.hpp"
+
+namespace ecole::tracing {
+
+namespace py = pybind11;
+using namespace ecole::utility::tracing;
+
+namespace {
+
+/** A span usable as a Python context manager, recording between __enter__ and __exit__. */
+class PySpan {
+public:
+	PySpan(std::string const& name_, std::string const& category_) : name{intern(name_)}, category{intern(category_)} {}
+
+	auto enter() -> PySpan& {
+		span.emplace(name, category);
+		return *this;
+	}
+
+	auto exit() -> void { span.reset(); }
+
+private:
+	char const* name;
+	char const* category;
+	std::optional<Span> span;
+};
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Step-level tracing of Ecole internals, exported in the Chrome Trace Event format.";
+
+	py::class_<Event>(m, "Event", "A completed span, with times in nanoseconds.")
+		.def_readonly("name", &Event::name)
+		.def_readonly("category", &Event::category)
+		.def_readonly("start_ns", &Event::start_ns)
+		.def_readonly("duration_ns", &Event::duration_ns)
+		.def_readonly("thread_id", &Event::thread_id);
+
+	m.attr("default_capacity") = default_capacity;
+
+	m.def("enable", &enable, py::arg("capacity_per_thread") = default_capacity, R"(
+		Start recording spans.
+
+		Each thread records in its own ring buffer of the given capacity, overwriting its oldest events when full.
+		Previously recorded events are discarded.
+	)");
+	m.def("disable", &disable, "Stop recording spans, keeping the events recorded so far.");
+	m.def("is_enabled", &is_enabled, "Whether spans are currently recorded.");
+	m.def("clear", &clear, "Discard all recorded events.");
+	m.def("collect", &collect, "Return the events recorded by all threads, sorted by start time.");
+	m.def("to_chrome_json", &to_chrome_json, "Format the recorded events in the Chrome Trace Event format.");
+	m.def(
+		"write_chrome_json",
+		&write_chrome_json,
+		py::arg("filename"),
+		"Write the recorded events to a file, to be opened in chrome://tracing or Perfetto.");
+
+	py::class_<PySpan>(m, "Span", "Context manager recording the duration of a block of code.")
+		.def(py::init<std::string const&, std::string const&>(), py::arg("name"), py::arg("category") = "python")
+		.def("__enter__", &PySpan::enter, py::return_value_policy::reference_internal)
+		.def("__exit__", [](PySpan& self, py::args const& /* exception */) { self.exit(); });
+}
+
+}  // namespace ecole::tracing
@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "ecole/utility/shared-ring.hpp"
+
+#include "core.hpp"
+
+namespace ecole::transport {
+
+namespace py = pybind11;
+using utility::SharedRing;
+
+namespace {
+
+/*******************************************
+ *  Binary layout of messages in the ring  *
+ *******************************************/
+
+constexpr std::uint32_t message_magic = 0x65636f6c;  // "ecol"
+constexpr std::size_t data_alignment = 64;
+constexpr std::size_t max_ndim = 4;
+
+/** Beginning of every message, followed by n_arrays ArrayHeader. */
+struct MessageHeader {
+	std::uint32_t magic;
+	std::uint32_t n_arrays;
+	char kind[56];  // NOLINT(cppcoreguidelines-avoid-c-arrays) fixed binary layout
+};
+
+/** Description of an array, whose data is at the given offset from the beginning of the message. */
+struct ArrayHeader {
+	char name[56];  // NOLINT(cppcoreguidelines-avoid-c-arrays) fixed binary layout
+	char dtype[8];  // NOLINT(cppcoreguidelines-avoid-c-arrays) fixed binary layout
+	std::uint64_t ndim;
+	std::uint64_t shape[max_ndim];  // NOLINT(cppcoreguidelines-avoid-c-arrays) fixed binary layout
+	std::uint64_t offset;
+	std::uint64_t nbytes;
+	std::uint64_t reserved;
+};
+
+static_assert(sizeof(MessageHeader) == 64);
+static_assert(sizeof(ArrayHeader) == 128);
+
+constexpr auto align(std::size_t size) noexcept -> std::size_t {
+	return (size + data_alignment - 1) / data_alignment * data_alignment;
+}
+
+/** Raised when the ring is full, or empty, for longer than the timeout. */
+class TimeoutError : public std::runtime_error {
+public:
+	using std::runtime_error::runtime_error;
+};
+
+/** Convert a Python timeout in seconds. */
+auto to_timeout(std::optional<double> seconds) -> SharedRing::Timeout {
+	if (!seconds.has_value()) {
+		return {};
+	}
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>{seconds.value()});
+}
+
+/** Copy a string in a fixed size, null terminated, field. */
+template <std::size_t N> auto copy_field(char (&field)[N], std::string const& value, char const* what) -> void {
+	if (value.size() >= N) {
+		throw std::invalid_argument{fmt::format("{} '{}' exceeds {} characters.", what, value, N - 1)};
+	}
+	std::fill(std::begin(field), std::end(field), '\0');
+	std::copy(value.begin(), value.end(), std::begin(field));
+}
+
+template <std::size_t N> auto read_field(char const (&field)[N]) -> std::string {
+	return {std::begin(field), std::find(std::begin(field), std::end(field), '\0')};
+}
+
+/**
+ * A slot read from the ring, released when destroyed.
+ *
+ * Used as the base object of the arrays pointing in the slot, so that the slot is released when the last one is
+ * garbage collected.
+ * The Python ring is kept alive so that its memory stays mapped.
+ */
+class SlotLease {
+public:
+	SlotLease(py::object py_ring_, std::size_t slot_) : py_ring{std::move(py_ring_)}, slot{slot_} {}
+	SlotLease(SlotLease const&) = delete;
+	SlotLease(SlotLease&&) = delete;
+	auto operator=(SlotLease const&) -> SlotLease& = delete;
+	auto operator=(SlotLease&&) -> SlotLease& = delete;
+
+	~SlotLease() {
+		try {
+			py_ring.cast<SharedRing&>().release(slot);
+		} catch (std::exception const&) {
+			// Never throw in a destructor, the slot can only be lost if the ring was misused
+		}
+	}
+
+private:
+	py::object py_ring;
+	std::size_t slot;
+};
+
+/** Write the arrays in the next slot, waiting without the GIL for it to be free. */
+auto put_arrays(SharedRing& ring, std::string const& kind, py::dict const& arrays, std::optional<double> timeout)
+	-> void {
+	auto message_header = MessageHeader{message_magic, static_cast<std::uint32_t>(arrays.size()), {}};
+	copy_field(message_header.kind, kind, "Message kind");
+
+	auto contiguous_arrays = std::vector<py::array>{};
+	auto array_headers = std::vector<ArrayHeader>{};
+	auto size = align(sizeof(MessageHeader) + arrays.size() * sizeof(ArrayHeader));
+	for (auto const& [key, value] : arrays) {
+		auto array = py::array::ensure(value, py::array::c_style);
+		if (!array) {
+			throw std::invalid_argument{"Values must be convertible to Numpy arrays."};
+		}
+		if (array.dtype().attr("hasobject").cast<bool>()) {
+			// The bytes of Python objects are pointers, meaningless in another process
+			throw py::type_error{"Arrays of Python objects cannot be put in shared memory."};
+		}
+		if (static_cast<std::size_t>(array.ndim()) > max_ndim) {
+			throw std::invalid_argument{fmt::format("Arrays must have at most {} dimensions.", max_ndim)};
+		}
+		auto header = ArrayHeader{};
+		copy_field(header.name, key.cast<std::string>(), "Array name");
+		copy_field(header.dtype, array.dtype().attr("str").cast<std::string>(), "Array dtype");
+		header.ndim = static_cast<std::uint64_t>(array.ndim());
+		std::copy_n(array.shape(), array.ndim(), std::begin(header.shape));
+		header.offset = size;
+		header.nbytes = static_cast<std::uint64_t>(array.nbytes());
+		size = align(size + header.nbytes);
+		array_headers.push_back(header);
+		contiguous_arrays.push_back(std::move(array));
+	}
+	if (size > ring.slot_capacity()) {
+		throw std::invalid_argument{
+			fmt::format("Message of {} bytes exceeds slot capacity {}.", size, ring.slot_capacity())};
+	}
+
+	auto const release = py::gil_scoped_release{};
+	auto slot = ring.begin_write(to_timeout(timeout));
+	if (!slot.has_value()) {
+		throw TimeoutError{"Timed out waiting for a free slot."};
+	}
+	auto* const data = slot->data();
+	std::memcpy(data, &message_header, sizeof(MessageHeader));
+	std::memcpy(data + sizeof(MessageHeader), array_headers.data(), array_headers.size() * sizeof(ArrayHeader));
+	for (std::size_t i = 0; i < array_headers.size(); ++i) {
+		std::memcpy(data + array_headers[i].offset, contiguous_arrays[i].data(), array_headers[i].nbytes);
+	}
+	ring.commit_write(size);
+}
+
+/** Throw if the array described by the header does not fit in the message, as with a corrupt message. */
+auto check_array_header(ArrayHeader const& header, std::size_t itemsize, std::size_t message_size) -> void {
+	if (header.ndim > max_ndim) {
+		throw std::runtime_error{fmt::format("Array has {} dimensions, more than {}.", header.ndim, max_ndim)};
+	}
+	if ((header.offset > message_size) || (header.nbytes > message_size - header.offset)) {
+		throw std::runtime_error{fmt::format(
+			"Array of {} bytes at offset {} does not fit in a message of {} bytes.",
+			header.nbytes,
+			header.offset,
+			message_size)};
+	}
+	auto expected_nbytes = static_cast<std::uint64_t>(itemsize);
+	for (std::size_t d = 0; d < header.ndim; ++d) {
+		if ((header.shape[d] != 0) && (expected_nbytes > message_size / header.shape[d])) {
+			throw std::runtime_error{"Array shape does not fit in the message."};
+		}
+		expected_nbytes *= header.shape[d];
+	}
+	if (expected_nbytes != header.nbytes) {
+		throw std::runtime_error{
+			fmt::format("Array shape and type need {} bytes, but the message has {}.", expected_nbytes, header.nbytes)};
+	}
+}
+
+/** Read the next message, returning arrays pointing in the slot. */
+auto get_arrays(py::object const& py_ring, std::optional<double> timeout) -> std::pair<std::string, py::dict> {
+	auto& ring = py_ring.cast<SharedRing&>();
+	auto const message = [&] {
+		auto const release = py::gil_scoped_release{};
+		return ring.read(to_timeout(timeout));
+	}();
+	if (!message.has_value()) {
+		throw TimeoutError{"Timed out waiting for a message."};
+	}
+	// Created first to release the slot if anything goes wrong
+	auto lease = py::cast(std::make_unique<SlotLease>(py_ring, message->slot));
+
+	auto const* const data = message->data.data();
+	auto const size = message->data.size();
+	auto message_header = MessageHeader{};
+	if (size < sizeof(MessageHeader)) {
+		throw std::runtime_error{"Message is too small to hold a header."};
+	}
+	std::memcpy(&message_header, data, sizeof(MessageHeader));
+	if (message_header.magic != message_magic) {
+		throw std::runtime_error{"Message was not written by put_arrays."};
+	}
+	if (message_header.n_arrays > (size - sizeof(MessageHeader)) / sizeof(ArrayHeader)) {
+		throw std::runtime_error{
+			fmt::format("Message of {} bytes cannot hold {} array headers.", size, message_header.n_arrays)};
+	}
+
+	auto arrays = py::dict{};
+	for (std::size_t i = 0; i < message_header.n_arrays; ++i) {
+		auto header = ArrayHeader{};
+		std::memcpy(&header, data + sizeof(MessageHeader) + i * sizeof(ArrayHeader), sizeof(ArrayHeader));
+		auto const dtype = py::dtype{read_field(header.dtype)};
+		check_array_header(header, static_cast<std::size_t>(dtype.itemsize()), size);
+		auto const shape = std::vector<py::ssize_t>(header.shape, header.shape + header.ndim);
+		arrays[py::str(read_field(header.name))] = py::array{dtype, shape, data + header.offset, lease};
+	}
+	return {read_field(message_header.kind), std::move(arrays)};
+}
+
+}  // namespace
+
+/**
+ * Transport module bindings definitions.
+ */
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Shared memory transport of observations between processes.";
+
+	py::register_exception<TimeoutError>(m, "TimeoutError", PyExc_TimeoutError);
+
+	py::class_<SlotLease>(m, "_SlotLease", "A slot of SharedRing, released when garbage collected.");
+
+	py::class_<SharedRing>(m, "SharedRing", R"(
+		A single producer, single consumer ring of messages in POSIX shared memory.
+
+		The ring has a fixed number of slots of fixed capacity.
+		Arrays put in the ring are copied once in shared memory, and the arrays returned by the reader are views in
+		that memory, without copy.
+		A slot is recycled when all the arrays read from it are garbage collected.
+		When no slot is free, the producer waits (backpressure).
+
+		Each message starts with a 64 bytes header (``uint32`` magic, ``uint32`` number of arrays, 56 characters kind),
+		followed by a 128 bytes header per array (56 characters name, 8 characters Numpy dtype string, ``uint64``
+		number of dimensions, 4 ``uint64`` shape, ``uint64`` offset in the message, ``uint64`` size in bytes, and
+		8 reserved bytes).
+		The C-contiguous data of every array follows, aligned on 64 bytes.
+	)")
+		.def(
+			py::init(&SharedRing::create),
+			py::arg("name"),
+			py::arg("n_slots"),
+			py::arg("slot_capacity"),
+			"Create a new ring, whose name is unlinked when this object is garbage collected.")
+		.def(py::init(&SharedRing::open), py::arg("name"), "Open a ring created in another process.")
+		.def_property_readonly("name", &SharedRing::name)
+		.def_property_readonly("n_slots", &SharedRing::n_slots)
+		.def_property_readonly("slot_capacity", &SharedRing::slot_capacity)
+		.def_property_readonly("n_written", &SharedRing::n_written, "Number of messages written since creation.")
+		.def_property_readonly("n_read", &SharedRing::n_read, "Number of messages read since creation.")
+		.def(
+			"put_arrays",
+			&put_arrays,
+			py::arg("kind"),
+			py::arg("arrays"),
+			py::arg("timeout") = py::none(),
+			R"(
+			Copy a dictionary of arrays in the next slot.
+
+			Wait, without holding the GIL, for the slot to be free, at most timeout seconds if not None.
+			Raise a TimeoutError if the slot is not released in time.
+		)")
+		.def(
+			"get_arrays",
+			&get_arrays,
+			py::arg("timeout") = py::none(),
+			R"(
+			Read the next message as its kind and a dictionary of arrays.
+
+			The arrays are views in shared memory, and the slot is released when they are all garbage collected.
+			Wait, without holding the GIL, at most timeout seconds if not None.
+			Raise a TimeoutError if no message is written in time.
+		)")
+		.def(py::pickle(
+			[](SharedRing const& self) { return py::make_tuple(self.name()); },
+			[](py::tuple const& state) { return SharedRing::open(state[0].cast<std::string>()); }));
+}
+
+}  // namespace ecole::transport
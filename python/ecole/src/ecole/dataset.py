@@ -0,0 +1,10 @@
+"""Chunked, columnar, datasets of samples, for instance for imitation learning.
+
+A :py:class:`DatasetWriter` copies samples in chunks that are compressed and written to shard files
+by a background thread.
+A :py:class:`DatasetReader` memory maps the shards and returns samples as read only Numpy arrays.
+Environments record their transitions in a writer with :py:meth:`ecole.environment.Environment.record`.
+"""
+
+import ecole.core.dataset
+from ecole.core.dataset import *
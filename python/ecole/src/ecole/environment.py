@@ -8,6 +8,11 @@ class Environment:
 
     Similar to OpenAI Gym, environments represent the task that an agent is supposed to solve.
     For maximum customizability, different components are composed/orchestrated in this class.
+
+    When the dynamics and all data functions are Ecole classes (not Python subclasses), and no extra
+    dynamics arguments are given, episodes run in C++: every :meth:`reset` and :meth:`step` is a single
+    call that releases the GIL.
+    Otherwise, the components are orchestrated in Python.
     """
 
     __Dynamics__ = None
@@ -21,6 +26,7 @@ class Environment:
         reward_function=ecole.Default,
         information_function=ecole.Default,
         scip_params=None,
+        memory_limit=None,
         **dynamics_kwargs
     ) -> None:
         """Create a new environment object.
@@ -38,6 +44,11 @@ class Environment:
             additional information returned by :meth:`reset` and :meth:`step`.
         scip_params:
             Parameters set on the underlying :py:class:`~ecole.scip.Model` at the start of every episode.
+        memory_limit:
+            Optional soft limit on the memory of the :py:class:`~ecole.scip.Model` and the caches of the data
+            functions, in bytes.
+            It is set as the SCIP ``limits/memory`` parameter, which ends the episode when exceeded, and the
+            caches of data functions are evicted after every transition exceeding it.
         **dynamics_kwargs:
             Other arguments are passed to the constructor of the :py:class:`~ecole.typing.Dynamics`.
 
@@ -51,11 +62,17 @@ class Environment:
             information_function, self.__DefaultInformationFunction__()
         )
         self.scip_params = scip_params if scip_params is not None else {}
+        self.memory_limit = memory_limit
         self.model = None
         self.dynamics = self.__Dynamics__(**dynamics_kwargs)
         self.can_transition = False
         self.rng = ecole.spawn_random_generator()
+        self._native_cache = (None, None)
+        self._native = None
+        self._dataset_writer = None
+        self._record_trajectory = False
 
+    @ecole.tracing.traced("Environment.reset", "environment")
     def reset(self, instance, *dynamics_args, **dynamics_kwargs):
         """Start a new episode.
 
@@ -100,19 +117,46 @@ class Environment:
 
         """
         self.can_transition = True
+        self._native = None
         try:
+            native = None if dynamics_args or dynamics_kwargs else self._native_environment()
+            if native is None and self._dataset_writer is not None:
+                raise ValueError(
+                    "Only environments running in C++ can record transitions, "
+                    "which requires Ecole components and no extra dynamics arguments."
+                )
+            if native is None and self._record_trajectory:
+                raise ValueError(
+                    "Only environments running in C++ can record trajectories, "
+                    "which requires Ecole components and no extra dynamics arguments."
+                )
+            if native is not None:
+                native.record(self._dataset_writer)
+                native.record_trajectory(self._record_trajectory)
+                native.memory_limit = self.memory_limit
+                observation, action_set, reward_offset, done, information = native.reset(
+                    instance, self.rng, self.scip_params
+                )
+                self.model = native.model
+                self._native = native
+                self.can_transition = not done
+                return observation, action_set, reward_offset, done, information
+
             if isinstance(instance, ecole.core.scip.Model):
                 self.model = instance.copy_orig()
             else:
                 self.model = ecole.core.scip.Model.from_file(instance)
             self.model.set_params(self.scip_params)
+            if self.memory_limit is not None:
+                self.model.set_param("limits/memory", self.memory_limit / 2**20)
 
             self.dynamics.set_dynamics_random_state(self.model, self.rng)
 
             # Reset data extraction functions
-            self.reward_function.before_reset(self.model)
-            self.observation_function.before_reset(self.model)
-            self.information_function.before_reset(self.model)
+            with ecole.tracing.span("Environment.before_reset", "data"):
+                self.reward_function.before_reset(self.model)
+                self.observation_function.before_reset(self.model)
+                self.information_function.before_reset(self.model)
 
             # Place the environment in its initial state
             done, action_set = self.dynamics.reset_dynamics(
@@ -121,18 +165,23 @@ class Environment:
             self.can_transition = not done
 
             # Extract additional information to be returned by reset
-            reward_offset = self.reward_function.extract(self.model, done)
+            with ecole.tracing.span("RewardFunction.extract", "data"):
+                reward_offset = self.reward_function.extract(self.model, done)
             if not done:
-                observation = self.observation_function.extract(self.model, done)
+                with ecole.tracing.span("ObservationFunction.extract", "data"):
+                    observation = self.observation_function.extract(self.model, done)
             else:
                 observation = None
-            information = self.information_function.extract(self.model, done)
+            with ecole.tracing.span("InformationFunction.extract", "data"):
+                information = self.information_function.extract(self.model, done)
+            self._enforce_memory_limit()
 
             return observation, action_set, reward_offset, done, information
         except Exception as e:
             self.can_transition = False
             raise e
 
+    @ecole.tracing.traced("Environment.step", "environment")
     def step(self, action, *dynamics_args, **dynamics_kwargs):
         """Transition from one state to another.
 
@@ -174,8 +223,18 @@ class Environment:
         """
         if not self.can_transition:
             raise ecole.MarkovError("Environment need to be reset.")
+        if self._native is not None and (dynamics_args or dynamics_kwargs):
+            raise ValueError(
+                "Extra dynamics arguments cannot be given to step in an episode running in C++, "
+                "give extra dynamics arguments to reset to run the episode in Python."
+            )
 
         try:
+            if self._native is not None:
+                observation, action_set, reward, done, information = self._native.step(action)
+                self.can_transition = not done
+                return observation, action_set, reward, done, information
+
             # Transition the environment to the next state
             done, action_set = self.dynamics.step_dynamics(
                 self.model, action, *dynamics_args, **dynamics_kwargs
@@ -183,18 +242,135 @@ class Environment:
             self.can_transition = not done
 
             # Extract additional information to be returned by step
-            reward = self.reward_function.extract(self.model, done)
+            with ecole.tracing.span("RewardFunction.extract", "data"):
+                reward = self.reward_function.extract(self.model, done)
             if not done:
-                observation = self.observation_function.extract(self.model, done)
+                with ecole.tracing.span("ObservationFunction.extract", "data"):
+                    observation = self.observation_function.extract(self.model, done)
             else:
                 observation = None
-            information = self.information_function.extract(self.model, done)
+            with ecole.tracing.span("InformationFunction.extract", "data"):
+                information = self.information_function.extract(self.model, done)
+            self._enforce_memory_limit()
 
             return observation, action_set, reward, done, information
         except Exception as e:
             self.can_transition = False
             raise e
 
+    def memory_usage(self):
+        """Memory held by the current :py:class:`~ecole.scip.Model` and the caches of the data functions.
+
+        Return the same dictionary as :py:class:`~ecole.information.MemoryUsage`, in bytes.
+        Data functions report the memory of their caches with a ``memory_usage`` method.
+        """
+        if self._native is not None:
+            return self._native.memory_usage()
+        information = ecole.information.MemoryUsage().extract(self.model, False)
+        information["data_functions"] = sum(
+            f.memory_usage() for f in self._data_functions() if hasattr(f, "memory_usage")
+        )
+        information["total"] += information["data_functions"]
+        return information
+
+    def _data_functions(self):
+        return (self.reward_function, self.observation_function, self.information_function)
+
+    def _enforce_memory_limit(self):
+        """Evict the caches of data functions if the memory limit is exceeded."""
+        if self.memory_limit is not None and self.memory_usage()["total"] > self.memory_limit:
+            for function in self._data_functions():
+                if hasattr(function, "evict"):
+                    function.evict()
+
+    def record(self, writer) -> None:
+        """Write the transitions of the following episodes to a dataset.
+
+        Every state on which an action is taken is written by the C++ environment as a sample with the
+        arrays of the observation, the action set, and the action, without creating Python objects.
+        Only environments running in C++ can record transitions.
+
+        Parameters
+        ----------
+        writer:
+            A :py:class:`~ecole.dataset.DatasetWriter`, or None to stop recording.
+            Recording starts or stops at the next call to :meth:`reset`.
+
+        """
+        self._dataset_writer = writer
+
+    def record_trajectory(self, enable: bool = True) -> None:
+        """Keep the trajectory of the following episodes, to replay them without the agent.
+
+        A trajectory holds the instance file and fingerprint, the state of the random generator,
+        the SCIP parameters, the memory limit, and the actions of an episode.
+        Only environments running in C++ can record trajectories.
+
+        Parameters
+        ----------
+        enable:
+            Whether to record trajectories, starting at the next call to :meth:`reset`.
+
+        """
+        self._record_trajectory = enable
+
+    def trajectory(self):
+        """The trajectory of the current episode as bytes, or None if trajectories are not recorded."""
+        if self._native is None:
+            return None
+        return self._native.trajectory()
+
+    def replay(self, trajectory, instance=None):
+        """Replay a trajectory with the data functions of this environment, without the agent.
+
+        The actions of the trajectory are taken in C++ from the same random state, SCIP parameters,
+        and memory limit, so that the environment goes through the same states, unless the episode
+        depends on time limits.
+        The observation, reward, and information functions can differ from the ones used to record it.
+
+        Parameters
+        ----------
+        trajectory:
+            The bytes returned by :meth:`trajectory`.
+        instance:
+            The instance of the trajectory, either a file path or a :py:class:`~ecole.scip.Model`.
+            By default, the file the trajectory was recorded from.
+
+        Returns
+        -------
+        transitions:
+            The list of the ``(observation, action_set, reward, done, info)`` tuples returned by
+            :meth:`reset` and every :meth:`step`.
+
+        """
+        native = self._native_environment()
+        if native is None:
+            raise ValueError(
+                "Only environments running in C++ can replay trajectories, which requires Ecole components."
+            )
+        self._native = None
+        self.can_transition = False
+        return native.replay(trajectory, instance)
+
+    def _native_environment(self):
+        """Return the C++ environment running the current components, or None if it cannot be used.
+
+        The C++ environment is cached, and recreated when a component is replaced.
+        """
+        components = (
+            self.dynamics,
+            self.observation_function,
+            self.reward_function,
+            self.information_function,
+        )
+        cached_components, native = self._native_cache
+        if cached_components is None or any(
+            c is not cc for c, cc in zip(components, cached_components)
+        ):
+            native = ecole.core.environment.make_native_environment(*components)
+            self._native_cache = (components, native)
+        return native
+
     def seed(self, value: int) -> None:
         """Set the random seed of the environment.
 
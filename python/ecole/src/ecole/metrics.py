@@ -0,0 +1 @@
+from ecole.core.metrics import *
@@ -0,0 +1,27 @@
+import contextlib
+import functools
+
+from ecole.core.tracing import *
+
+_no_span = contextlib.nullcontext()
+
+
+def span(name, category="python"):
+    """Context manager recording a span, or doing nothing when tracing is disabled."""
+    if is_enabled():
+        return Span(name, category)
+    return _no_span
+
+
+def traced(name, category="python"):
+    """Decorator recording a span for every call of the decorated function."""
+
+    def decorator(func):
+        @functools.wraps(func)
+        def wrapper(*args, **kwargs):
+            with span(name, category):
+                return func(*args, **kwargs)
+
+        return wrapper
+
+    return decorator
@@ -0,0 +1,80 @@
+"""Shared memory transport of observations between processes.
+
+Observations put in a :py:class:`SharedRing` by an actor process are copied once in shared memory.
+The learner process reads them as Numpy arrays pointing in that memory, without copy or unpickling.
+"""
+
+import types
+
+import numpy as np
+
+import ecole.core.transport
+from ecole.core.transport import *
+
+
+def _flatten(obj, prefix, arrays):
+    """Add the arrays of an object to a dictionary, with dotted names for nested objects."""
+    state = None
+    if not isinstance(obj, np.ndarray) and hasattr(obj, "__getstate__"):
+        state = obj.__getstate__()
+    if isinstance(state, dict):
+        for name, value in state.items():
+            _flatten(value, f"{prefix}.{name}" if prefix else name, arrays)
+        return
+    array = np.asarray(obj)
+    if array.dtype.hasobject:
+        # The bytes of Python objects are pointers, meaningless in another process
+        raise TypeError(f"Cannot put {type(obj).__name__} '{prefix}' in shared memory.")
+    arrays[prefix] = array
+
+
+def _unflatten(arrays):
+    """Rebuild nested namespaces from dotted array names."""
+    root = types.SimpleNamespace()
+    for name, array in arrays.items():
+        *parents, leaf = name.split(".")
+        node = root
+        for parent in parents:
+            if not hasattr(node, parent):
+                setattr(node, parent, types.SimpleNamespace())
+            node = getattr(node, parent)
+        setattr(node, leaf, array)
+    return root
+
+
+class SharedRing(ecole.core.transport.SharedRing):
+    """A ring of observations in shared memory, with one producer and one consumer process.
+
+    The producer creates the ring with ``SharedRing(name, n_slots, slot_capacity)``, and the consumer opens it with
+    ``SharedRing(name)``, or receives it pickled, for instance as an argument of a ``multiprocessing.Process``.
+    """
+
+    def put(self, obs, timeout=None):
+        """Copy an observation in the next slot, waiting at most timeout seconds for it to be free.
+
+        Observations can be None, Numpy arrays, or Ecole observations (any object whose ``__getstate__`` returns a
+        dictionary), possibly nested.
+        """
+        if obs is None:
+            self.put_arrays("NoneType", {}, timeout)
+        elif isinstance(obs, np.ndarray):
+            self.put_arrays("ndarray", {"": obs}, timeout)
+        else:
+            arrays = {}
+            _flatten(obs, "", arrays)
+            self.put_arrays(type(obs).__name__, arrays, timeout)
+
+    def get(self, timeout=None):
+        """Read the next observation, waiting at most timeout seconds for it to be written.
+
+        Ecole observations are returned as ``types.SimpleNamespace`` with the same attributes, holding Numpy arrays
+        that point in shared memory.
+        The slot is given back to the producer once all these arrays are garbage collected, so arrays that must be
+        kept around should be copied.
+        """
+        kind, arrays = self.get_arrays(timeout)
+        if kind == "NoneType":
+            return None
+        if kind == "ndarray":
+            return arrays[""]
+        return _unflatten(arrays)
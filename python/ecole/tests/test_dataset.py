@@ -0,0 +1,81 @@
+"""Test the on-disk datasets of samples."""
+
+import numpy as np
+import pytest
+
+import ecole
+
+
+def test_round_trip(tmp_path):
+    """Samples are read as written, across chunks and shards."""
+    with ecole.dataset.DatasetWriter(tmp_path, samples_per_chunk=3, samples_per_shard=7) as writer:
+        for i in range(20):
+            writer.append(
+                {"matrix": np.full((i % 4, 2), i, dtype=np.float32), "index": np.int64(i)}
+            )
+    assert writer.n_samples == 20
+
+    reader = ecole.dataset.DatasetReader(tmp_path)
+    assert len(reader) == 20
+    assert reader.columns == ["matrix", "index"]
+    sample = reader[13]
+    assert sample["matrix"].shape == (1, 2)
+    assert sample["matrix"].dtype == np.float32
+    assert (sample["matrix"] == 13).all()
+    assert sample["index"] == 13
+    assert not sample["matrix"].flags.writeable
+    with pytest.raises(IndexError):
+        reader[20]
+
+
+def test_compression(tmp_path):
+    """Compressed datasets are read as written."""
+    if not ecole.dataset.supports(ecole.dataset.Compression.zlib):
+        pytest.skip("Ecole compiled without zlib")
+    with ecole.dataset.DatasetWriter(
+        tmp_path, compression=ecole.dataset.Compression.zlib
+    ) as writer:
+        writer.append({"x": np.arange(100)})
+    assert (ecole.dataset.DatasetReader(tmp_path)[0]["x"] == np.arange(100)).all()
+
+
+def test_schema_mismatch(tmp_path):
+    """Samples must have the same arrays as the first one."""
+    writer = ecole.dataset.DatasetWriter(tmp_path)
+    writer.append({"x": np.zeros(3)})
+    with pytest.raises(ValueError):
+        writer.append({"x": np.zeros((3, 3))})
+    with pytest.raises(ValueError):
+        writer.append({"y": np.zeros(3)})
+
+
+def test_environment_record(tmp_path, problem_file):
+    """Environments running in C++ write their transitions."""
+    env = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    writer = ecole.dataset.DatasetWriter(tmp_path)
+    env.record(writer)
+    n_transitions = 0
+    obs, action_set, _, done, _ = env.reset(problem_file)
+    while not done and n_transitions < 5:
+        obs, action_set, _, done, _ = env.step(action_set[0])
+        n_transitions += 1
+    writer.close()
+
+    reader = ecole.dataset.DatasetReader(tmp_path)
+    assert len(reader) == n_transitions
+    sample = reader[0]
+    assert sample["observation.has_value"]
+    assert sample["observation.variable_features"].ndim == 2
+    assert sample["action"] == sample["action_set"][0]
+
+
+def test_environment_record_python_components(tmp_path, problem_file):
+    """Environments orchestrated in Python cannot record transitions."""
+
+    class Observation(ecole.observation.Nothing):
+        pass
+
+    env = ecole.environment.Branching(observation_function=Observation())
+    env.record(ecole.dataset.DatasetWriter(tmp_path))
+    with pytest.raises(ValueError):
+        env.reset(problem_file)
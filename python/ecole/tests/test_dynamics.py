@@ -107,6 +107,16 @@ class TestConfiguring(DynamicsUnitTests):
     def setup_method(self, method):
         self.dynamics = ecole.dynamics.ConfiguringDynamics()
 
+    @pytest.mark.slow
+    def test_race(self, model):
+        """Race configurations on copies of the model."""
+        configurations = [{"branching/scorefunc": "s"}, {"branching/scorefunc": "p"}]
+        result = self.dynamics.race(model, configurations)
+        assert isinstance(result, ecole.dynamics.RaceResult)
+        assert len(result.metrics) == len(configurations)
+        assert result.metrics[result.winner].is_solved
+        assert model.stage == ecole.scip.Stage.Problem
+
 
 class TestPrimalSearch(DynamicsUnitTests):
     @staticmethod
@@ -127,3 +137,13 @@ class TestPrimalSearch(DynamicsUnitTests):
 
     def setup_method(self, method):
         self.dynamics = ecole.dynamics.PrimalSearchDynamics()
+
+    def test_step_batch(self, model):
+        """Evaluate many partial solutions in a single step."""
+        done, action_set = self.dynamics.reset_dynamics(model)
+        assert not done
+        actions = [self.policy(action_set), ([], []), (action_set[:1], [1.0])]
+        done, action_set, trials = self.dynamics.step_batch_dynamics(model, actions)
+        assert len(trials) == len(actions)
+        assert all(isinstance(t, ecole.dynamics.PrimalSearchTrial) for t in trials)
+        assert not trials[1].lp_solved
@@ -55,3 +55,114 @@ def test_scip_params(model):
     env = MockEnvironment(scip_params={"concurrent/paramsetprefix": "testname"})
     env.reset(model)
     assert env.model.get_param("concurrent/paramsetprefix") == "testname"
+
+
+def test_native_environment():
+    """Environments of built-in components run in C++, others in Python."""
+    env = ecole.environment.Branching(reward_function=-ecole.reward.NNodes())
+    assert env._native_environment() is not None
+
+    class PythonNNodes(ecole.reward.NNodes):
+        pass
+
+    assert ecole.environment.Branching(reward_function=PythonNNodes())._native_environment() is None
+    assert MockEnvironment()._native_environment() is None
+
+
+def test_native_same_as_python(model):
+    """Native and Python orchestrations give the same transitions."""
+
+    class PythonNNodes(ecole.reward.NNodes):
+        pass
+
+    native_env = ecole.environment.Branching(reward_function=ecole.reward.NNodes())
+    python_env = ecole.environment.Branching(reward_function=PythonNNodes())
+    native_env.seed(0)
+    python_env.seed(0)
+
+    native_obs, native_action_set, native_reward, native_done, _ = native_env.reset(model)
+    python_obs, python_action_set, python_reward, python_done, _ = python_env.reset(model)
+    assert native_env.rng == python_env.rng
+    while True:
+        assert native_done == python_done
+        assert native_reward == python_reward
+        if native_done:
+            break
+        assert (native_action_set == python_action_set).all()
+        assert (native_obs.variable_features == python_obs.variable_features).all()
+        action = native_action_set[0]
+        native_obs, native_action_set, native_reward, native_done, _ = native_env.step(action)
+        python_obs, python_action_set, python_reward, python_done, _ = python_env.step(action)
+
+
+def test_native_step_error(model):
+    """Native environments cannot transition past terminal states."""
+    env = ecole.environment.Configuring()
+    _, _, _, done, _ = env.reset(model)
+    assert not done
+    _, _, _, done, _ = env.step({})
+    assert done
+    with pytest.raises(ecole.MarkovError):
+        env.step({})
+
+
+def test_native_step_extra_arguments(model):
+    """Native episodes refuse extra dynamics arguments in step, without ending the episode."""
+    env = ecole.environment.Branching()
+    _, action_set, _, done, _ = env.reset(model)
+    assert not done
+    with pytest.raises(ValueError):
+        env.step(action_set[0], "extra")
+    env.step(action_set[0])
+
+
+def test_replay_trajectory(problem_file, model):
+    """Replaying a trajectory with other data functions goes through the same states."""
+    env = ecole.environment.Branching(reward_function=ecole.reward.NNodes())
+    env.seed(0)
+    env.record_trajectory()
+    assert env.trajectory() is None
+    _, action_set, reward, done, _ = env.reset(problem_file)
+    action_sets, rewards = [], [reward]
+    for _ in range(10):
+        if done:
+            break
+        action_sets.append(action_set)
+        _, action_set, reward, done, _ = env.step(action_set[0])
+        rewards.append(reward)
+    trajectory = env.trajectory()
+    assert isinstance(trajectory, bytes)
+
+    replay_env = ecole.environment.Branching(
+        observation_function=ecole.observation.Khalil2016(), reward_function=ecole.reward.NNodes()
+    )
+    transitions = replay_env.replay(trajectory)
+    assert len(transitions) == len(rewards)
+    assert [r for _, _, r, _, _ in transitions] == rewards
+    assert transitions[-1][3] == done
+    for (obs, replay_action_set, _, _, _), action_set in zip(transitions, action_sets):
+        assert isinstance(obs, ecole.observation.Khalil2016Obs)
+        assert (replay_action_set == action_set).all()
+
+    with pytest.raises(ValueError):
+        replay_env.replay(trajectory, ecole.scip.Model.prob_basic())
+    with pytest.raises(ValueError):
+        MockEnvironment().replay(trajectory, model)
+
+
+@pytest.mark.parametrize("native", (True, False))
+def test_memory_limit(model, native):
+    """Memory limit is given to SCIP, and caches are evicted past it."""
+
+    class PythonNodeBipartite(ecole.observation.NodeBipartite):
+        pass
+
+    observation_function = (
+        ecole.observation.NodeBipartite(cache=True) if native else PythonNodeBipartite(cache=True)
+    )
+    env = ecole.environment.Branching(observation_function=observation_function, memory_limit=1)
+    assert (env._native_environment() is not None) == native
+    env.reset(model)
+    assert env.model.get_param("limits/memory") == 1 / 2**20
+    assert env.memory_usage()["data_functions"] == 0
+    assert env.memory_usage()["total"] > 0
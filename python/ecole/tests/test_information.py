@@ -20,7 +20,7 @@ def pytest_generate_tests(metafunc):
     `information_function` as input.
     """
     if "information_function" in metafunc.fixturenames:
-        all_information_functions = (ecole.information.Nothing(),)
+        all_information_functions = (ecole.information.Nothing(), ecole.information.MemoryUsage())
         metafunc.parametrize("information_function", all_information_functions)
 
 
@@ -53,3 +53,17 @@ def test_Nothing_information(model):
     info = make_info(ecole.information.Nothing(), model)
     assert isinstance(info, dict)
     assert len(info) == 0
+
+
+def test_MemoryUsage_information(model):
+    """Memory of SCIP is reported in bytes."""
+    info = make_info(ecole.information.MemoryUsage(), model)
+    assert set(info) == {
+        "scip_used",
+        "scip_total",
+        "scip_extern_estimate",
+        "data_functions",
+        "total",
+    }
+    assert info["scip_total"] > 0
+    assert info["total"] >= info["scip_total"]
@@ -90,6 +90,34 @@ def test_FileGenerator_parameters(tmp_dataset):
     assert generator.sampling_mode.name == "remove"
 
 
+def test_FileGenerator_shards(tmp_dataset):
+    """Shards of a directory are disjoint, and cover all files."""
+    names = []
+    for shard_index in range(2):
+        generator = ecole.instance.FileGenerator(
+            directory=str(tmp_dataset),
+            sampling_mode="remove",
+            shard_index=shard_index,
+            num_shards=2,
+            prefetch=1,
+        )
+        names += [model.name for model in generator]
+    assert len(names) == len(set(names)) == 3
+
+
+def test_ArchiveGenerator(tmp_path, tmp_dataset):
+    """Instances written in an archive are read back."""
+    archive = tmp_path / "instances.ecar"
+    with ecole.instance.ArchiveWriter(archive) as writer:
+        for file in sorted(tmp_dataset.iterdir()):
+            writer.add_file(file)
+        writer.add(ecole.scip.Model.from_file(next(tmp_dataset.iterdir())))
+    generator = ecole.instance.ArchiveGenerator(archive=archive, sampling_mode="remove")
+    assert len(generator) == 4
+    names = [model.name for model in generator]
+    assert {file.stem for file in tmp_dataset.iterdir()} <= set(names)
+
+
 def test_SetCoverGenerator_parameters():
     """Parameters are bound in the constructor and as attributes."""
     generator = ecole.instance.SetCoverGenerator(n_cols=10)
@@ -0,0 +1,77 @@
+"""Unit tests for Ecole metrics."""
+
+import socket
+import threading
+
+import pytest
+
+import ecole
+
+
+@pytest.fixture
+def metrics():
+    ecole.metrics.enable()
+    ecole.metrics.reset()
+    yield ecole.metrics
+    ecole.metrics.disable()
+    ecole.metrics.reset()
+
+
+def test_disabled_by_default():
+    """No value is recorded unless metrics are enabled."""
+    assert not ecole.metrics.is_enabled()
+    counter = ecole.metrics.Counter("test_disabled_total", "Disabled.")
+    counter.increment()
+    assert counter.value == 0
+
+
+def test_counter(metrics):
+    """Counters of all threads are summed."""
+    counter = metrics.Counter("test_python_total", "Python events.", {"kind": "a"})
+    thread = threading.Thread(target=counter.increment)
+    thread.start()
+    thread.join()
+    counter.increment(2)
+    assert counter.value == 3
+    assert 'test_python_total{kind="a"} 3\n' in metrics.to_prometheus()
+
+
+def test_histogram(metrics):
+    """Histograms count values in buckets and time blocks of code."""
+    histogram = metrics.Histogram("test_python_seconds", "Python durations.", [1.0, 2.0])
+    histogram.observe(1.5)
+    with histogram.time():
+        pass
+    assert histogram.count == 2
+    assert histogram.sum >= 1.5
+    assert 'test_python_seconds_bucket{le="2"} 2\n' in metrics.to_prometheus()
+    with pytest.raises(ValueError):
+        metrics.Histogram("test_python_seconds", "Python durations.", [1.0])
+
+
+def test_environment_metrics(metrics, model, tmp_path):
+    """Environment transitions are recorded and exported in the Prometheus text format."""
+    env = ecole.environment.Configuring()
+    env.reset(model)
+    env.step({})
+
+    path = tmp_path / "ecole.prom"
+    metrics.write_prometheus(path)
+    text = path.read_text()
+    assert "ecole_environment_reset_seconds_count 1\n" in text
+    assert "ecole_environment_step_seconds_count 1\n" in text
+    assert "ecole_environment_episodes_total 1\n" in text
+
+
+def test_socket_exporter(metrics, tmp_path):
+    """Metrics are served on a Unix socket."""
+    metrics.Counter("test_socket_total", "Socket.").increment()
+    path = tmp_path / "ecole.sock"
+    with metrics.SocketExporter(path):
+        with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as client:
+            client.connect(str(path))
+            client.sendall(b"GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n")
+            response = b"".join(iter(lambda: client.recv(4096), b"")).decode()
+    assert response.startswith("HTTP/1.0 200 OK\r\n")
+    assert "test_socket_total 1\n" in response
+    assert not path.exists()
@@ -33,6 +33,7 @@ def pytest_generate_tests(metafunc):
             ecole.observation.Pseudocosts(),
             ecole.observation.Khalil2016(),
             ecole.observation.Hutter2011(),
+            ecole.observation.OpenNodes(),
         )
         metafunc.parametrize("observation_function", all_observation_functions)
 
@@ -101,6 +102,19 @@ def test_NodeBipartite_observation(model):
     assert len(obs.RowFeatures.__members__) == obs.row_features.shape[1]
 
 
+def test_observation_arrays_are_views(model):
+    """Arrays of observations share the observation memory, which they keep alive."""
+    obs = make_obs(ecole.observation.NodeBipartite(), model)
+    variable_features = obs.variable_features
+    assert np.shares_memory(variable_features, obs.variable_features)
+    assert np.shares_memory(obs.edge_features.values, obs.edge_features.values)
+
+    variable_features[0, 0] = 42.0
+    assert obs.variable_features[0, 0] == 42.0
+    del obs
+    assert variable_features[0, 0] == 42.0
+
+
 def test_MilpBipartite_observation(model):
     """Observation of MilpBipartite is a type with array attributes."""
     obs = make_obs(ecole.observation.MilpBipartite(), model, stage=ecole.scip.Stage.Problem)
@@ -143,3 +157,13 @@ def test_Hutter2011_observation(model):
 
     # Check that there are enums describing feeatures
     assert len(obs.Features.__members__) == obs.features.shape[0]
+
+
+def test_OpenNodes_observation(model):
+    """Observation of OpenNodes is a numpy matrix."""
+    obs = make_obs(ecole.observation.OpenNodes(), model)
+    assert_array(obs.features, ndim=2, non_empty=False)
+    assert obs.features.shape[1] == obs.n_features
+
+    # Check that there are enums describing feeatures
+    assert len(obs.Features.__members__) == obs.features.shape[1]
@@ -32,7 +32,11 @@ def test_RandomGenerator_copy():
 def test_RandomGenerator_pickle():
     """Pickle preserve the state of the RandomGenerator."""
     rng = ecole.RandomGenerator(42)
-    assert rng == pickle.loads(pickle.dumps(rng))
+    rng.discard(3)
+    rng_copy = pickle.loads(pickle.dumps(rng))
+    assert rng_copy == rng
+    assert rng_copy() == rng()
+    assert isinstance(rng.__getstate__(), bytes)
 
 
 def test_same_seed():
@@ -58,3 +62,12 @@ def test_spawn_generator():
     rng_1 = ecole.spawn_random_generator()
     rng_2 = ecole.spawn_random_generator()
     assert rng_1 != rng_2
+
+
+def test_make_random_generator():
+    """Generators of a stream match spawned generators."""
+    ecole.seed(3)
+    rng_1 = ecole.spawn_random_generator()
+    rng_2 = ecole.spawn_random_generator()
+    assert rng_1 == ecole.make_random_generator(3, 1)
+    assert rng_2 == ecole.make_random_generator(3, 2)
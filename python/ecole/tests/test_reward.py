@@ -141,3 +141,47 @@ def test_primal_dual_integral_lambda(model):
     reward = reward_function.extract(model)
 
     assert reward >= 0
+
+
+def test_native_lowering(model, model_copy):
+    """Expressions of built-in reward functions are evaluated without Python callbacks."""
+    lp_iterations, n_nodes = ecole.reward.LpIterations(), ecole.reward.NNodes()
+    native_function = (lp_iterations**2 - 3 * n_nodes.exp()).cumsum()
+    assert native_function.is_native
+
+    python_function = (
+        ecole.reward.LpIterations().apply(lambda r: r**2) - 3 * ecole.reward.NNodes().exp()
+    ).cumsum()
+    assert not python_function.is_native
+
+    native_function.before_reset(model)
+    python_function.before_reset(model_copy)
+    pytest.helpers.advance_to_stage(model, ecole.scip.Stage.Solving)
+    pytest.helpers.advance_to_stage(model_copy, ecole.scip.Stage.Solving)
+    assert native_function.extract(model) == pytest.approx(python_function.extract(model_copy))
+
+
+def test_shared_reward_not_lowered():
+    """A stateful reward function used twice keeps the Python semantics."""
+    reward_function = ecole.reward.LpIterations()
+    assert not (reward_function * reward_function).is_native
+    assert (ecole.reward.IsDone() * ecole.reward.IsDone()).is_native
+
+
+def test_subclass_reward_not_lowered():
+    """Python subclasses of built-in reward functions may override them and are not lowered."""
+
+    class ConstantIsDone(ecole.reward.IsDone):
+        def extract(self, model, done=False):
+            return 2.0
+
+    assert not (ConstantIsDone() + 1).is_native
+
+
+def test_native_zero_division(model):
+    """Division by zero raises the Python exception."""
+    reward_function = ecole.reward.Constant(1.0) / ecole.reward.Constant(0.0)
+    assert reward_function.is_native
+    reward_function.before_reset(model)
+    with pytest.raises(ZeroDivisionError):
+        reward_function.extract(model)
@@ -1,4 +1,7 @@
 import importlib.util
+import sys
+import threading
+import time
 
 import pytest
 
@@ -22,6 +25,13 @@ def test_copy_orig(model):
     assert model != model_copy
 
 
+def test_copy_local(model):
+    pytest.helpers.advance_to_stage(model, ecole.scip.Stage.Solving)
+    model_copy = model.copy_local()
+    assert model != model_copy
+    assert model_copy.stage == ecole.scip.Stage.Problem
+
+
 @requires_pyscipopt
 def test_from_pyscipopt_shared():
     """Ecole share same pointer."""
@@ -173,3 +183,39 @@ def test_solve_iter(model):
 
     assert used_branchrule
     assert used_heuristic
+
+
+def solve_with_branchrule(model):
+    """Solve the model while handing back every branching decision to Python."""
+    fcall = model.solve_iter(ecole.scip.callback.BranchruleConstructor())
+    while fcall is not None:
+        fcall = model.solve_iter_continue(ecole.scip.callback.Result.DidNotRun)
+
+
+def test_solve_iter_releases_gil(model):
+    """Python threads make progress while solve_iter runs."""
+    counter = 0
+    stop = threading.Event()
+
+    def count():
+        nonlocal counter
+        while not stop.is_set():
+            counter += 1
+            time.sleep(0)  # Give back the GIL, as it is never taken from this thread
+
+    # The counting thread can then only run when the GIL is released, not on interpreter switches
+    switch_interval = sys.getswitchinterval()
+    sys.setswitchinterval(1000)
+    thread = threading.Thread(target=count)
+    try:
+        thread.start()
+        count_before = counter
+        solve_with_branchrule(model)
+        count_after = counter
+    finally:
+        stop.set()
+        thread.join()
+        sys.setswitchinterval(switch_interval)
+
+    assert model.is_solved
+    assert count_after > count_before
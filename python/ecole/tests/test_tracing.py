@@ -0,0 +1,81 @@
+"""Unit tests for Ecole tracing."""
+
+import json
+import threading
+
+import pytest
+
+import ecole
+
+
+@pytest.fixture
+def tracing():
+    ecole.tracing.enable()
+    yield ecole.tracing
+    ecole.tracing.disable()
+    ecole.tracing.clear()
+
+
+def test_disabled_by_default():
+    """No event is recorded unless tracing is enabled."""
+    assert not ecole.tracing.is_enabled()
+    with ecole.tracing.Span("ignored"):
+        pass
+    assert all(event.name != "ignored" for event in ecole.tracing.collect())
+
+
+def test_span(tracing):
+    """Context manager records one event."""
+    with tracing.Span("outer", "test"):
+        with tracing.Span("inner", "test"):
+            pass
+    events = {e.name: e for e in tracing.collect() if e.category == "test"}
+    assert set(events) == {"outer", "inner"}
+    assert events["outer"].start_ns <= events["inner"].start_ns
+    assert events["inner"].duration_ns <= events["outer"].duration_ns
+
+
+def test_ring_buffer_capacity():
+    """Oldest events are overwritten when the buffer is full."""
+    ecole.tracing.enable(capacity_per_thread=2)
+    try:
+        for name in ("a", "b", "c"):
+            with ecole.tracing.Span(name, "test"):
+                pass
+        assert [e.name for e in ecole.tracing.collect()] == ["b", "c"]
+    finally:
+        ecole.tracing.disable()
+        ecole.tracing.enable()
+        ecole.tracing.disable()
+
+
+def test_threads(tracing):
+    """Events of different threads are recorded with different thread ids."""
+
+    def record():
+        with tracing.Span("thread", "test"):
+            pass
+
+    thread = threading.Thread(target=record)
+    thread.start()
+    thread.join()
+    record()
+    events = [e for e in tracing.collect() if e.name == "thread"]
+    assert len(events) == 2
+    assert events[0].thread_id != events[1].thread_id
+
+
+def test_environment_chrome_trace(tracing, model, tmp_path):
+    """Environment steps are traced and exported in the Chrome Trace Event format."""
+    env = ecole.environment.Configuring()
+    env.reset(model)
+    env.step({})
+
+    names = {e.name for e in tracing.collect()}
+    assert {"Environment.reset", "Environment.step", "RewardFunction.extract"} <= names
+
+    path = tmp_path / "trace.json"
+    tracing.write_chrome_json(str(path))
+    trace = json.loads(path.read_text())
+    assert {e["name"] for e in trace["traceEvents"]} == names
+    assert all(e["ph"] == "X" for e in trace["traceEvents"])
@@ -0,0 +1,99 @@
+"""Test the shared memory transport of observations."""
+
+import gc
+import multiprocessing
+import uuid
+
+import numpy as np
+import pytest
+
+import ecole
+
+
+@pytest.fixture
+def ring():
+    return ecole.transport.SharedRing(
+        f"ecole-test-{uuid.uuid4().hex}", n_slots=2, slot_capacity=2**20
+    )
+
+
+def test_array_round_trip(ring):
+    """Arrays are read as views in shared memory."""
+    array = np.arange(12, dtype=np.float32).reshape(3, 4)
+    ring.put(array)
+    ring.put(None)
+    read = ring.get()
+    assert read.dtype == array.dtype
+    assert (read == array).all()
+    assert ring.get() is None
+    assert ring.n_written == ring.n_read == 2
+
+
+def test_observation_round_trip(ring, model):
+    """Ecole observations are read as namespaces of arrays."""
+    obs_func = ecole.observation.NodeBipartite()
+    obs_func.before_reset(model)
+    pytest.helpers.advance_to_stage(model, ecole.scip.Stage.Solving)
+    obs = obs_func.extract(model, False)
+
+    ring.put(obs)
+    read = ring.get()
+    assert (read.variable_features == obs.variable_features).all()
+    assert (read.row_features == obs.row_features).all()
+    assert (read.edge_features.values == obs.edge_features.values).all()
+    assert (read.edge_features.indices == obs.edge_features.indices).all()
+    assert read.edge_features.indices.dtype == np.uint64
+
+
+def test_backpressure(ring):
+    """Slots are only reused once all arrays read from them are garbage collected."""
+    ring.put(np.zeros(3))
+    ring.put(np.ones(3))
+    with pytest.raises(TimeoutError):
+        ring.put(np.zeros(3), timeout=0.01)
+
+    first = ring.get()
+    second = ring.get()
+    del second
+    gc.collect()
+    with pytest.raises(TimeoutError):
+        ring.put(np.zeros(3), timeout=0.01)
+    del first
+    gc.collect()
+    ring.put(np.zeros(3), timeout=0.01)
+
+
+def test_get_timeout(ring):
+    """Reading an empty ring times out."""
+    with pytest.raises(TimeoutError):
+        ring.get(timeout=0.01)
+
+
+def test_message_too_large(ring):
+    """Messages larger than the slot capacity are refused."""
+    with pytest.raises(ValueError):
+        ring.put(np.zeros(2**20, dtype=np.uint8))
+
+
+def test_reject_python_objects(ring):
+    """Arrays of Python objects, whose bytes are pointers, are refused."""
+    with pytest.raises(TypeError):
+        ring.put(np.array([object()]))
+    with pytest.raises(TypeError):
+        ring.put_arrays("ndarray", {"": np.array([object()])}, None)
+
+
+def produce(ring, n_messages):
+    for i in range(n_messages):
+        ring.put(np.full((10, 10), i, dtype=np.int64))
+
+
+def test_between_processes(ring):
+    """Pickled rings open the same shared memory in another process."""
+    n_messages = 10
+    process = multiprocessing.get_context("spawn").Process(target=produce, args=(ring, n_messages))
+    process.start()
+    for i in range(n_messages):
+        assert (ring.get(timeout=60) == i).all()
+    process.join()
+    assert process.exitcode == 0
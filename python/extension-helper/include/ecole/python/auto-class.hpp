@@ -14,7 +14,13 @@ namespace ecole::python {
 template <typename Class, typename... ClassArgs> struct auto_class : public pybind11::class_<Class, ClassArgs...> {
 	using pybind11::class_<Class, ClassArgs...>::class_;
 
-	/** An Alternative pybind11::class_::def_readwrite for xtensor members. */
+	/**
+	 * An Alternative pybind11::class_::def_readwrite for xtensor members.
+	 *
+	 * The getter returns a NumPy array viewing the member memory, which keeps the owning object alive, so that
+	 * large observations are never copied when accessed from Python.
+	 * The setter copies the given array into the member.
+	 */
 	template <typename Str, typename MemberPtr, typename... Args>
 	auto def_readwrite_xtensor(Str&& name, MemberPtr&& member_ptr, Args&&... args) -> auto& {
 		using Member = std::remove_reference_t<std::invoke_result_t<MemberPtr, Class>>;
@@ -22,7 +28,10 @@ template <typename Class, typename... ClassArgs> struct auto_class : public pybi
 		auto constexpr rank = xt::get_rank<Member>::value;
 		this->def_property(
 			std::forward<Str>(name),
-			[member_ptr](Class& self) -> decltype(auto) { return std::invoke(member_ptr, self); },
+			// xtensor-python copies lvalue tensors unless the policy is a reference
+			pybind11::cpp_function(
+				[member_ptr](Class& self) -> Member& { return std::invoke(member_ptr, self); },
+				pybind11::return_value_policy::reference_internal),
 			[member_ptr](Class& self, xt::pytensor<value_type, rank> const& val) { std::invoke(member_ptr, self) = val; },
 			std::forward<Args>(args)...);
 		return *this;
@@ -87,8 +96,8 @@ template <typename Class, typename... ClassArgs> struct auto_data_class : public
 	}
 
 	template <typename... FuncPtr> auto def_auto_init(Member<FuncPtr>... members) -> auto& {
-		// Instantiate the C++ type at compile time to get default parameters.
-		auto constexpr default_params = type{};
+		// Instantiate the C++ type to get default parameters.
+		auto const default_params = type{};
 		// Bind a constructor that takes as input all parameters
 		this->def(
 			// Get the type of each parameter and add it to the Python constructor